@@ -0,0 +1,430 @@
+/*
+ *  Connection Agent example
+ *
+ *  Copyright (C) 2011  Daniel Mack <daniel@zonque.org>
+ *
+ *  This program is free software; you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License version 2 as
+ *  published by the Free Software Foundation.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program; if not, write to the Free Software
+ *  Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+
+
+#include <glib.h>
+#include <gio/gio.h>
+
+#include "connman-agent.h"
+#include "connman-export.h"
+#include "connman-generated.h"
+#include "connman-log.h"
+
+/*
+ * In-process net.connman.Agent. ConnMan asks it for credentials
+ * whenever a secured service connects, including auto-connects and
+ * roams we did not start. Answers come from an in-memory cache, with
+ * an optional lookup function behind it, so no prompt ever has to wait
+ * for the UI.
+ */
+struct _ConnmanAgent {
+  GObject parent;
+
+  ConnmanExport *export;        /* only ConnMan may ask for secrets */
+  GDBusConnection *connection;
+  gchar *object_path;
+
+  GHashTable *credentials;      /* service path -> (field -> value) */
+
+  ConnmanAgentLookupFunc lookup_func;
+  gpointer lookup_data;
+  GDestroyNotify lookup_destroy;
+};
+
+static GObjectClass *parent_class = NULL;
+
+enum {
+  SIGNAL_REPORT_ERROR,
+  SIGNAL_RELEASED,
+  SIGNAL_LAST
+};
+
+static gint signals[SIGNAL_LAST];
+
+static void
+connman_agent_get_property (GObject    *object,
+                            guint       property_id,
+                            GValue     *value,
+                            GParamSpec *pspec)
+{
+  switch (property_id)
+    {
+      default:
+        G_OBJECT_WARN_INVALID_PROPERTY_ID (object, property_id, pspec);
+    }
+}
+
+static void
+connman_agent_set_property (GObject      *object,
+                            guint         property_id,
+                            const GValue *value,
+                            GParamSpec   *pspec)
+{
+  switch (property_id)
+    {
+      default:
+        G_OBJECT_WARN_INVALID_PROPERTY_ID (object, property_id, pspec);
+    }
+}
+
+/* cached value first, then the lookup function, whose answer is kept */
+static const gchar *
+agent_lookup(ConnmanAgent *agent,
+             const gchar *service_path,
+             const gchar *field)
+{
+  GHashTable *fields = g_hash_table_lookup(agent->credentials, service_path);
+  const gchar *value = NULL;
+  gchar *found;
+
+  if (fields)
+    value = g_hash_table_lookup(fields, field);
+
+  if (value || !agent->lookup_func)
+    return value;
+
+  found = agent->lookup_func(agent, service_path, field, agent->lookup_data);
+  if (!found)
+    return NULL;
+
+  connman_agent_set_credential(agent, service_path, field, found);
+  g_free(found);
+
+  return connman_agent_get_credential(agent, service_path, field);
+}
+
+static gboolean
+handle_request_input(ConnmanProxyAgent *skeleton,
+                     GDBusMethodInvocation *invocation,
+                     const gchar *service_path,
+                     GVariant *fields,
+                     gpointer user_data)
+{
+  ConnmanAgent *agent = CONNMAN_AGENT(user_data);
+  GVariantBuilder builder;
+  GVariantIter iter;
+  GVariant *spec;
+  const gchar *field;
+
+  if (!connman_export_check_caller(agent->export, invocation))
+    return TRUE;
+
+  g_variant_builder_init(&builder, G_VARIANT_TYPE("a{sv}"));
+  g_variant_iter_init(&iter, fields);
+
+  while (g_variant_iter_loop(&iter, "{&s@v}", &field, &spec))
+    {
+      GVariant *args = g_variant_get_variant(spec);
+      const gchar *requirement = NULL;
+      const gchar *value;
+
+      g_variant_lookup(args, "Requirement", "&s", &requirement);
+
+      /* alternates (WPS) and informational fields need no answer */
+      if (g_strcmp0(requirement, "mandatory") != 0 &&
+          g_strcmp0(requirement, "optional") != 0)
+        {
+          g_variant_unref(args);
+          continue;
+        }
+
+      value = agent_lookup(agent, service_path, field);
+      if (value)
+        {
+          g_variant_builder_add(&builder, "{sv}", field, g_variant_new_string(value));
+        }
+      else if (g_strcmp0(requirement, "mandatory") == 0)
+        {
+          connman_info(service_path, "no credential for '%s'", field);
+          g_variant_unref(args);
+          g_variant_unref(spec);
+          g_variant_builder_clear(&builder);
+          g_dbus_method_invocation_return_dbus_error(invocation,
+                                                     "net.connman.Agent.Error.Canceled",
+                                                     "No credentials available");
+          return TRUE;
+        }
+
+      g_variant_unref(args);
+    }
+
+  connman_debug(service_path, "answered input request");
+  connman_proxy_agent_complete_request_input(skeleton, invocation,
+                                             g_variant_builder_end(&builder));
+
+  return TRUE;
+}
+
+static gboolean
+handle_report_error(ConnmanProxyAgent *skeleton,
+                    GDBusMethodInvocation *invocation,
+                    const gchar *service_path,
+                    const gchar *error,
+                    gpointer user_data)
+{
+  ConnmanAgent *agent = CONNMAN_AGENT(user_data);
+
+  if (!connman_export_check_caller(agent->export, invocation))
+    return TRUE;
+
+  connman_message(service_path, "connect error: %s", error);
+
+  /* do not feed ConnMan the same wrong key on the next attempt */
+  if (g_str_equal(error, "invalid-key"))
+    connman_agent_set_credential(agent, service_path, "Passphrase", NULL);
+
+  g_signal_emit(agent, signals[SIGNAL_REPORT_ERROR], 0, service_path, error);
+  connman_proxy_agent_complete_report_error(skeleton, invocation);
+
+  return TRUE;
+}
+
+static gboolean
+handle_request_browser(ConnmanProxyAgent *skeleton,
+                       GDBusMethodInvocation *invocation,
+                       const gchar *service_path,
+                       const gchar *url,
+                       gpointer user_data)
+{
+  ConnmanAgent *agent = CONNMAN_AGENT(user_data);
+
+  if (!connman_export_check_caller(agent->export, invocation))
+    return TRUE;
+
+  g_dbus_method_invocation_return_dbus_error(invocation,
+                                             "net.connman.Agent.Error.Canceled",
+                                             "Browser logins are not supported");
+  return TRUE;
+}
+
+static gboolean
+handle_release(ConnmanProxyAgent *skeleton,
+               GDBusMethodInvocation *invocation,
+               gpointer user_data)
+{
+  ConnmanAgent *agent = CONNMAN_AGENT(user_data);
+
+  if (!connman_export_check_caller(agent->export, invocation))
+    return TRUE;
+
+  connman_info(agent->object_path, "released by ConnMan");
+  g_signal_emit(agent, signals[SIGNAL_RELEASED], 0);
+  connman_proxy_agent_complete_release(skeleton, invocation);
+
+  return TRUE;
+}
+
+static gboolean
+handle_cancel(ConnmanProxyAgent *skeleton,
+              GDBusMethodInvocation *invocation,
+              gpointer user_data)
+{
+  ConnmanAgent *agent = CONNMAN_AGENT(user_data);
+
+  if (!connman_export_check_caller(agent->export, invocation))
+    return TRUE;
+
+  /* requests are answered synchronously, there is nothing to cancel */
+  connman_proxy_agent_complete_cancel(skeleton, invocation);
+
+  return TRUE;
+}
+
+/*
+ * Store @value for @field ("Passphrase", "Identity", "Name", ...) of
+ * the service at @service_path. A NULL @value forgets the field.
+ */
+void connman_agent_set_credential(ConnmanAgent *agent,
+                                  const gchar *service_path,
+                                  const gchar *field,
+                                  const gchar *value)
+{
+  GHashTable *fields;
+
+  g_return_if_fail(CONNMAN_IS_AGENT(agent));
+  g_return_if_fail(service_path != NULL);
+  g_return_if_fail(field != NULL);
+
+  fields = g_hash_table_lookup(agent->credentials, service_path);
+
+  if (!value)
+    {
+      if (fields)
+        g_hash_table_remove(fields, field);
+      return;
+    }
+
+  if (!fields)
+    {
+      fields = g_hash_table_new_full(g_str_hash, g_str_equal, g_free, g_free);
+      g_hash_table_insert(agent->credentials, g_strdup(service_path), fields);
+    }
+
+  g_hash_table_insert(fields, g_strdup(field), g_strdup(value));
+}
+
+const gchar *connman_agent_get_credential(ConnmanAgent *agent,
+                                          const gchar *service_path,
+                                          const gchar *field)
+{
+  GHashTable *fields;
+
+  g_return_val_if_fail(CONNMAN_IS_AGENT(agent), NULL);
+
+  fields = g_hash_table_lookup(agent->credentials, service_path);
+
+  return fields ? g_hash_table_lookup(fields, field) : NULL;
+}
+
+void connman_agent_forget(ConnmanAgent *agent,
+                          const gchar *service_path)
+{
+  g_return_if_fail(CONNMAN_IS_AGENT(agent));
+
+  g_hash_table_remove(agent->credentials, service_path);
+}
+
+/*
+ * Consult @func for fields that are not cached. It returns a newly
+ * allocated value or NULL; values it returns are cached.
+ */
+void connman_agent_set_lookup_func(ConnmanAgent *agent,
+                                   ConnmanAgentLookupFunc func,
+                                   gpointer user_data,
+                                   GDestroyNotify destroy)
+{
+  g_return_if_fail(CONNMAN_IS_AGENT(agent));
+
+  if (agent->lookup_destroy)
+    agent->lookup_destroy(agent->lookup_data);
+
+  agent->lookup_func = func;
+  agent->lookup_data = user_data;
+  agent->lookup_destroy = destroy;
+}
+
+const gchar *connman_agent_get_object_path(ConnmanAgent *agent)
+{
+  g_return_val_if_fail(CONNMAN_IS_AGENT(agent), NULL);
+  return agent->object_path;
+}
+
+/*
+ * Export an agent at @object_path. Hand it to ConnMan with
+ * connman_manager_register_agent().
+ */
+ConnmanAgent *connman_agent_new(GBusType bus_type,
+                                const gchar *object_path,
+                                GError **error)
+{
+  ConnmanAgent *agent = g_object_new(CONNMAN_TYPE_AGENT, NULL);
+  ConnmanProxyAgent *skeleton;
+
+  agent->object_path = g_strdup(object_path);
+  agent->connection = g_bus_get_sync(bus_type, NULL, error);
+  if (!agent->connection)
+    {
+      g_object_unref(agent);
+      return NULL;
+    }
+
+  skeleton = connman_proxy_agent_skeleton_new();
+
+  g_signal_connect(skeleton, "handle-request-input",
+                   G_CALLBACK(handle_request_input), agent);
+  g_signal_connect(skeleton, "handle-report-error",
+                   G_CALLBACK(handle_report_error), agent);
+  g_signal_connect(skeleton, "handle-request-browser",
+                   G_CALLBACK(handle_request_browser), agent);
+  g_signal_connect(skeleton, "handle-release",
+                   G_CALLBACK(handle_release), agent);
+  g_signal_connect(skeleton, "handle-cancel",
+                   G_CALLBACK(handle_cancel), agent);
+
+  agent->export = connman_export_new(agent->connection,
+                                     G_DBUS_INTERFACE_SKELETON(skeleton),
+                                     object_path, "agent", agent, error);
+  if (!agent->export)
+    {
+      g_object_unref(agent);
+      return NULL;
+    }
+
+  connman_debug(object_path, "new agent %p", agent);
+
+  return agent;
+}
+
+static void
+connman_agent_init (ConnmanAgent *agent)
+{
+  agent->credentials = g_hash_table_new_full(g_str_hash, g_str_equal, g_free,
+                                             (GDestroyNotify) g_hash_table_destroy);
+}
+
+static void
+connman_agent_finalize (GObject *object)
+{
+  ConnmanAgent *agent = CONNMAN_AGENT(object);
+
+  connman_export_free(agent->export);
+
+  if (agent->connection)
+    g_object_unref(agent->connection);
+
+  if (agent->lookup_destroy)
+    agent->lookup_destroy(agent->lookup_data);
+
+  g_hash_table_destroy(agent->credentials);
+  g_free(agent->object_path);
+
+  G_OBJECT_CLASS (parent_class)->finalize (object);
+}
+
+static void
+connman_agent_class_init (ConnmanAgentClass *klass)
+{
+  GObjectClass *object_class;
+
+  parent_class = (GObjectClass *) g_type_class_peek_parent (klass);
+  object_class = (GObjectClass *) klass;
+
+  object_class->get_property = connman_agent_get_property;
+  object_class->set_property = connman_agent_set_property;
+  object_class->finalize = connman_agent_finalize;
+
+  signals[SIGNAL_REPORT_ERROR] =
+    g_signal_new("report-error",
+                 G_TYPE_FROM_CLASS(klass),
+                 G_SIGNAL_RUN_LAST,
+                 0, NULL, NULL,
+                 g_cclosure_marshal_generic,
+                 G_TYPE_NONE, 2, G_TYPE_STRING, G_TYPE_STRING);
+
+  signals[SIGNAL_RELEASED] =
+    g_signal_new("released",
+                 G_TYPE_FROM_CLASS(klass),
+                 G_SIGNAL_RUN_LAST,
+                 0, NULL, NULL,
+                 g_cclosure_marshal_VOID__VOID,
+                 G_TYPE_NONE, 0);
+}
+
+G_DEFINE_TYPE (ConnmanAgent, connman_agent, G_TYPE_OBJECT)
+
@@ -0,0 +1,52 @@
+#ifndef CONNMAN_AGENT_H_
+#define CONNMAN_AGENT_H_
+
+#include <gio/gio.h>
+#include <glib-object.h>
+
+G_BEGIN_DECLS
+
+typedef struct _ConnmanAgent      ConnmanAgent;
+typedef struct _ConnmanAgentClass ConnmanAgentClass;
+
+/* returns a newly allocated value for @field, or NULL if unknown */
+typedef gchar *(*ConnmanAgentLookupFunc) (ConnmanAgent *agent,
+                                          const gchar *service_path,
+                                          const gchar *field,
+                                          gpointer user_data);
+
+struct _ConnmanAgentClass {
+  GObjectClass parent_class;
+};
+
+void connman_agent_set_credential(ConnmanAgent *agent,
+                                  const gchar *service_path,
+                                  const gchar *field,
+                                  const gchar *value);
+const gchar *connman_agent_get_credential(ConnmanAgent *agent,
+                                          const gchar *service_path,
+                                          const gchar *field);
+void connman_agent_forget(ConnmanAgent *agent,
+                          const gchar *service_path);
+void connman_agent_set_lookup_func(ConnmanAgent *agent,
+                                   ConnmanAgentLookupFunc func,
+                                   gpointer user_data,
+                                   GDestroyNotify destroy);
+const gchar *connman_agent_get_object_path(ConnmanAgent *agent);
+
+ConnmanAgent *connman_agent_new(GBusType bus_type,
+                                const gchar *object_path,
+                                GError **error);
+
+GType connman_agent_get_type (void);
+#define CONNMAN_TYPE_AGENT             connman_agent_get_type()
+#define CONNMAN_AGENT(obj)             (G_TYPE_CHECK_INSTANCE_CAST ((obj), CONNMAN_TYPE_AGENT, ConnmanAgent))
+#define CONNMAN_AGENT_CLASS(klass)     (G_TYPE_CHECK_CLASS_CAST ((klass), CONNMAN_TYPE_AGENT, ConnmanAgentClass))
+#define CONNMAN_IS_AGENT(obj)          (G_TYPE_CHECK_INSTANCE_TYPE ((obj), CONNMAN_TYPE_AGENT))
+#define CONNMAN_IS_AGENT_CLASS(klass)  (G_TYPE_CHECK_CLASS_TYPE ((klass), CONNMAN_TYPE_AGENT))
+#define CONNMAN_AGENT_GET_CLASS(obj)   (G_TYPE_INSTANCE_GET_CLASS ((obj), CONNMAN_TYPE_AGENT, ConnmanAgentClass))
+
+G_END_DECLS
+
+
+#endif /* CONNMAN_AGENT_H_ */
@@ -0,0 +1,394 @@
+/*
+ *  Connection Manager example
+ *
+ *  Copyright (C) 2011  Daniel Mack <daniel@zonque.org>
+ *
+ *  This program is free software; you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License version 2 as
+ *  published by the Free Software Foundation.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program; if not, write to the Free Software
+ *  Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+
+#include <errno.h>
+#include <string.h>
+#include <unistd.h>
+
+#include <glib.h>
+
+#include "connman-changelog.h"
+
+/*
+ * Stream format: the 4 byte magic "CMCL" and a varint version, then
+ * records of the form
+ *
+ *   varint type, varint payload length, payload
+ *
+ * All integers are unsigned LEB128 varints, strings are a varint
+ * length followed by the bytes. Every payload starts with the time
+ * since the previous record in milliseconds. Object paths are sent
+ * once in a PATH record and referred to by id afterwards; the id of a
+ * removed service or technology is retired with its REMOVED record and
+ * a path that comes back gets a new one, ids are never reused. Unknown
+ * record types can be skipped by length.
+ */
+#define CHANGELOG_MAGIC   "CMCL"
+#define CHANGELOG_VERSION 1
+
+/* give up on a consumer that lets this much pile up */
+#define CHANGELOG_MAX_BUFFERED (4 * 1024 * 1024)
+
+struct _ConnmanChangelog {
+  int fd;
+  gboolean failed;
+  GMainContext *context;
+  GSource *watch;               /* waits for the fd to drain, or NULL */
+  GByteArray *buf;
+  GByteArray *record;
+  GHashTable *paths;            /* object path -> id */
+  guint next_id;
+  gint64 last_time;
+};
+
+static void put_varint(GByteArray *buf, guint64 v)
+{
+  guint8 b;
+
+  do
+    {
+      b = v & 0x7f;
+      v >>= 7;
+      if (v)
+        b |= 0x80;
+      g_byte_array_append(buf, &b, 1);
+    }
+  while (v);
+}
+
+static void put_string(GByteArray *buf, const gchar *str)
+{
+  gsize len = str ? strlen(str) : 0;
+
+  put_varint(buf, len);
+  g_byte_array_append(buf, (const guint8 *) str, len);
+}
+
+static void begin_record(ConnmanChangelog *log)
+{
+  gint64 now = g_get_monotonic_time();
+
+  g_byte_array_set_size(log->record, 0);
+  put_varint(log->record, log->last_time ? (now - log->last_time) / 1000 : 0);
+  log->last_time = now;
+}
+
+static void end_record(ConnmanChangelog *log, guint type)
+{
+  put_varint(log->buf, type);
+  put_varint(log->buf, log->record->len);
+  g_byte_array_append(log->buf, log->record->data, log->record->len);
+}
+
+static guint intern_path(ConnmanChangelog *log, const gchar *path)
+{
+  gpointer id;
+
+  if (g_hash_table_lookup_extended(log->paths, path, NULL, &id))
+    return GPOINTER_TO_UINT(id);
+
+  g_hash_table_insert(log->paths, g_strdup(path), GUINT_TO_POINTER(log->next_id));
+
+  begin_record(log);
+  put_varint(log->record, log->next_id);
+  put_string(log->record, path);
+  end_record(log, CONNMAN_CHANGELOG_PATH);
+
+  return log->next_id++;
+}
+
+static void put_fields(GByteArray *buf,
+                       ConnmanService *service,
+                       guint fields)
+{
+  gboolean auto_connect;
+  gint type;
+
+  g_object_get(service, "type", &type, "auto-connect", &auto_connect, NULL);
+
+  put_varint(buf, fields);
+
+  /* values follow in CONNMAN_SERVICE_FIELD_* bit order */
+  if (fields & CONNMAN_SERVICE_FIELD_NAME)
+    put_string(buf, connman_service_get_name(service));
+  if (fields & CONNMAN_SERVICE_FIELD_TYPE)
+    put_varint(buf, type);
+  if (fields & CONNMAN_SERVICE_FIELD_STATE)
+    put_varint(buf, connman_service_get_state(service));
+  if (fields & CONNMAN_SERVICE_FIELD_STRENGTH)
+    put_varint(buf, connman_service_get_strength(service));
+  if (fields & CONNMAN_SERVICE_FIELD_FAVORITE)
+    put_varint(buf, connman_service_passphrase_is_favorite(service));
+  if (fields & CONNMAN_SERVICE_FIELD_AUTO_CONNECT)
+    put_varint(buf, auto_connect);
+  if (fields & CONNMAN_SERVICE_FIELD_IMMUTABLE)
+    put_varint(buf, connman_service_passphrase_is_immutable(service));
+  if (fields & CONNMAN_SERVICE_FIELD_LOGIN_REQUIRED)
+    put_varint(buf, connman_service_login_required(service));
+  if (fields & CONNMAN_SERVICE_FIELD_PASSPHRASE_REQUIRED)
+    put_varint(buf, connman_service_passphrase_required(service));
+}
+
+/*
+ * Start a change log on @fd, which may be a regular file, a pipe or a
+ * memfd. The descriptor is not closed by the log. If @fd is
+ * non-blocking, whatever it does not take right away is written from
+ * @context once it becomes writable.
+ */
+ConnmanChangelog *connman_changelog_new(int fd,
+                                        GMainContext *context)
+{
+  ConnmanChangelog *log;
+
+  g_return_val_if_fail(fd >= 0, NULL);
+
+  log = g_slice_new0(ConnmanChangelog);
+  log->fd = fd;
+  log->context = context ? g_main_context_ref(context) : NULL;
+  log->buf = g_byte_array_new();
+  log->record = g_byte_array_new();
+  log->paths = g_hash_table_new_full(g_str_hash, g_str_equal, g_free, NULL);
+
+  g_byte_array_append(log->buf, (const guint8 *) CHANGELOG_MAGIC, 4);
+  put_varint(log->buf, CHANGELOG_VERSION);
+
+  return log;
+}
+
+void connman_changelog_free(ConnmanChangelog *log)
+{
+  if (!log)
+    return;
+
+  connman_changelog_flush(log);
+
+  if (log->watch)
+    {
+      g_source_destroy(log->watch);
+      g_source_unref(log->watch);
+    }
+  if (log->context)
+    g_main_context_unref(log->context);
+
+  g_byte_array_free(log->buf, TRUE);
+  g_byte_array_free(log->record, TRUE);
+  g_hash_table_destroy(log->paths);
+  g_slice_free(ConnmanChangelog, log);
+}
+
+void connman_changelog_service_added(ConnmanChangelog *log,
+                                     ConnmanService *service)
+{
+  guint id;
+
+  g_return_if_fail(log != NULL);
+
+  if (log->failed)
+    return;
+
+  id = intern_path(log, connman_service_get_object_path(service));
+
+  begin_record(log);
+  put_varint(log->record, id);
+  put_fields(log->record, service, CONNMAN_SERVICE_FIELD_ALL);
+  end_record(log, CONNMAN_CHANGELOG_SERVICE_ADDED);
+}
+
+void connman_changelog_service_removed(ConnmanChangelog *log,
+                                       ConnmanService *service)
+{
+  guint id;
+
+  g_return_if_fail(log != NULL);
+
+  if (log->failed)
+    return;
+
+  id = intern_path(log, connman_service_get_object_path(service));
+
+  begin_record(log);
+  put_varint(log->record, id);
+  end_record(log, CONNMAN_CHANGELOG_SERVICE_REMOVED);
+
+  g_hash_table_remove(log->paths, connman_service_get_object_path(service));
+}
+
+void connman_changelog_service_changed(ConnmanChangelog *log,
+                                       ConnmanService *service,
+                                       guint fields)
+{
+  guint id;
+
+  g_return_if_fail(log != NULL);
+
+  if (log->failed || !fields)
+    return;
+
+  id = intern_path(log, connman_service_get_object_path(service));
+
+  begin_record(log);
+  put_varint(log->record, id);
+  put_fields(log->record, service, fields);
+  end_record(log, CONNMAN_CHANGELOG_SERVICE_CHANGED);
+}
+
+void connman_changelog_technology_changed(ConnmanChangelog *log,
+                                          const gchar *path,
+                                          const gchar *type)
+{
+  guint id;
+
+  g_return_if_fail(log != NULL);
+
+  if (log->failed)
+    return;
+
+  id = intern_path(log, path);
+
+  begin_record(log);
+  put_varint(log->record, id);
+  put_string(log->record, type);
+  end_record(log, CONNMAN_CHANGELOG_TECHNOLOGY_CHANGED);
+}
+
+void connman_changelog_technology_removed(ConnmanChangelog *log,
+                                          const gchar *path)
+{
+  guint id;
+
+  g_return_if_fail(log != NULL);
+
+  if (log->failed)
+    return;
+
+  id = intern_path(log, path);
+
+  begin_record(log);
+  put_varint(log->record, id);
+  end_record(log, CONNMAN_CHANGELOG_TECHNOLOGY_REMOVED);
+
+  g_hash_table_remove(log->paths, path);
+}
+
+void connman_changelog_manager_state(ConnmanChangelog *log,
+                                     gboolean online)
+{
+  g_return_if_fail(log != NULL);
+
+  if (log->failed)
+    return;
+
+  begin_record(log);
+  put_varint(log->record, online);
+  end_record(log, CONNMAN_CHANGELOG_MANAGER_STATE);
+}
+
+void connman_changelog_state_changed(ConnmanChangelog *log,
+                                     const gchar *state)
+{
+  g_return_if_fail(log != NULL);
+
+  if (log->failed)
+    return;
+
+  begin_record(log);
+  put_string(log->record, state);
+  end_record(log, CONNMAN_CHANGELOG_STATE_CHANGED);
+}
+
+static gboolean changelog_writable(GIOChannel *channel,
+                                   GIOCondition condition,
+                                   gpointer user_data)
+{
+  ConnmanChangelog *log = user_data;
+
+  g_source_unref(log->watch);
+  log->watch = NULL;
+
+  connman_changelog_flush(log);
+
+  return FALSE;
+}
+
+/* wait for the consumer to drain the fd, then write the rest */
+static void changelog_watch(ConnmanChangelog *log)
+{
+  GIOChannel *channel;
+
+  if (log->watch)
+    return;
+
+  channel = g_io_channel_unix_new(log->fd);
+  log->watch = g_io_create_watch(channel, G_IO_OUT | G_IO_ERR | G_IO_HUP);
+  g_source_set_callback(log->watch, (GSourceFunc) changelog_writable, log, NULL);
+  g_source_attach(log->watch, log->context);
+  g_io_channel_unref(channel);
+}
+
+/*
+ * Write out the buffered records. What a non-blocking fd does not take
+ * stays buffered and is written once the fd becomes writable. Returns
+ * FALSE once the stream is broken.
+ */
+gboolean connman_changelog_flush(ConnmanChangelog *log)
+{
+  gsize done = 0;
+
+  g_return_val_if_fail(log != NULL, FALSE);
+
+  if (log->failed)
+    return FALSE;
+
+  while (done < log->buf->len)
+    {
+      gssize ret = write(log->fd, log->buf->data + done, log->buf->len - done);
+
+      if (ret < 0)
+        {
+          if (errno == EINTR)
+            continue;
+
+          if (errno == EAGAIN || errno == EWOULDBLOCK)
+            break;
+
+          /* a broken stream can not be resynced, stop logging */
+          g_warning("Change log write failed: %s", g_strerror(errno));
+          log->failed = TRUE;
+          done = log->buf->len;
+          break;
+        }
+
+      done += ret;
+    }
+
+  g_byte_array_remove_range(log->buf, 0, done);
+
+  if (log->buf->len > CHANGELOG_MAX_BUFFERED)
+    {
+      g_warning("Change log consumer stalled, %u bytes pending", log->buf->len);
+      log->failed = TRUE;
+      g_byte_array_set_size(log->buf, 0);
+    }
+  else if (log->buf->len > 0)
+    {
+      changelog_watch(log);
+    }
+
+  return !log->failed;
+}
@@ -0,0 +1,48 @@
+#ifndef CONNMAN_CHANGELOG_H_
+#define CONNMAN_CHANGELOG_H_
+
+#include <glib.h>
+#include "connman-service.h"
+
+G_BEGIN_DECLS
+
+typedef struct _ConnmanChangelog ConnmanChangelog;
+
+/* record types of the change log stream */
+enum {
+  CONNMAN_CHANGELOG_PATH = 1,           /* id, path */
+  CONNMAN_CHANGELOG_SERVICE_ADDED,      /* id, field mask, values */
+  CONNMAN_CHANGELOG_SERVICE_REMOVED,    /* id */
+  CONNMAN_CHANGELOG_SERVICE_CHANGED,    /* id, field mask, values */
+  CONNMAN_CHANGELOG_TECHNOLOGY_CHANGED, /* id, type */
+  CONNMAN_CHANGELOG_MANAGER_STATE,      /* online */
+  CONNMAN_CHANGELOG_TECHNOLOGY_REMOVED, /* id */
+  CONNMAN_CHANGELOG_STATE_CHANGED       /* state */
+};
+
+ConnmanChangelog *connman_changelog_new(int fd,
+                                        GMainContext *context);
+void connman_changelog_free(ConnmanChangelog *log);
+
+void connman_changelog_service_added(ConnmanChangelog *log,
+                                     ConnmanService *service);
+void connman_changelog_service_removed(ConnmanChangelog *log,
+                                       ConnmanService *service);
+void connman_changelog_service_changed(ConnmanChangelog *log,
+                                       ConnmanService *service,
+                                       guint fields);
+void connman_changelog_technology_changed(ConnmanChangelog *log,
+                                          const gchar *path,
+                                          const gchar *type);
+void connman_changelog_technology_removed(ConnmanChangelog *log,
+                                          const gchar *path);
+void connman_changelog_manager_state(ConnmanChangelog *log,
+                                     gboolean online);
+void connman_changelog_state_changed(ConnmanChangelog *log,
+                                     const gchar *state);
+gboolean connman_changelog_flush(ConnmanChangelog *log);
+
+G_END_DECLS
+
+
+#endif /* CONNMAN_CHANGELOG_H_ */
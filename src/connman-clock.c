@@ -0,0 +1,331 @@
+/*
+ *  Connection Clock example
+ *
+ *  Copyright (C) 2011  Daniel Mack <daniel@zonque.org>
+ *
+ *  This program is free software; you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License version 2 as
+ *  published by the Free Software Foundation.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program; if not, write to the Free Software
+ *  Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+
+
+#include <glib.h>
+#include <gio/gio.h>
+
+#include "connman-clock.h"
+#include "connman-error.h"
+#include "connman-generated.h"
+#include "connman-log.h"
+#include "connman-stats.h"
+
+/*
+ * Cached view of net.connman.Clock. The properties are fetched once
+ * and kept current through PropertyChanged, so reads never touch the
+ * bus. Time is extrapolated from the last report with the monotonic
+ * clock.
+ */
+struct _ConnmanClock {
+  GObject parent;
+
+  ConnmanProxyClock *proxy;
+
+  guint64 time;                 /* seconds since the epoch, as last reported */
+  gint64 time_stamp;            /* monotonic time of that report */
+  gchar *time_updates;          /* "manual" or "auto" */
+  gchar *timezone;
+  gchar *timezone_updates;      /* "manual" or "auto" */
+  gchar **timeservers;
+};
+
+static GObjectClass *parent_class = NULL;
+
+enum {
+  SIGNAL_CHANGED,
+  SIGNAL_LAST
+};
+
+static gint signals[SIGNAL_LAST];
+
+static void
+connman_clock_get_property (GObject    *object,
+                            guint       property_id,
+                            GValue     *value,
+                            GParamSpec *pspec)
+{
+  switch (property_id)
+    {
+      default:
+        G_OBJECT_WARN_INVALID_PROPERTY_ID (object, property_id, pspec);
+    }
+}
+
+static void
+connman_clock_set_property (GObject      *object,
+                            guint         property_id,
+                            const GValue *value,
+                            GParamSpec   *pspec)
+{
+  switch (property_id)
+    {
+      default:
+        G_OBJECT_WARN_INVALID_PROPERTY_ID (object, property_id, pspec);
+    }
+}
+
+static void replace_string(gchar **field,
+                           GVariant *val)
+{
+  if (!g_variant_is_of_type(val, G_VARIANT_TYPE_STRING))
+    return;
+
+  g_free(*field);
+  *field = g_variant_dup_string(val, NULL);
+}
+
+/* store one property; returns FALSE for keys that are not modelled */
+static gboolean connman_clock_update_property(ConnmanClock *clock,
+                                              const gchar *key,
+                                              GVariant *val)
+{
+  if (g_str_equal(key, "Time"))
+    {
+      if (g_variant_is_of_type(val, G_VARIANT_TYPE_UINT64))
+        {
+          clock->time = g_variant_get_uint64(val);
+          clock->time_stamp = g_get_monotonic_time();
+        }
+    }
+  else if (g_str_equal(key, "TimeUpdates"))
+    replace_string(&clock->time_updates, val);
+  else if (g_str_equal(key, "Timezone"))
+    replace_string(&clock->timezone, val);
+  else if (g_str_equal(key, "TimezoneUpdates"))
+    replace_string(&clock->timezone_updates, val);
+  else if (g_str_equal(key, "Timeservers"))
+    {
+      if (g_variant_is_of_type(val, G_VARIANT_TYPE_STRING_ARRAY))
+        {
+          g_strfreev(clock->timeservers);
+          clock->timeservers = g_variant_dup_strv(val, NULL);
+        }
+    }
+  else
+    return FALSE;
+
+  return TRUE;
+}
+
+static void connman_clock_update(ConnmanClock *clock,
+                                 GVariant *props)
+{
+  GVariantIter iter;
+  const gchar *key;
+  GVariant *val;
+
+  g_variant_iter_init(&iter, props);
+  while (g_variant_iter_next(&iter, "{&sv}", &key, &val))
+    {
+      connman_clock_update_property(clock, key, val);
+      g_variant_unref(val);
+    }
+}
+
+static void
+clock_property_changed(ConnmanProxyClock *proxy,
+                       const gchar       *name,
+                       GVariant          *value,
+                       ConnmanClock      *clock)
+{
+  GVariant *v = g_variant_get_variant(value);
+
+  if (connman_clock_update_property(clock, name, v))
+    {
+      connman_debug(NULL, "clock property %s changed", name);
+      g_signal_emit(clock, signals[SIGNAL_CHANGED], 0, name);
+    }
+
+  g_variant_unref(v);
+}
+
+static void
+refresh_callback(GObject *source_object,
+                 GAsyncResult *res,
+                 gpointer user_data)
+{
+  ConnmanClock *clock = CONNMAN_CLOCK(user_data);
+  GError *error = NULL;
+  GVariant *props = NULL;
+
+  if (connman_proxy_clock_call_get_properties_finish(clock->proxy, &props, res, &error))
+    {
+      connman_clock_update(clock, props);
+      g_variant_unref(props);
+      g_signal_emit(clock, signals[SIGNAL_CHANGED], 0, NULL);
+    }
+  else
+    {
+      connman_message(NULL, "Unable to refresh clock: %s", error->message);
+      g_error_free(error);
+    }
+
+  g_object_unref(clock);
+}
+
+/* a restarted daemon may have changed anything, fetch it all again */
+static void
+clock_name_owner_changed(GObject *object,
+                         GParamSpec *pspec,
+                         gpointer user_data)
+{
+  ConnmanClock *clock = CONNMAN_CLOCK(user_data);
+  gchar *owner = g_dbus_proxy_get_name_owner(G_DBUS_PROXY(clock->proxy));
+
+  if (owner)
+    connman_proxy_clock_call_get_properties(clock->proxy, NULL, refresh_callback,
+                                            g_object_ref(clock));
+  g_free(owner);
+}
+
+/* current time as kept by ConnMan, in seconds since the epoch */
+guint64 connman_clock_get_time(ConnmanClock *clock)
+{
+  g_return_val_if_fail(CONNMAN_IS_CLOCK(clock), 0);
+
+  if (!clock->time_stamp)
+    return 0;
+
+  return clock->time + (g_get_monotonic_time() - clock->time_stamp) / G_USEC_PER_SEC;
+}
+
+const gchar *connman_clock_get_time_updates(ConnmanClock *clock)
+{
+  g_return_val_if_fail(CONNMAN_IS_CLOCK(clock), NULL);
+  return clock->time_updates;
+}
+
+const gchar *connman_clock_get_timezone(ConnmanClock *clock)
+{
+  g_return_val_if_fail(CONNMAN_IS_CLOCK(clock), NULL);
+  return clock->timezone;
+}
+
+const gchar *connman_clock_get_timezone_updates(ConnmanClock *clock)
+{
+  g_return_val_if_fail(CONNMAN_IS_CLOCK(clock), NULL);
+  return clock->timezone_updates;
+}
+
+const gchar * const *connman_clock_get_timeservers(ConnmanClock *clock)
+{
+  g_return_val_if_fail(CONNMAN_IS_CLOCK(clock), NULL);
+  return (const gchar * const *) clock->timeservers;
+}
+
+ConnmanClock *connman_clock_new(GBusType bus_type,
+                                GError **error)
+{
+  ConnmanClock *clock = g_object_new(CONNMAN_TYPE_CLOCK, NULL);
+  GError *local_error = NULL;
+  GVariant *props = NULL;
+  guint attempt = 0;
+  gint64 start;
+
+  clock->proxy = connman_proxy_clock_proxy_new_for_bus_sync(bus_type,
+                                                            G_DBUS_PROXY_FLAGS_NONE,
+                                                            "net.connman", "/",
+                                                            NULL, /* cancelable */
+                                                            error);
+  if (!clock->proxy)
+    {
+      g_object_unref(clock);
+      return NULL;
+    }
+
+  /* subscribe first, so nothing is lost between fetch and signal */
+  g_signal_connect(G_OBJECT(clock->proxy), "property-changed",
+                   G_CALLBACK(clock_property_changed), clock);
+  g_signal_connect(G_OBJECT(clock->proxy), "notify::g-name-owner",
+                   G_CALLBACK(clock_name_owner_changed), clock);
+
+  do
+    {
+      start = connman_stats_begin();
+      connman_proxy_clock_call_get_properties_sync(clock->proxy, &props, NULL, &local_error);
+      connman_stats_end(CONNMAN_STATS_CLOCK_GET_PROPERTIES, start, local_error != NULL);
+    }
+  while (connman_error_retry(&local_error, &attempt));
+
+  if (local_error)
+    {
+      g_propagate_error(error, local_error);
+      g_object_unref(clock);
+      return NULL;
+    }
+
+  connman_clock_update(clock, props);
+  g_variant_unref(props);
+
+  connman_debug(NULL, "new clock %p: timezone '%s', time updates '%s'",
+                clock, clock->timezone, clock->time_updates);
+
+  return clock;
+}
+
+static void
+connman_clock_init (ConnmanClock *clock)
+{
+}
+
+static void
+connman_clock_finalize (GObject *object)
+{
+  ConnmanClock *clock = CONNMAN_CLOCK(object);
+
+  if (clock->proxy)
+    {
+      g_signal_handlers_disconnect_matched(clock->proxy, G_SIGNAL_MATCH_DATA,
+                                           0, 0, NULL, NULL, clock);
+      g_object_unref(clock->proxy);
+    }
+
+  g_free(clock->time_updates);
+  g_free(clock->timezone);
+  g_free(clock->timezone_updates);
+  g_strfreev(clock->timeservers);
+
+  G_OBJECT_CLASS (parent_class)->finalize (object);
+}
+
+static void
+connman_clock_class_init (ConnmanClockClass *klass)
+{
+  GObjectClass *object_class;
+
+  parent_class = (GObjectClass *) g_type_class_peek_parent (klass);
+  object_class = (GObjectClass *) klass;
+
+  object_class->get_property = connman_clock_get_property;
+  object_class->set_property = connman_clock_set_property;
+  object_class->finalize = connman_clock_finalize;
+
+  /* carries the property name, or NULL after a full refresh */
+  signals[SIGNAL_CHANGED] =
+    g_signal_new("changed",
+                 G_TYPE_FROM_CLASS(klass),
+                 G_SIGNAL_RUN_LAST,
+                 0, NULL, NULL,
+                 g_cclosure_marshal_VOID__STRING,
+                 G_TYPE_NONE, 1, G_TYPE_STRING);
+}
+
+G_DEFINE_TYPE (ConnmanClock, connman_clock, G_TYPE_OBJECT)
+
@@ -0,0 +1,41 @@
+#ifndef CONNMAN_CLOCK_H_
+#define CONNMAN_CLOCK_H_
+
+#include <gio/gio.h>
+#include <glib-object.h>
+
+G_BEGIN_DECLS
+
+typedef struct _ConnmanClock      ConnmanClock;
+typedef struct _ConnmanClockClass ConnmanClockClass;
+
+struct _ConnmanClockClass {
+  GObjectClass parent_class;
+};
+
+guint64 connman_clock_get_time(ConnmanClock *clock);
+const gchar *connman_clock_get_time_updates(ConnmanClock *clock);
+const gchar *connman_clock_get_timezone(ConnmanClock *clock);
+const gchar *connman_clock_get_timezone_updates(ConnmanClock *clock);
+const gchar * const *connman_clock_get_timeservers(ConnmanClock *clock);
+
+/*
+ * Fetches the clock properties synchronously. Unless called from a
+ * running main loop, a ConnMan that does not own its name yet is given
+ * up to 700ms of blocking retries.
+ */
+ConnmanClock *connman_clock_new(GBusType bus_type,
+                                GError **error);
+
+GType connman_clock_get_type (void);
+#define CONNMAN_TYPE_CLOCK             connman_clock_get_type()
+#define CONNMAN_CLOCK(obj)             (G_TYPE_CHECK_INSTANCE_CAST ((obj), CONNMAN_TYPE_CLOCK, ConnmanClock))
+#define CONNMAN_CLOCK_CLASS(klass)     (G_TYPE_CHECK_CLASS_CAST ((klass), CONNMAN_TYPE_CLOCK, ConnmanClockClass))
+#define CONNMAN_IS_CLOCK(obj)          (G_TYPE_CHECK_INSTANCE_TYPE ((obj), CONNMAN_TYPE_CLOCK))
+#define CONNMAN_IS_CLOCK_CLASS(klass)  (G_TYPE_CHECK_CLASS_TYPE ((klass), CONNMAN_TYPE_CLOCK))
+#define CONNMAN_CLOCK_GET_CLASS(obj)   (G_TYPE_INSTANCE_GET_CLASS ((obj), CONNMAN_TYPE_CLOCK, ConnmanClockClass))
+
+G_END_DECLS
+
+
+#endif /* CONNMAN_CLOCK_H_ */
@@ -0,0 +1,451 @@
+/*
+ *  Connection Counter example
+ *
+ *  Copyright (C) 2011  Daniel Mack <daniel@zonque.org>
+ *
+ *  This program is free software; you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License version 2 as
+ *  published by the Free Software Foundation.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program; if not, write to the Free Software
+ *  Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+
+
+#include <string.h>
+
+#include <glib.h>
+#include <gio/gio.h>
+
+#include "connman-counter.h"
+#include "connman-export.h"
+#include "connman-generated.h"
+#include "connman-log.h"
+#include "connman-seqlock.h"
+
+/* weight of a new sample in the smoothed rates, as a shift */
+#define RATE_SMOOTHING 2
+
+/*
+ * One row of the usage table. Rows are claimed by the main loop only
+ * and never move, but a row whose service went away is reused for the
+ * next one. Path and usage are therefore both guarded by a sequence
+ * lock, odd while the main loop writes them. A free row has an empty
+ * path.
+ */
+typedef struct {
+  gint seq;
+  gchar path[CONNMAN_COUNTER_PATH_LEN];
+  ConnmanCounterUsage usage;
+} CounterSlot;
+
+/*
+ * In-process net.connman.Counter. ConnMan reports traffic of the
+ * connected services to it; the totals and rates end up in a table
+ * that other threads read without taking locks.
+ */
+struct _ConnmanCounter {
+  GObject parent;
+
+  ConnmanExport *export;        /* only ConnMan may report usage */
+  GDBusConnection *connection;
+  gchar *object_path;
+
+  CounterSlot *slots;
+  guint max_slots;
+  gint n_slots;                 /* published rows, read atomically */
+  gint n_services;              /* rows in use, read atomically */
+  GHashTable *index;            /* service path -> CounterSlot, main loop only */
+  GSList *free_slots;           /* released rows, main loop only */
+  gboolean full_warned;
+};
+
+static GObjectClass *parent_class = NULL;
+
+enum {
+  SIGNAL_RELEASED,
+  SIGNAL_LAST
+};
+
+static gint signals[SIGNAL_LAST];
+
+static void
+connman_counter_get_property (GObject    *object,
+                              guint       property_id,
+                              GValue     *value,
+                              GParamSpec *pspec)
+{
+  switch (property_id)
+    {
+      default:
+        G_OBJECT_WARN_INVALID_PROPERTY_ID (object, property_id, pspec);
+    }
+}
+
+static void
+connman_counter_set_property (GObject      *object,
+                              guint         property_id,
+                              const GValue *value,
+                              GParamSpec   *pspec)
+{
+  switch (property_id)
+    {
+      default:
+        G_OBJECT_WARN_INVALID_PROPERTY_ID (object, property_id, pspec);
+    }
+}
+
+static CounterSlot *
+counter_claim_slot(ConnmanCounter *counter,
+                   const gchar *service_path)
+{
+  CounterSlot *slot = g_hash_table_lookup(counter->index, service_path);
+
+  if (slot)
+    return slot;
+
+  if (counter->free_slots)
+    {
+      slot = counter->free_slots->data;
+      counter->free_slots = g_slist_delete_link(counter->free_slots,
+                                                counter->free_slots);
+
+      connman_seqlock_write_begin(&slot->seq);
+      g_strlcpy(slot->path, service_path, sizeof(slot->path));
+      memset(&slot->usage, 0, sizeof(slot->usage));
+      connman_seqlock_write_end(&slot->seq);
+    }
+  else if ((guint) counter->n_slots < counter->max_slots)
+    {
+      slot = &counter->slots[counter->n_slots];
+      g_strlcpy(slot->path, service_path, sizeof(slot->path));
+
+      /* the row becomes visible to readers only after its path is written */
+      g_atomic_int_inc(&counter->n_slots);
+    }
+  else
+    {
+      return NULL;
+    }
+
+  g_hash_table_insert(counter->index, g_strdup(service_path), slot);
+  g_atomic_int_inc(&counter->n_services);
+
+  return slot;
+}
+
+/* ConnMan only sends the values that changed since the last callback */
+static void
+counter_apply(ConnmanCounterStats *stats,
+              GVariant *dict)
+{
+  GVariantIter iter;
+  GVariant *value;
+  const gchar *key;
+
+  g_variant_iter_init(&iter, dict);
+
+  while (g_variant_iter_loop(&iter, "{&sv}", &key, &value))
+    {
+      guint64 v;
+
+      if (!g_variant_is_of_type(value, G_VARIANT_TYPE_UINT32))
+        continue;
+
+      v = g_variant_get_uint32(value);
+
+      if (g_str_equal(key, "RX.Bytes"))
+        stats->rx_bytes = v;
+      else if (g_str_equal(key, "TX.Bytes"))
+        stats->tx_bytes = v;
+      else if (g_str_equal(key, "RX.Packets"))
+        stats->rx_packets = v;
+      else if (g_str_equal(key, "TX.Packets"))
+        stats->tx_packets = v;
+      else if (g_str_equal(key, "RX.Errors"))
+        stats->rx_errors = v;
+      else if (g_str_equal(key, "TX.Errors"))
+        stats->tx_errors = v;
+      else if (g_str_equal(key, "RX.Dropped"))
+        stats->rx_dropped = v;
+      else if (g_str_equal(key, "TX.Dropped"))
+        stats->tx_dropped = v;
+      else if (g_str_equal(key, "Time"))
+        stats->time = v;
+    }
+}
+
+/* exponentially smoothed, so each callback costs O(1) */
+static guint64
+counter_rate(guint64 rate,
+             guint64 before,
+             guint64 after,
+             gint64 elapsed)
+{
+  guint64 sample;
+
+  if (after < before || elapsed <= 0)
+    return rate;
+
+  sample = (after - before) * G_USEC_PER_SEC / elapsed;
+
+  if (sample >= rate)
+    return rate + ((sample - rate) >> RATE_SMOOTHING);
+  else
+    return rate - ((rate - sample) >> RATE_SMOOTHING);
+}
+
+static gboolean
+handle_usage(ConnmanProxyCounter *skeleton,
+             GDBusMethodInvocation *invocation,
+             const gchar *service_path,
+             GVariant *home,
+             GVariant *roaming,
+             gpointer user_data)
+{
+  ConnmanCounter *counter = CONNMAN_COUNTER(user_data);
+  ConnmanCounterUsage *usage;
+  CounterSlot *slot;
+  guint64 rx_before, tx_before;
+  gint64 now = g_get_monotonic_time();
+
+  if (!connman_export_check_caller(counter->export, invocation))
+    return TRUE;
+
+  slot = counter_claim_slot(counter, service_path);
+  if (!slot)
+    {
+      if (!counter->full_warned)
+        g_warning("Counter %s: usage table full (%u rows), dropping samples",
+                  counter->object_path, counter->max_slots);
+      counter->full_warned = TRUE;
+      connman_debug(service_path, "usage table full, dropping sample");
+      connman_proxy_counter_complete_usage(skeleton, invocation);
+      return TRUE;
+    }
+
+  usage = &slot->usage;
+  rx_before = usage->home.rx_bytes + usage->roaming.rx_bytes;
+  tx_before = usage->home.tx_bytes + usage->roaming.tx_bytes;
+
+  connman_seqlock_write_begin(&slot->seq);
+
+  counter_apply(&usage->home, home);
+  counter_apply(&usage->roaming, roaming);
+
+  if (usage->updated)
+    {
+      usage->rx_rate = counter_rate(usage->rx_rate, rx_before,
+                                    usage->home.rx_bytes + usage->roaming.rx_bytes,
+                                    now - usage->updated);
+      usage->tx_rate = counter_rate(usage->tx_rate, tx_before,
+                                    usage->home.tx_bytes + usage->roaming.tx_bytes,
+                                    now - usage->updated);
+    }
+  usage->updated = now;
+
+  connman_seqlock_write_end(&slot->seq);
+
+  connman_proxy_counter_complete_usage(skeleton, invocation);
+
+  return TRUE;
+}
+
+static gboolean
+handle_release(ConnmanProxyCounter *skeleton,
+               GDBusMethodInvocation *invocation,
+               gpointer user_data)
+{
+  ConnmanCounter *counter = CONNMAN_COUNTER(user_data);
+
+  if (!connman_export_check_caller(counter->export, invocation))
+    return TRUE;
+
+  connman_info(counter->object_path, "released by ConnMan");
+  g_signal_emit(counter, signals[SIGNAL_RELEASED], 0);
+  connman_proxy_counter_complete_release(skeleton, invocation);
+
+  return TRUE;
+}
+
+/*
+ * Copy the usage of the service at @service_path. Safe to call from
+ * any thread while the main loop keeps updating the table. Returns
+ * FALSE if ConnMan never reported traffic for the service.
+ */
+gboolean connman_counter_lookup(ConnmanCounter *counter,
+                                const gchar *service_path,
+                                ConnmanCounterUsage *usage)
+{
+  gint i, n;
+
+  g_return_val_if_fail(CONNMAN_IS_COUNTER(counter), FALSE);
+  g_return_val_if_fail(service_path != NULL, FALSE);
+  g_return_val_if_fail(usage != NULL, FALSE);
+
+  n = g_atomic_int_get(&counter->n_slots);
+
+  for (i = 0; i < n; i++)
+    {
+      CounterSlot *slot = &counter->slots[i];
+      gboolean match = FALSE;
+      gint seq;
+
+      /* the row may be handed to another service while we look at it */
+      do
+        {
+          seq = connman_seqlock_read_begin(&slot->seq);
+          if (seq & 1)
+            continue;
+
+          match = strncmp(slot->path, service_path, sizeof(slot->path)) == 0;
+          if (match)
+            memcpy(usage, &slot->usage, sizeof(*usage));
+        }
+      while (connman_seqlock_read_retry(&slot->seq, seq));
+
+      if (match)
+        return TRUE;
+    }
+
+  return FALSE;
+}
+
+/*
+ * Drop the row of the service at @service_path, e.g. once ConnMan no
+ * longer lists the service, so the row can be reused by another one.
+ */
+void connman_counter_forget(ConnmanCounter *counter,
+                            const gchar *service_path)
+{
+  CounterSlot *slot;
+
+  g_return_if_fail(CONNMAN_IS_COUNTER(counter));
+  g_return_if_fail(service_path != NULL);
+
+  slot = g_hash_table_lookup(counter->index, service_path);
+  if (!slot)
+    return;
+
+  g_hash_table_remove(counter->index, service_path);
+
+  connman_seqlock_write_begin(&slot->seq);
+  slot->path[0] = '\0';
+  memset(&slot->usage, 0, sizeof(slot->usage));
+  connman_seqlock_write_end(&slot->seq);
+
+  counter->free_slots = g_slist_prepend(counter->free_slots, slot);
+  g_atomic_int_add(&counter->n_services, -1);
+  counter->full_warned = FALSE;
+}
+
+/* number of services with a row in the table */
+guint connman_counter_get_n_services(ConnmanCounter *counter)
+{
+  g_return_val_if_fail(CONNMAN_IS_COUNTER(counter), 0);
+  return g_atomic_int_get(&counter->n_services);
+}
+
+const gchar *connman_counter_get_object_path(ConnmanCounter *counter)
+{
+  g_return_val_if_fail(CONNMAN_IS_COUNTER(counter), NULL);
+  return counter->object_path;
+}
+
+/*
+ * Export a counter at @object_path, with room for @max_services
+ * services. Hand it to ConnMan with connman_manager_register_counter().
+ */
+ConnmanCounter *connman_counter_new(GBusType bus_type,
+                                    const gchar *object_path,
+                                    guint max_services,
+                                    GError **error)
+{
+  ConnmanCounter *counter = g_object_new(CONNMAN_TYPE_COUNTER, NULL);
+  ConnmanProxyCounter *skeleton;
+
+  counter->object_path = g_strdup(object_path);
+  counter->max_slots = max_services;
+  counter->slots = g_new0(CounterSlot, max_services);
+
+  counter->connection = g_bus_get_sync(bus_type, NULL, error);
+  if (!counter->connection)
+    {
+      g_object_unref(counter);
+      return NULL;
+    }
+
+  skeleton = connman_proxy_counter_skeleton_new();
+
+  g_signal_connect(skeleton, "handle-usage",
+                   G_CALLBACK(handle_usage), counter);
+  g_signal_connect(skeleton, "handle-release",
+                   G_CALLBACK(handle_release), counter);
+
+  counter->export = connman_export_new(counter->connection,
+                                       G_DBUS_INTERFACE_SKELETON(skeleton),
+                                       object_path, "counter", counter, error);
+  if (!counter->export)
+    {
+      g_object_unref(counter);
+      return NULL;
+    }
+
+  connman_debug(object_path, "new counter %p, %u rows", counter, max_services);
+
+  return counter;
+}
+
+static void
+connman_counter_init (ConnmanCounter *counter)
+{
+  counter->index = g_hash_table_new_full(g_str_hash, g_str_equal, g_free, NULL);
+}
+
+static void
+connman_counter_finalize (GObject *object)
+{
+  ConnmanCounter *counter = CONNMAN_COUNTER(object);
+
+  connman_export_free(counter->export);
+
+  if (counter->connection)
+    g_object_unref(counter->connection);
+
+  g_hash_table_destroy(counter->index);
+  g_slist_free(counter->free_slots);
+  g_free(counter->slots);
+  g_free(counter->object_path);
+
+  G_OBJECT_CLASS (parent_class)->finalize (object);
+}
+
+static void
+connman_counter_class_init (ConnmanCounterClass *klass)
+{
+  GObjectClass *object_class;
+
+  parent_class = (GObjectClass *) g_type_class_peek_parent (klass);
+  object_class = (GObjectClass *) klass;
+
+  object_class->get_property = connman_counter_get_property;
+  object_class->set_property = connman_counter_set_property;
+  object_class->finalize = connman_counter_finalize;
+
+  signals[SIGNAL_RELEASED] =
+    g_signal_new("released",
+                 G_TYPE_FROM_CLASS(klass),
+                 G_SIGNAL_RUN_LAST,
+                 0, NULL, NULL,
+                 g_cclosure_marshal_VOID__VOID,
+                 G_TYPE_NONE, 0);
+}
+
+G_DEFINE_TYPE (ConnmanCounter, connman_counter, G_TYPE_OBJECT)
+
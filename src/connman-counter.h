@@ -0,0 +1,63 @@
+#ifndef CONNMAN_COUNTER_H_
+#define CONNMAN_COUNTER_H_
+
+#include <gio/gio.h>
+#include <glib-object.h>
+
+G_BEGIN_DECLS
+
+typedef struct _ConnmanCounter      ConnmanCounter;
+typedef struct _ConnmanCounterClass ConnmanCounterClass;
+
+#define CONNMAN_COUNTER_PATH_LEN 128
+
+/* totals as reported by ConnMan, for either home or roaming networks */
+typedef struct {
+  guint64 rx_bytes;
+  guint64 tx_bytes;
+  guint64 rx_packets;
+  guint64 tx_packets;
+  guint64 rx_errors;
+  guint64 tx_errors;
+  guint64 rx_dropped;
+  guint64 tx_dropped;
+  guint32 time;                 /* seconds connected */
+} ConnmanCounterStats;
+
+typedef struct {
+  ConnmanCounterStats home;
+  ConnmanCounterStats roaming;
+  guint64 rx_rate;              /* bytes/s, smoothed over Usage callbacks */
+  guint64 tx_rate;
+  gint64 updated;               /* monotonic time of the last Usage */
+} ConnmanCounterUsage;
+
+struct _ConnmanCounterClass {
+  GObjectClass parent_class;
+};
+
+gboolean connman_counter_lookup(ConnmanCounter *counter,
+                                const gchar *service_path,
+                                ConnmanCounterUsage *usage);
+void connman_counter_forget(ConnmanCounter *counter,
+                            const gchar *service_path);
+guint connman_counter_get_n_services(ConnmanCounter *counter);
+const gchar *connman_counter_get_object_path(ConnmanCounter *counter);
+
+ConnmanCounter *connman_counter_new(GBusType bus_type,
+                                    const gchar *object_path,
+                                    guint max_services,
+                                    GError **error);
+
+GType connman_counter_get_type (void);
+#define CONNMAN_TYPE_COUNTER             connman_counter_get_type()
+#define CONNMAN_COUNTER(obj)             (G_TYPE_CHECK_INSTANCE_CAST ((obj), CONNMAN_TYPE_COUNTER, ConnmanCounter))
+#define CONNMAN_COUNTER_CLASS(klass)     (G_TYPE_CHECK_CLASS_CAST ((klass), CONNMAN_TYPE_COUNTER, ConnmanCounterClass))
+#define CONNMAN_IS_COUNTER(obj)          (G_TYPE_CHECK_INSTANCE_TYPE ((obj), CONNMAN_TYPE_COUNTER))
+#define CONNMAN_IS_COUNTER_CLASS(klass)  (G_TYPE_CHECK_CLASS_TYPE ((klass), CONNMAN_TYPE_COUNTER))
+#define CONNMAN_COUNTER_GET_CLASS(obj)   (G_TYPE_INSTANCE_GET_CLASS ((obj), CONNMAN_TYPE_COUNTER, ConnmanCounterClass))
+
+G_END_DECLS
+
+
+#endif /* CONNMAN_COUNTER_H_ */
@@ -0,0 +1,115 @@
+/*
+ *  Connection Manager example
+ *
+ *  Copyright (C) 2011  Daniel Mack <daniel@zonque.org>
+ *
+ *  This program is free software; you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License version 2 as
+ *  published by the Free Software Foundation.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program; if not, write to the Free Software
+ *  Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+
+#include <glib.h>
+#include <gio/gio.h>
+
+#include "connman-error.h"
+#include "connman-log.h"
+
+/* blocking retries of synchronous calls: 100, 200, 400ms */
+#define SYNC_ATTEMPTS   4
+#define SYNC_BASE_DELAY 100 /* ms */
+
+/* retries from the main loop back off up to this */
+#define MAX_DELAY       30000 /* ms */
+
+/*
+ * TRUE for failures that are expected to go away by themselves: bus
+ * timeouts, and ConnMan being (re)started and not owning its name yet.
+ */
+gboolean connman_error_is_transient(const GError *error)
+{
+  if (!error)
+    return FALSE;
+
+  if (error->domain == G_IO_ERROR)
+    return error->code == G_IO_ERROR_TIMED_OUT;
+
+  if (error->domain == G_DBUS_ERROR)
+    return error->code == G_DBUS_ERROR_NO_REPLY ||
+           error->code == G_DBUS_ERROR_TIMEOUT ||
+           error->code == G_DBUS_ERROR_TIMED_OUT ||
+           error->code == G_DBUS_ERROR_NAME_HAS_NO_OWNER ||
+           error->code == G_DBUS_ERROR_SERVICE_UNKNOWN;
+
+  return FALSE;
+}
+
+/* exponential backoff for the @attempt-th retry, in ms */
+guint connman_error_backoff_delay(guint attempt)
+{
+  return MIN(SYNC_BASE_DELAY << MIN(attempt, 16), MAX_DELAY);
+}
+
+/*
+ * TRUE for failures that only show up after the call timed out. These
+ * already cost a full D-Bus timeout, so they are never retried in a
+ * blocking loop; the main-loop retry with a GSource handles them.
+ */
+static gboolean connman_error_is_timeout(const GError *error)
+{
+  if (error->domain == G_IO_ERROR)
+    return error->code == G_IO_ERROR_TIMED_OUT;
+
+  if (error->domain == G_DBUS_ERROR)
+    return error->code == G_DBUS_ERROR_NO_REPLY ||
+           error->code == G_DBUS_ERROR_TIMEOUT ||
+           error->code == G_DBUS_ERROR_TIMED_OUT;
+
+  return FALSE;
+}
+
+/* TRUE while the calling thread is dispatching its main context */
+static gboolean connman_error_in_main_loop(void)
+{
+  GMainContext *context = g_main_context_get_thread_default();
+
+  if (!context)
+    context = g_main_context_default();
+
+  return g_main_context_is_owner(context);
+}
+
+/*
+ * Decide whether a synchronous call that failed with *@error should be
+ * repeated. Only failures that return at once, like ConnMan not owning
+ * its name yet, qualify. If so, the error is cleared and the backoff
+ * delay slept before returning TRUE; otherwise *@error is left for the
+ * caller.
+ *
+ * Sleeping would stall every other source, so a thread running its
+ * main loop is never retried here; the error goes back to the caller,
+ * which retries from a GSource instead.
+ */
+gboolean connman_error_retry(GError **error,
+                             guint *attempt)
+{
+  if (!*error || !connman_error_is_transient(*error) ||
+      connman_error_is_timeout(*error) ||
+      *attempt + 1 >= SYNC_ATTEMPTS ||
+      connman_error_in_main_loop())
+    return FALSE;
+
+  connman_message(NULL, "Transient D-Bus failure, retrying: %s", (*error)->message);
+  g_clear_error(error);
+  g_usleep(connman_error_backoff_delay((*attempt)++) * 1000);
+
+  return TRUE;
+}
@@ -0,0 +1,16 @@
+#ifndef CONNMAN_ERROR_H_
+#define CONNMAN_ERROR_H_
+
+#include <glib.h>
+
+G_BEGIN_DECLS
+
+gboolean connman_error_is_transient(const GError *error);
+guint connman_error_backoff_delay(guint attempt);
+gboolean connman_error_retry(GError **error,
+                             guint *attempt);
+
+G_END_DECLS
+
+
+#endif /* CONNMAN_ERROR_H_ */
@@ -0,0 +1,148 @@
+/*
+ *  Connection Manager object export helper
+ *
+ *  Copyright (C) 2011  Daniel Mack <daniel@zonque.org>
+ *
+ *  This program is free software; you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License version 2 as
+ *  published by the Free Software Foundation.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program; if not, write to the Free Software
+ *  Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+
+
+#include <glib.h>
+#include <gio/gio.h>
+
+#include "connman-export.h"
+#include "connman-log.h"
+
+/*
+ * A D-Bus object we export for ConnMan to call into: agent, counter or
+ * session notifier. Only the current owner of net.connman may call
+ * its methods.
+ */
+struct _ConnmanExport {
+  GDBusInterfaceSkeleton *skeleton;
+  gchar *object_path;
+  const gchar *what;            /* "agent", "counter", ... for messages */
+  gpointer handler_data;        /* user_data of the skeleton's handlers */
+
+  guint name_watch_id;
+  gchar *connman_owner;
+};
+
+static void
+connman_name_appeared(GDBusConnection *connection,
+                      const gchar *name,
+                      const gchar *name_owner,
+                      gpointer user_data)
+{
+  ConnmanExport *export = user_data;
+
+  g_free(export->connman_owner);
+  export->connman_owner = g_strdup(name_owner);
+}
+
+static void
+connman_name_vanished(GDBusConnection *connection,
+                      const gchar *name,
+                      gpointer user_data)
+{
+  ConnmanExport *export = user_data;
+
+  g_free(export->connman_owner);
+  export->connman_owner = NULL;
+}
+
+/*
+ * Export @skeleton at @object_path on @connection and start tracking
+ * the owner of net.connman. Takes over @skeleton, whose method
+ * handlers must have been connected with @handler_data; they are
+ * disconnected again by connman_export_free(). @what names the object
+ * in messages.
+ */
+ConnmanExport *connman_export_new(GDBusConnection *connection,
+                                  GDBusInterfaceSkeleton *skeleton,
+                                  const gchar *object_path,
+                                  const gchar *what,
+                                  gpointer handler_data,
+                                  GError **error)
+{
+  ConnmanExport *export;
+
+  g_return_val_if_fail(G_IS_DBUS_CONNECTION(connection), NULL);
+  g_return_val_if_fail(G_IS_DBUS_INTERFACE_SKELETON(skeleton), NULL);
+  g_return_val_if_fail(object_path != NULL, NULL);
+
+  export = g_slice_new0(ConnmanExport);
+  export->skeleton = skeleton;
+  export->object_path = g_strdup(object_path);
+  export->what = what;
+  export->handler_data = handler_data;
+
+  if (!g_dbus_interface_skeleton_export(skeleton, connection, object_path, error))
+    {
+      connman_export_free(export);
+      return NULL;
+    }
+
+  export->name_watch_id =
+    g_bus_watch_name_on_connection(connection, "net.connman",
+                                   G_BUS_NAME_WATCHER_FLAGS_NONE,
+                                   connman_name_appeared,
+                                   connman_name_vanished,
+                                   export, NULL);
+
+  return export;
+}
+
+/*
+ * TRUE if @invocation comes from ConnMan. Otherwise it is answered
+ * with AccessDenied and must not be completed again.
+ */
+gboolean connman_export_check_caller(ConnmanExport *export,
+                                     GDBusMethodInvocation *invocation)
+{
+  const gchar *sender = g_dbus_method_invocation_get_sender(invocation);
+  gchar *message;
+
+  if (export->connman_owner && g_strcmp0(sender, export->connman_owner) == 0)
+    return TRUE;
+
+  connman_message(export->object_path, "rejecting %s call from %s", export->what, sender);
+
+  message = g_strdup_printf("Only net.connman may use this %s", export->what);
+  g_dbus_method_invocation_return_dbus_error(invocation,
+                                             "org.freedesktop.DBus.Error.AccessDenied",
+                                             message);
+  g_free(message);
+
+  return FALSE;
+}
+
+void connman_export_free(ConnmanExport *export)
+{
+  if (!export)
+    return;
+
+  if (export->name_watch_id)
+    g_bus_unwatch_name(export->name_watch_id);
+
+  g_signal_handlers_disconnect_matched(export->skeleton, G_SIGNAL_MATCH_DATA,
+                                       0, 0, NULL, NULL, export->handler_data);
+  if (g_dbus_interface_skeleton_get_connection(export->skeleton))
+    g_dbus_interface_skeleton_unexport(export->skeleton);
+  g_object_unref(export->skeleton);
+
+  g_free(export->connman_owner);
+  g_free(export->object_path);
+  g_slice_free(ConnmanExport, export);
+}
@@ -0,0 +1,23 @@
+#ifndef CONNMAN_EXPORT_H_
+#define CONNMAN_EXPORT_H_
+
+#include <gio/gio.h>
+
+G_BEGIN_DECLS
+
+typedef struct _ConnmanExport ConnmanExport;
+
+ConnmanExport *connman_export_new(GDBusConnection *connection,
+                                  GDBusInterfaceSkeleton *skeleton,
+                                  const gchar *object_path,
+                                  const gchar *what,
+                                  gpointer handler_data,
+                                  GError **error);
+gboolean connman_export_check_caller(ConnmanExport *export,
+                                     GDBusMethodInvocation *invocation);
+void connman_export_free(ConnmanExport *export);
+
+G_END_DECLS
+
+
+#endif /* CONNMAN_EXPORT_H_ */
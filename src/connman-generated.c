@@ -7848,3 +7848,7225 @@ connman_proxy_technology_skeleton_new (void)
   return CONNMAN_PROXY_TECHNOLOGY (g_object_new (CONNMAN_PROXY_TYPE_TECHNOLOGY_SKELETON, NULL));
 }
 
+/* ------------------------------------------------------------------------
+ * Code for interface net.connman.Agent
+ * ------------------------------------------------------------------------
+ */
+
+/**
+ * SECTION:ConnmanProxyAgent
+ * @title: ConnmanProxyAgent
+ * @short_description: Generated C code for the net.connman.Agent D-Bus interface
+ *
+ * This section contains code for working with the <link linkend="gdbus-interface-net-connman-Agent.top_of_page">net.connman.Agent</link> D-Bus interface in C.
+ */
+
+/* ---- Introspection data for net.connman.Agent ---- */
+
+static const _ExtendedGDBusMethodInfo _connman_proxy_agent_method_info_release =
+{
+  {
+    -1,
+    "Release",
+    NULL,
+    NULL,
+    NULL
+  },
+  "handle-release",
+  FALSE
+};
+
+static const _ExtendedGDBusArgInfo _connman_proxy_agent_method_info_report_error_IN_ARG_unnamed_arg0 =
+{
+  {
+    -1,
+    "unnamed_arg0",
+    "o",
+    NULL
+  },
+  FALSE
+};
+
+static const _ExtendedGDBusArgInfo _connman_proxy_agent_method_info_report_error_IN_ARG_unnamed_arg1 =
+{
+  {
+    -1,
+    "unnamed_arg1",
+    "s",
+    NULL
+  },
+  FALSE
+};
+
+static const _ExtendedGDBusArgInfo * const _connman_proxy_agent_method_info_report_error_IN_ARG_pointers[] =
+{
+  &_connman_proxy_agent_method_info_report_error_IN_ARG_unnamed_arg0,
+  &_connman_proxy_agent_method_info_report_error_IN_ARG_unnamed_arg1,
+  NULL
+};
+
+static const _ExtendedGDBusMethodInfo _connman_proxy_agent_method_info_report_error =
+{
+  {
+    -1,
+    "ReportError",
+    (GDBusArgInfo **) &_connman_proxy_agent_method_info_report_error_IN_ARG_pointers,
+    NULL,
+    NULL
+  },
+  "handle-report-error",
+  FALSE
+};
+
+static const _ExtendedGDBusArgInfo _connman_proxy_agent_method_info_request_browser_IN_ARG_unnamed_arg0 =
+{
+  {
+    -1,
+    "unnamed_arg0",
+    "o",
+    NULL
+  },
+  FALSE
+};
+
+static const _ExtendedGDBusArgInfo _connman_proxy_agent_method_info_request_browser_IN_ARG_unnamed_arg1 =
+{
+  {
+    -1,
+    "unnamed_arg1",
+    "s",
+    NULL
+  },
+  FALSE
+};
+
+static const _ExtendedGDBusArgInfo * const _connman_proxy_agent_method_info_request_browser_IN_ARG_pointers[] =
+{
+  &_connman_proxy_agent_method_info_request_browser_IN_ARG_unnamed_arg0,
+  &_connman_proxy_agent_method_info_request_browser_IN_ARG_unnamed_arg1,
+  NULL
+};
+
+static const _ExtendedGDBusMethodInfo _connman_proxy_agent_method_info_request_browser =
+{
+  {
+    -1,
+    "RequestBrowser",
+    (GDBusArgInfo **) &_connman_proxy_agent_method_info_request_browser_IN_ARG_pointers,
+    NULL,
+    NULL
+  },
+  "handle-request-browser",
+  FALSE
+};
+
+static const _ExtendedGDBusArgInfo _connman_proxy_agent_method_info_request_input_IN_ARG_unnamed_arg0 =
+{
+  {
+    -1,
+    "unnamed_arg0",
+    "o",
+    NULL
+  },
+  FALSE
+};
+
+static const _ExtendedGDBusArgInfo _connman_proxy_agent_method_info_request_input_IN_ARG_unnamed_arg1 =
+{
+  {
+    -1,
+    "unnamed_arg1",
+    "a{sv}",
+    NULL
+  },
+  FALSE
+};
+
+static const _ExtendedGDBusArgInfo * const _connman_proxy_agent_method_info_request_input_IN_ARG_pointers[] =
+{
+  &_connman_proxy_agent_method_info_request_input_IN_ARG_unnamed_arg0,
+  &_connman_proxy_agent_method_info_request_input_IN_ARG_unnamed_arg1,
+  NULL
+};
+
+static const _ExtendedGDBusArgInfo _connman_proxy_agent_method_info_request_input_OUT_ARG_unnamed_arg2 =
+{
+  {
+    -1,
+    "unnamed_arg2",
+    "a{sv}",
+    NULL
+  },
+  FALSE
+};
+
+static const _ExtendedGDBusArgInfo * const _connman_proxy_agent_method_info_request_input_OUT_ARG_pointers[] =
+{
+  &_connman_proxy_agent_method_info_request_input_OUT_ARG_unnamed_arg2,
+  NULL
+};
+
+static const _ExtendedGDBusMethodInfo _connman_proxy_agent_method_info_request_input =
+{
+  {
+    -1,
+    "RequestInput",
+    (GDBusArgInfo **) &_connman_proxy_agent_method_info_request_input_IN_ARG_pointers,
+    (GDBusArgInfo **) &_connman_proxy_agent_method_info_request_input_OUT_ARG_pointers,
+    NULL
+  },
+  "handle-request-input",
+  FALSE
+};
+
+static const _ExtendedGDBusMethodInfo _connman_proxy_agent_method_info_cancel =
+{
+  {
+    -1,
+    "Cancel",
+    NULL,
+    NULL,
+    NULL
+  },
+  "handle-cancel",
+  FALSE
+};
+
+static const _ExtendedGDBusMethodInfo * const _connman_proxy_agent_method_info_pointers[] =
+{
+  &_connman_proxy_agent_method_info_release,
+  &_connman_proxy_agent_method_info_report_error,
+  &_connman_proxy_agent_method_info_request_browser,
+  &_connman_proxy_agent_method_info_request_input,
+  &_connman_proxy_agent_method_info_cancel,
+  NULL
+};
+
+static const _ExtendedGDBusInterfaceInfo _connman_proxy_agent_interface_info =
+{
+  {
+    -1,
+    "net.connman.Agent",
+    (GDBusMethodInfo **) &_connman_proxy_agent_method_info_pointers,
+    NULL,
+    NULL,
+    NULL
+  },
+  "agent",
+};
+
+
+/**
+ * connman_proxy_agent_interface_info:
+ *
+ * Gets a machine-readable description of the <link linkend="gdbus-interface-net-connman-Agent.top_of_page">net.connman.Agent</link> D-Bus interface.
+ *
+ * Returns: (transfer none): A #GDBusInterfaceInfo. Do not free.
+ */
+GDBusInterfaceInfo *
+connman_proxy_agent_interface_info (void)
+{
+  return (GDBusInterfaceInfo *) &_connman_proxy_agent_interface_info;
+}
+
+/**
+ * connman_proxy_agent_override_properties:
+ * @klass: The class structure for a #GObject<!-- -->-derived class.
+ * @property_id_begin: The property id to assign to the first overridden property.
+ *
+ * Overrides all #GObject properties in the #ConnmanProxyAgent interface for a concrete class.
+ * The properties are overridden in the order they are defined.
+ *
+ * Returns: The last property id.
+ */
+guint
+connman_proxy_agent_override_properties (GObjectClass *klass, guint property_id_begin)
+{
+  return property_id_begin - 1;
+}
+
+
+
+/**
+ * ConnmanProxyAgent:
+ *
+ * Abstract interface type for the D-Bus interface <link linkend="gdbus-interface-net-connman-Agent.top_of_page">net.connman.Agent</link>.
+ */
+
+/**
+ * ConnmanProxyAgentIface:
+ * @parent_iface: The parent interface.
+ * @handle_cancel: Handler for the #ConnmanProxyAgent::handle-cancel signal.
+ * @handle_release: Handler for the #ConnmanProxyAgent::handle-release signal.
+ * @handle_report_error: Handler for the #ConnmanProxyAgent::handle-report-error signal.
+ * @handle_request_browser: Handler for the #ConnmanProxyAgent::handle-request-browser signal.
+ * @handle_request_input: Handler for the #ConnmanProxyAgent::handle-request-input signal.
+ *
+ * Virtual table for the D-Bus interface <link linkend="gdbus-interface-net-connman-Agent.top_of_page">net.connman.Agent</link>.
+ */
+
+static void
+connman_proxy_agent_default_init (ConnmanProxyAgentIface *iface)
+{
+  /* GObject signals for incoming D-Bus method calls: */
+  /**
+   * ConnmanProxyAgent::handle-release:
+   * @object: A #ConnmanProxyAgent.
+   * @invocation: A #GDBusMethodInvocation.
+   *
+   * Signal emitted when a remote caller is invoking the <link linkend="gdbus-method-net-connman-Agent.Release">Release()</link> D-Bus method.
+   *
+   * If a signal handler returns %TRUE, it means the signal handler will handle the invocation (e.g. take a reference to @invocation and eventually call connman_proxy_agent_complete_release() or e.g. g_dbus_method_invocation_return_error() on it) and no order signal handlers will run. If no signal handler handles the invocation, the %G_DBUS_ERROR_UNKNOWN_METHOD error is returned.
+   *
+   * Returns: %TRUE if the invocation was handled, %FALSE to let other signal handlers run.
+   */
+  g_signal_new ("handle-release",
+    G_TYPE_FROM_INTERFACE (iface),
+    G_SIGNAL_RUN_LAST,
+    G_STRUCT_OFFSET (ConnmanProxyAgentIface, handle_release),
+    g_signal_accumulator_true_handled,
+    NULL,
+    g_cclosure_marshal_generic,
+    G_TYPE_BOOLEAN,
+    1,
+    G_TYPE_DBUS_METHOD_INVOCATION);
+
+  /**
+   * ConnmanProxyAgent::handle-report-error:
+   * @object: A #ConnmanProxyAgent.
+   * @invocation: A #GDBusMethodInvocation.
+   * @arg_unnamed_arg0: Argument passed by remote caller.
+   * @arg_unnamed_arg1: Argument passed by remote caller.
+   *
+   * Signal emitted when a remote caller is invoking the <link linkend="gdbus-method-net-connman-Agent.ReportError">ReportError()</link> D-Bus method.
+   *
+   * If a signal handler returns %TRUE, it means the signal handler will handle the invocation (e.g. take a reference to @invocation and eventually call connman_proxy_agent_complete_report_error() or e.g. g_dbus_method_invocation_return_error() on it) and no order signal handlers will run. If no signal handler handles the invocation, the %G_DBUS_ERROR_UNKNOWN_METHOD error is returned.
+   *
+   * Returns: %TRUE if the invocation was handled, %FALSE to let other signal handlers run.
+   */
+  g_signal_new ("handle-report-error",
+    G_TYPE_FROM_INTERFACE (iface),
+    G_SIGNAL_RUN_LAST,
+    G_STRUCT_OFFSET (ConnmanProxyAgentIface, handle_report_error),
+    g_signal_accumulator_true_handled,
+    NULL,
+    g_cclosure_marshal_generic,
+    G_TYPE_BOOLEAN,
+    3,
+    G_TYPE_DBUS_METHOD_INVOCATION, G_TYPE_STRING, G_TYPE_STRING);
+
+  /**
+   * ConnmanProxyAgent::handle-request-browser:
+   * @object: A #ConnmanProxyAgent.
+   * @invocation: A #GDBusMethodInvocation.
+   * @arg_unnamed_arg0: Argument passed by remote caller.
+   * @arg_unnamed_arg1: Argument passed by remote caller.
+   *
+   * Signal emitted when a remote caller is invoking the <link linkend="gdbus-method-net-connman-Agent.RequestBrowser">RequestBrowser()</link> D-Bus method.
+   *
+   * If a signal handler returns %TRUE, it means the signal handler will handle the invocation (e.g. take a reference to @invocation and eventually call connman_proxy_agent_complete_request_browser() or e.g. g_dbus_method_invocation_return_error() on it) and no order signal handlers will run. If no signal handler handles the invocation, the %G_DBUS_ERROR_UNKNOWN_METHOD error is returned.
+   *
+   * Returns: %TRUE if the invocation was handled, %FALSE to let other signal handlers run.
+   */
+  g_signal_new ("handle-request-browser",
+    G_TYPE_FROM_INTERFACE (iface),
+    G_SIGNAL_RUN_LAST,
+    G_STRUCT_OFFSET (ConnmanProxyAgentIface, handle_request_browser),
+    g_signal_accumulator_true_handled,
+    NULL,
+    g_cclosure_marshal_generic,
+    G_TYPE_BOOLEAN,
+    3,
+    G_TYPE_DBUS_METHOD_INVOCATION, G_TYPE_STRING, G_TYPE_STRING);
+
+  /**
+   * ConnmanProxyAgent::handle-request-input:
+   * @object: A #ConnmanProxyAgent.
+   * @invocation: A #GDBusMethodInvocation.
+   * @arg_unnamed_arg0: Argument passed by remote caller.
+   * @arg_unnamed_arg1: Argument passed by remote caller.
+   *
+   * Signal emitted when a remote caller is invoking the <link linkend="gdbus-method-net-connman-Agent.RequestInput">RequestInput()</link> D-Bus method.
+   *
+   * If a signal handler returns %TRUE, it means the signal handler will handle the invocation (e.g. take a reference to @invocation and eventually call connman_proxy_agent_complete_request_input() or e.g. g_dbus_method_invocation_return_error() on it) and no order signal handlers will run. If no signal handler handles the invocation, the %G_DBUS_ERROR_UNKNOWN_METHOD error is returned.
+   *
+   * Returns: %TRUE if the invocation was handled, %FALSE to let other signal handlers run.
+   */
+  g_signal_new ("handle-request-input",
+    G_TYPE_FROM_INTERFACE (iface),
+    G_SIGNAL_RUN_LAST,
+    G_STRUCT_OFFSET (ConnmanProxyAgentIface, handle_request_input),
+    g_signal_accumulator_true_handled,
+    NULL,
+    g_cclosure_marshal_generic,
+    G_TYPE_BOOLEAN,
+    3,
+    G_TYPE_DBUS_METHOD_INVOCATION, G_TYPE_STRING, G_TYPE_VARIANT);
+
+  /**
+   * ConnmanProxyAgent::handle-cancel:
+   * @object: A #ConnmanProxyAgent.
+   * @invocation: A #GDBusMethodInvocation.
+   *
+   * Signal emitted when a remote caller is invoking the <link linkend="gdbus-method-net-connman-Agent.Cancel">Cancel()</link> D-Bus method.
+   *
+   * If a signal handler returns %TRUE, it means the signal handler will handle the invocation (e.g. take a reference to @invocation and eventually call connman_proxy_agent_complete_cancel() or e.g. g_dbus_method_invocation_return_error() on it) and no order signal handlers will run. If no signal handler handles the invocation, the %G_DBUS_ERROR_UNKNOWN_METHOD error is returned.
+   *
+   * Returns: %TRUE if the invocation was handled, %FALSE to let other signal handlers run.
+   */
+  g_signal_new ("handle-cancel",
+    G_TYPE_FROM_INTERFACE (iface),
+    G_SIGNAL_RUN_LAST,
+    G_STRUCT_OFFSET (ConnmanProxyAgentIface, handle_cancel),
+    g_signal_accumulator_true_handled,
+    NULL,
+    g_cclosure_marshal_generic,
+    G_TYPE_BOOLEAN,
+    1,
+    G_TYPE_DBUS_METHOD_INVOCATION);
+
+}
+
+typedef ConnmanProxyAgentIface ConnmanProxyAgentInterface;
+G_DEFINE_INTERFACE (ConnmanProxyAgent, connman_proxy_agent, G_TYPE_OBJECT);
+
+/**
+ * connman_proxy_agent_call_release:
+ * @proxy: A #ConnmanProxyAgentProxy.
+ * @cancellable: (allow-none): A #GCancellable or %NULL.
+ * @callback: A #GAsyncReadyCallback to call when the request is satisfied or %NULL.
+ * @user_data: User data to pass to @callback.
+ *
+ * Asynchronously invokes the <link linkend="gdbus-method-net-connman-Agent.Release">Release()</link> D-Bus method on @proxy.
+ * When the operation is finished, @callback will be invoked in the <link linkend="g-main-context-push-thread-default">thread-default main loop</link> of the thread you are calling this method from.
+ * You can then call connman_proxy_agent_call_release_finish() to get the result of the operation.
+ *
+ * See connman_proxy_agent_call_release_sync() for the synchronous, blocking version of this method.
+ */
+void
+connman_proxy_agent_call_release (
+    ConnmanProxyAgent *proxy,
+    GCancellable *cancellable,
+    GAsyncReadyCallback callback,
+    gpointer user_data)
+{
+  g_dbus_proxy_call (G_DBUS_PROXY (proxy),
+    "Release",
+    g_variant_new ("()"),
+    G_DBUS_CALL_FLAGS_NONE,
+    -1,
+    cancellable,
+    callback,
+    user_data);
+}
+
+/**
+ * connman_proxy_agent_call_release_finish:
+ * @proxy: A #ConnmanProxyAgentProxy.
+ * @res: The #GAsyncResult obtained from the #GAsyncReadyCallback passed to connman_proxy_agent_call_release().
+ * @error: Return location for error or %NULL.
+ *
+ * Finishes an operation started with connman_proxy_agent_call_release().
+ *
+ * Returns: (skip): %TRUE if the call succeded, %FALSE if @error is set.
+ */
+gboolean
+connman_proxy_agent_call_release_finish (
+    ConnmanProxyAgent *proxy,
+    GAsyncResult *res,
+    GError **error)
+{
+  GVariant *_ret;
+  _ret = g_dbus_proxy_call_finish (G_DBUS_PROXY (proxy), res, error);
+  if (_ret == NULL)
+    goto _out;
+  g_variant_get (_ret,
+                 "()");
+  g_variant_unref (_ret);
+_out:
+  return _ret != NULL;
+}
+
+/**
+ * connman_proxy_agent_call_release_sync:
+ * @proxy: A #ConnmanProxyAgentProxy.
+ * @cancellable: (allow-none): A #GCancellable or %NULL.
+ * @error: Return location for error or %NULL.
+ *
+ * Synchronously invokes the <link linkend="gdbus-method-net-connman-Agent.Release">Release()</link> D-Bus method on @proxy. The calling thread is blocked until a reply is received.
+ *
+ * See connman_proxy_agent_call_release() for the asynchronous version of this method.
+ *
+ * Returns: (skip): %TRUE if the call succeded, %FALSE if @error is set.
+ */
+gboolean
+connman_proxy_agent_call_release_sync (
+    ConnmanProxyAgent *proxy,
+    GCancellable *cancellable,
+    GError **error)
+{
+  GVariant *_ret;
+  _ret = g_dbus_proxy_call_sync (G_DBUS_PROXY (proxy),
+    "Release",
+    g_variant_new ("()"),
+    G_DBUS_CALL_FLAGS_NONE,
+    -1,
+    cancellable,
+    error);
+  if (_ret == NULL)
+    goto _out;
+  g_variant_get (_ret,
+                 "()");
+  g_variant_unref (_ret);
+_out:
+  return _ret != NULL;
+}
+
+/**
+ * connman_proxy_agent_call_report_error:
+ * @proxy: A #ConnmanProxyAgentProxy.
+ * @arg_unnamed_arg0: Argument to pass with the method invocation.
+ * @arg_unnamed_arg1: Argument to pass with the method invocation.
+ * @cancellable: (allow-none): A #GCancellable or %NULL.
+ * @callback: A #GAsyncReadyCallback to call when the request is satisfied or %NULL.
+ * @user_data: User data to pass to @callback.
+ *
+ * Asynchronously invokes the <link linkend="gdbus-method-net-connman-Agent.ReportError">ReportError()</link> D-Bus method on @proxy.
+ * When the operation is finished, @callback will be invoked in the <link linkend="g-main-context-push-thread-default">thread-default main loop</link> of the thread you are calling this method from.
+ * You can then call connman_proxy_agent_call_report_error_finish() to get the result of the operation.
+ *
+ * See connman_proxy_agent_call_report_error_sync() for the synchronous, blocking version of this method.
+ */
+void
+connman_proxy_agent_call_report_error (
+    ConnmanProxyAgent *proxy,
+    const gchar *arg_unnamed_arg0,
+    const gchar *arg_unnamed_arg1,
+    GCancellable *cancellable,
+    GAsyncReadyCallback callback,
+    gpointer user_data)
+{
+  g_dbus_proxy_call (G_DBUS_PROXY (proxy),
+    "ReportError",
+    g_variant_new ("(os)",
+                   arg_unnamed_arg0,
+                   arg_unnamed_arg1),
+    G_DBUS_CALL_FLAGS_NONE,
+    -1,
+    cancellable,
+    callback,
+    user_data);
+}
+
+/**
+ * connman_proxy_agent_call_report_error_finish:
+ * @proxy: A #ConnmanProxyAgentProxy.
+ * @res: The #GAsyncResult obtained from the #GAsyncReadyCallback passed to connman_proxy_agent_call_report_error().
+ * @error: Return location for error or %NULL.
+ *
+ * Finishes an operation started with connman_proxy_agent_call_report_error().
+ *
+ * Returns: (skip): %TRUE if the call succeded, %FALSE if @error is set.
+ */
+gboolean
+connman_proxy_agent_call_report_error_finish (
+    ConnmanProxyAgent *proxy,
+    GAsyncResult *res,
+    GError **error)
+{
+  GVariant *_ret;
+  _ret = g_dbus_proxy_call_finish (G_DBUS_PROXY (proxy), res, error);
+  if (_ret == NULL)
+    goto _out;
+  g_variant_get (_ret,
+                 "()");
+  g_variant_unref (_ret);
+_out:
+  return _ret != NULL;
+}
+
+/**
+ * connman_proxy_agent_call_report_error_sync:
+ * @proxy: A #ConnmanProxyAgentProxy.
+ * @arg_unnamed_arg0: Argument to pass with the method invocation.
+ * @arg_unnamed_arg1: Argument to pass with the method invocation.
+ * @cancellable: (allow-none): A #GCancellable or %NULL.
+ * @error: Return location for error or %NULL.
+ *
+ * Synchronously invokes the <link linkend="gdbus-method-net-connman-Agent.ReportError">ReportError()</link> D-Bus method on @proxy. The calling thread is blocked until a reply is received.
+ *
+ * See connman_proxy_agent_call_report_error() for the asynchronous version of this method.
+ *
+ * Returns: (skip): %TRUE if the call succeded, %FALSE if @error is set.
+ */
+gboolean
+connman_proxy_agent_call_report_error_sync (
+    ConnmanProxyAgent *proxy,
+    const gchar *arg_unnamed_arg0,
+    const gchar *arg_unnamed_arg1,
+    GCancellable *cancellable,
+    GError **error)
+{
+  GVariant *_ret;
+  _ret = g_dbus_proxy_call_sync (G_DBUS_PROXY (proxy),
+    "ReportError",
+    g_variant_new ("(os)",
+                   arg_unnamed_arg0,
+                   arg_unnamed_arg1),
+    G_DBUS_CALL_FLAGS_NONE,
+    -1,
+    cancellable,
+    error);
+  if (_ret == NULL)
+    goto _out;
+  g_variant_get (_ret,
+                 "()");
+  g_variant_unref (_ret);
+_out:
+  return _ret != NULL;
+}
+
+/**
+ * connman_proxy_agent_call_request_browser:
+ * @proxy: A #ConnmanProxyAgentProxy.
+ * @arg_unnamed_arg0: Argument to pass with the method invocation.
+ * @arg_unnamed_arg1: Argument to pass with the method invocation.
+ * @cancellable: (allow-none): A #GCancellable or %NULL.
+ * @callback: A #GAsyncReadyCallback to call when the request is satisfied or %NULL.
+ * @user_data: User data to pass to @callback.
+ *
+ * Asynchronously invokes the <link linkend="gdbus-method-net-connman-Agent.RequestBrowser">RequestBrowser()</link> D-Bus method on @proxy.
+ * When the operation is finished, @callback will be invoked in the <link linkend="g-main-context-push-thread-default">thread-default main loop</link> of the thread you are calling this method from.
+ * You can then call connman_proxy_agent_call_request_browser_finish() to get the result of the operation.
+ *
+ * See connman_proxy_agent_call_request_browser_sync() for the synchronous, blocking version of this method.
+ */
+void
+connman_proxy_agent_call_request_browser (
+    ConnmanProxyAgent *proxy,
+    const gchar *arg_unnamed_arg0,
+    const gchar *arg_unnamed_arg1,
+    GCancellable *cancellable,
+    GAsyncReadyCallback callback,
+    gpointer user_data)
+{
+  g_dbus_proxy_call (G_DBUS_PROXY (proxy),
+    "RequestBrowser",
+    g_variant_new ("(os)",
+                   arg_unnamed_arg0,
+                   arg_unnamed_arg1),
+    G_DBUS_CALL_FLAGS_NONE,
+    -1,
+    cancellable,
+    callback,
+    user_data);
+}
+
+/**
+ * connman_proxy_agent_call_request_browser_finish:
+ * @proxy: A #ConnmanProxyAgentProxy.
+ * @res: The #GAsyncResult obtained from the #GAsyncReadyCallback passed to connman_proxy_agent_call_request_browser().
+ * @error: Return location for error or %NULL.
+ *
+ * Finishes an operation started with connman_proxy_agent_call_request_browser().
+ *
+ * Returns: (skip): %TRUE if the call succeded, %FALSE if @error is set.
+ */
+gboolean
+connman_proxy_agent_call_request_browser_finish (
+    ConnmanProxyAgent *proxy,
+    GAsyncResult *res,
+    GError **error)
+{
+  GVariant *_ret;
+  _ret = g_dbus_proxy_call_finish (G_DBUS_PROXY (proxy), res, error);
+  if (_ret == NULL)
+    goto _out;
+  g_variant_get (_ret,
+                 "()");
+  g_variant_unref (_ret);
+_out:
+  return _ret != NULL;
+}
+
+/**
+ * connman_proxy_agent_call_request_browser_sync:
+ * @proxy: A #ConnmanProxyAgentProxy.
+ * @arg_unnamed_arg0: Argument to pass with the method invocation.
+ * @arg_unnamed_arg1: Argument to pass with the method invocation.
+ * @cancellable: (allow-none): A #GCancellable or %NULL.
+ * @error: Return location for error or %NULL.
+ *
+ * Synchronously invokes the <link linkend="gdbus-method-net-connman-Agent.RequestBrowser">RequestBrowser()</link> D-Bus method on @proxy. The calling thread is blocked until a reply is received.
+ *
+ * See connman_proxy_agent_call_request_browser() for the asynchronous version of this method.
+ *
+ * Returns: (skip): %TRUE if the call succeded, %FALSE if @error is set.
+ */
+gboolean
+connman_proxy_agent_call_request_browser_sync (
+    ConnmanProxyAgent *proxy,
+    const gchar *arg_unnamed_arg0,
+    const gchar *arg_unnamed_arg1,
+    GCancellable *cancellable,
+    GError **error)
+{
+  GVariant *_ret;
+  _ret = g_dbus_proxy_call_sync (G_DBUS_PROXY (proxy),
+    "RequestBrowser",
+    g_variant_new ("(os)",
+                   arg_unnamed_arg0,
+                   arg_unnamed_arg1),
+    G_DBUS_CALL_FLAGS_NONE,
+    -1,
+    cancellable,
+    error);
+  if (_ret == NULL)
+    goto _out;
+  g_variant_get (_ret,
+                 "()");
+  g_variant_unref (_ret);
+_out:
+  return _ret != NULL;
+}
+
+/**
+ * connman_proxy_agent_call_request_input:
+ * @proxy: A #ConnmanProxyAgentProxy.
+ * @arg_unnamed_arg0: Argument to pass with the method invocation.
+ * @arg_unnamed_arg1: Argument to pass with the method invocation.
+ * @cancellable: (allow-none): A #GCancellable or %NULL.
+ * @callback: A #GAsyncReadyCallback to call when the request is satisfied or %NULL.
+ * @user_data: User data to pass to @callback.
+ *
+ * Asynchronously invokes the <link linkend="gdbus-method-net-connman-Agent.RequestInput">RequestInput()</link> D-Bus method on @proxy.
+ * When the operation is finished, @callback will be invoked in the <link linkend="g-main-context-push-thread-default">thread-default main loop</link> of the thread you are calling this method from.
+ * You can then call connman_proxy_agent_call_request_input_finish() to get the result of the operation.
+ *
+ * See connman_proxy_agent_call_request_input_sync() for the synchronous, blocking version of this method.
+ */
+void
+connman_proxy_agent_call_request_input (
+    ConnmanProxyAgent *proxy,
+    const gchar *arg_unnamed_arg0,
+    GVariant *arg_unnamed_arg1,
+    GCancellable *cancellable,
+    GAsyncReadyCallback callback,
+    gpointer user_data)
+{
+  g_dbus_proxy_call (G_DBUS_PROXY (proxy),
+    "RequestInput",
+    g_variant_new ("(o@a{sv})",
+                   arg_unnamed_arg0,
+                   arg_unnamed_arg1),
+    G_DBUS_CALL_FLAGS_NONE,
+    -1,
+    cancellable,
+    callback,
+    user_data);
+}
+
+/**
+ * connman_proxy_agent_call_request_input_finish:
+ * @proxy: A #ConnmanProxyAgentProxy.
+ * @out_unnamed_arg2: (out): Return location for return parameter or %NULL to ignore.
+ * @res: The #GAsyncResult obtained from the #GAsyncReadyCallback passed to connman_proxy_agent_call_request_input().
+ * @error: Return location for error or %NULL.
+ *
+ * Finishes an operation started with connman_proxy_agent_call_request_input().
+ *
+ * Returns: (skip): %TRUE if the call succeded, %FALSE if @error is set.
+ */
+gboolean
+connman_proxy_agent_call_request_input_finish (
+    ConnmanProxyAgent *proxy,
+    GVariant **out_unnamed_arg2,
+    GAsyncResult *res,
+    GError **error)
+{
+  GVariant *_ret;
+  _ret = g_dbus_proxy_call_finish (G_DBUS_PROXY (proxy), res, error);
+  if (_ret == NULL)
+    goto _out;
+  g_variant_get (_ret,
+                 "(@a{sv})",
+                 out_unnamed_arg2);
+  g_variant_unref (_ret);
+_out:
+  return _ret != NULL;
+}
+
+/**
+ * connman_proxy_agent_call_request_input_sync:
+ * @proxy: A #ConnmanProxyAgentProxy.
+ * @arg_unnamed_arg0: Argument to pass with the method invocation.
+ * @arg_unnamed_arg1: Argument to pass with the method invocation.
+ * @out_unnamed_arg2: (out): Return location for return parameter or %NULL to ignore.
+ * @cancellable: (allow-none): A #GCancellable or %NULL.
+ * @error: Return location for error or %NULL.
+ *
+ * Synchronously invokes the <link linkend="gdbus-method-net-connman-Agent.RequestInput">RequestInput()</link> D-Bus method on @proxy. The calling thread is blocked until a reply is received.
+ *
+ * See connman_proxy_agent_call_request_input() for the asynchronous version of this method.
+ *
+ * Returns: (skip): %TRUE if the call succeded, %FALSE if @error is set.
+ */
+gboolean
+connman_proxy_agent_call_request_input_sync (
+    ConnmanProxyAgent *proxy,
+    const gchar *arg_unnamed_arg0,
+    GVariant *arg_unnamed_arg1,
+    GVariant **out_unnamed_arg2,
+    GCancellable *cancellable,
+    GError **error)
+{
+  GVariant *_ret;
+  _ret = g_dbus_proxy_call_sync (G_DBUS_PROXY (proxy),
+    "RequestInput",
+    g_variant_new ("(o@a{sv})",
+                   arg_unnamed_arg0,
+                   arg_unnamed_arg1),
+    G_DBUS_CALL_FLAGS_NONE,
+    -1,
+    cancellable,
+    error);
+  if (_ret == NULL)
+    goto _out;
+  g_variant_get (_ret,
+                 "(@a{sv})",
+                 out_unnamed_arg2);
+  g_variant_unref (_ret);
+_out:
+  return _ret != NULL;
+}
+
+/**
+ * connman_proxy_agent_call_cancel:
+ * @proxy: A #ConnmanProxyAgentProxy.
+ * @cancellable: (allow-none): A #GCancellable or %NULL.
+ * @callback: A #GAsyncReadyCallback to call when the request is satisfied or %NULL.
+ * @user_data: User data to pass to @callback.
+ *
+ * Asynchronously invokes the <link linkend="gdbus-method-net-connman-Agent.Cancel">Cancel()</link> D-Bus method on @proxy.
+ * When the operation is finished, @callback will be invoked in the <link linkend="g-main-context-push-thread-default">thread-default main loop</link> of the thread you are calling this method from.
+ * You can then call connman_proxy_agent_call_cancel_finish() to get the result of the operation.
+ *
+ * See connman_proxy_agent_call_cancel_sync() for the synchronous, blocking version of this method.
+ */
+void
+connman_proxy_agent_call_cancel (
+    ConnmanProxyAgent *proxy,
+    GCancellable *cancellable,
+    GAsyncReadyCallback callback,
+    gpointer user_data)
+{
+  g_dbus_proxy_call (G_DBUS_PROXY (proxy),
+    "Cancel",
+    g_variant_new ("()"),
+    G_DBUS_CALL_FLAGS_NONE,
+    -1,
+    cancellable,
+    callback,
+    user_data);
+}
+
+/**
+ * connman_proxy_agent_call_cancel_finish:
+ * @proxy: A #ConnmanProxyAgentProxy.
+ * @res: The #GAsyncResult obtained from the #GAsyncReadyCallback passed to connman_proxy_agent_call_cancel().
+ * @error: Return location for error or %NULL.
+ *
+ * Finishes an operation started with connman_proxy_agent_call_cancel().
+ *
+ * Returns: (skip): %TRUE if the call succeded, %FALSE if @error is set.
+ */
+gboolean
+connman_proxy_agent_call_cancel_finish (
+    ConnmanProxyAgent *proxy,
+    GAsyncResult *res,
+    GError **error)
+{
+  GVariant *_ret;
+  _ret = g_dbus_proxy_call_finish (G_DBUS_PROXY (proxy), res, error);
+  if (_ret == NULL)
+    goto _out;
+  g_variant_get (_ret,
+                 "()");
+  g_variant_unref (_ret);
+_out:
+  return _ret != NULL;
+}
+
+/**
+ * connman_proxy_agent_call_cancel_sync:
+ * @proxy: A #ConnmanProxyAgentProxy.
+ * @cancellable: (allow-none): A #GCancellable or %NULL.
+ * @error: Return location for error or %NULL.
+ *
+ * Synchronously invokes the <link linkend="gdbus-method-net-connman-Agent.Cancel">Cancel()</link> D-Bus method on @proxy. The calling thread is blocked until a reply is received.
+ *
+ * See connman_proxy_agent_call_cancel() for the asynchronous version of this method.
+ *
+ * Returns: (skip): %TRUE if the call succeded, %FALSE if @error is set.
+ */
+gboolean
+connman_proxy_agent_call_cancel_sync (
+    ConnmanProxyAgent *proxy,
+    GCancellable *cancellable,
+    GError **error)
+{
+  GVariant *_ret;
+  _ret = g_dbus_proxy_call_sync (G_DBUS_PROXY (proxy),
+    "Cancel",
+    g_variant_new ("()"),
+    G_DBUS_CALL_FLAGS_NONE,
+    -1,
+    cancellable,
+    error);
+  if (_ret == NULL)
+    goto _out;
+  g_variant_get (_ret,
+                 "()");
+  g_variant_unref (_ret);
+_out:
+  return _ret != NULL;
+}
+
+/**
+ * connman_proxy_agent_complete_release:
+ * @object: A #ConnmanProxyAgent.
+ * @invocation: (transfer full): A #GDBusMethodInvocation.
+ *
+ * Helper function used in service implementations to finish handling invocations of the <link linkend="gdbus-method-net-connman-Agent.Release">Release()</link> D-Bus method. If you instead want to finish handling an invocation by returning an error, use g_dbus_method_invocation_return_error() or similar.
+ *
+ * This method will free @invocation, you cannot use it afterwards.
+ */
+void
+connman_proxy_agent_complete_release (
+    ConnmanProxyAgent *object,
+    GDBusMethodInvocation *invocation)
+{
+  g_dbus_method_invocation_return_value (invocation,
+    g_variant_new ("()"));
+}
+
+/**
+ * connman_proxy_agent_complete_report_error:
+ * @object: A #ConnmanProxyAgent.
+ * @invocation: (transfer full): A #GDBusMethodInvocation.
+ *
+ * Helper function used in service implementations to finish handling invocations of the <link linkend="gdbus-method-net-connman-Agent.ReportError">ReportError()</link> D-Bus method. If you instead want to finish handling an invocation by returning an error, use g_dbus_method_invocation_return_error() or similar.
+ *
+ * This method will free @invocation, you cannot use it afterwards.
+ */
+void
+connman_proxy_agent_complete_report_error (
+    ConnmanProxyAgent *object,
+    GDBusMethodInvocation *invocation)
+{
+  g_dbus_method_invocation_return_value (invocation,
+    g_variant_new ("()"));
+}
+
+/**
+ * connman_proxy_agent_complete_request_browser:
+ * @object: A #ConnmanProxyAgent.
+ * @invocation: (transfer full): A #GDBusMethodInvocation.
+ *
+ * Helper function used in service implementations to finish handling invocations of the <link linkend="gdbus-method-net-connman-Agent.RequestBrowser">RequestBrowser()</link> D-Bus method. If you instead want to finish handling an invocation by returning an error, use g_dbus_method_invocation_return_error() or similar.
+ *
+ * This method will free @invocation, you cannot use it afterwards.
+ */
+void
+connman_proxy_agent_complete_request_browser (
+    ConnmanProxyAgent *object,
+    GDBusMethodInvocation *invocation)
+{
+  g_dbus_method_invocation_return_value (invocation,
+    g_variant_new ("()"));
+}
+
+/**
+ * connman_proxy_agent_complete_request_input:
+ * @object: A #ConnmanProxyAgent.
+ * @invocation: (transfer full): A #GDBusMethodInvocation.
+ * @unnamed_arg2: Parameter to return.
+ *
+ * Helper function used in service implementations to finish handling invocations of the <link linkend="gdbus-method-net-connman-Agent.RequestInput">RequestInput()</link> D-Bus method. If you instead want to finish handling an invocation by returning an error, use g_dbus_method_invocation_return_error() or similar.
+ *
+ * This method will free @invocation, you cannot use it afterwards.
+ */
+void
+connman_proxy_agent_complete_request_input (
+    ConnmanProxyAgent *object,
+    GDBusMethodInvocation *invocation,
+    GVariant *unnamed_arg2)
+{
+  g_dbus_method_invocation_return_value (invocation,
+    g_variant_new ("(@a{sv})",
+                   unnamed_arg2));
+}
+
+/**
+ * connman_proxy_agent_complete_cancel:
+ * @object: A #ConnmanProxyAgent.
+ * @invocation: (transfer full): A #GDBusMethodInvocation.
+ *
+ * Helper function used in service implementations to finish handling invocations of the <link linkend="gdbus-method-net-connman-Agent.Cancel">Cancel()</link> D-Bus method. If you instead want to finish handling an invocation by returning an error, use g_dbus_method_invocation_return_error() or similar.
+ *
+ * This method will free @invocation, you cannot use it afterwards.
+ */
+void
+connman_proxy_agent_complete_cancel (
+    ConnmanProxyAgent *object,
+    GDBusMethodInvocation *invocation)
+{
+  g_dbus_method_invocation_return_value (invocation,
+    g_variant_new ("()"));
+}
+
+/* ------------------------------------------------------------------------ */
+
+/**
+ * ConnmanProxyAgentProxy:
+ *
+ * The #ConnmanProxyAgentProxy structure contains only private data and should only be accessed using the provided API.
+ */
+
+/**
+ * ConnmanProxyAgentProxyClass:
+ * @parent_class: The parent class.
+ *
+ * Class structure for #ConnmanProxyAgentProxy.
+ */
+
+struct _ConnmanProxyAgentProxyPrivate
+{
+  GData *qdata;
+};
+
+static void connman_proxy_agent_proxy_iface_init (ConnmanProxyAgentIface *iface);
+
+G_DEFINE_TYPE_WITH_CODE (ConnmanProxyAgentProxy, connman_proxy_agent_proxy, G_TYPE_DBUS_PROXY,
+                         G_IMPLEMENT_INTERFACE (CONNMAN_PROXY_TYPE_AGENT, connman_proxy_agent_proxy_iface_init));
+
+static void
+connman_proxy_agent_proxy_finalize (GObject *object)
+{
+  ConnmanProxyAgentProxy *proxy = CONNMAN_PROXY_AGENT_PROXY (object);
+  g_datalist_clear (&proxy->priv->qdata);
+  G_OBJECT_CLASS (connman_proxy_agent_proxy_parent_class)->finalize (object);
+}
+
+static void
+connman_proxy_agent_proxy_get_property (GObject      *object,
+  guint         prop_id,
+  GValue       *value,
+  GParamSpec   *pspec)
+{
+}
+
+static void
+connman_proxy_agent_proxy_set_property (GObject      *object,
+  guint         prop_id,
+  const GValue *value,
+  GParamSpec   *pspec)
+{
+}
+
+static void
+connman_proxy_agent_proxy_g_signal (GDBusProxy *proxy,
+  const gchar *sender_name,
+  const gchar *signal_name,
+  GVariant *parameters)
+{
+  _ExtendedGDBusSignalInfo *info;
+  GVariantIter iter;
+  GVariant *child;
+  GValue *paramv;
+  guint num_params;
+  guint n;
+  guint signal_id;
+  info = (_ExtendedGDBusSignalInfo *) g_dbus_interface_info_lookup_signal ((GDBusInterfaceInfo *) &_connman_proxy_agent_interface_info, signal_name);
+  if (info == NULL)
+    return;
+  num_params = g_variant_n_children (parameters);
+  paramv = g_new0 (GValue, num_params + 1);
+  g_value_init (&paramv[0], CONNMAN_PROXY_TYPE_AGENT);
+  g_value_set_object (&paramv[0], proxy);
+  g_variant_iter_init (&iter, parameters);
+  n = 1;
+  while ((child = g_variant_iter_next_value (&iter)) != NULL)
+    {
+      _ExtendedGDBusArgInfo *arg_info = (_ExtendedGDBusArgInfo *) info->parent_struct.args[n - 1];
+      if (arg_info->use_gvariant)
+        {
+          g_value_init (&paramv[n], G_TYPE_VARIANT);
+          g_value_set_variant (&paramv[n], child);
+          n++;
+        }
+      else
+        g_dbus_gvariant_to_gvalue (child, &paramv[n++]);
+      g_variant_unref (child);
+    }
+  signal_id = g_signal_lookup (info->signal_name, CONNMAN_PROXY_TYPE_AGENT);
+  g_signal_emitv (paramv, signal_id, 0, NULL);
+  for (n = 0; n < num_params + 1; n++)
+    g_value_unset (&paramv[n]);
+  g_free (paramv);
+}
+
+static void
+connman_proxy_agent_proxy_g_properties_changed (GDBusProxy *_proxy,
+  GVariant *changed_properties,
+  const gchar *const *invalidated_properties)
+{
+  ConnmanProxyAgentProxy *proxy = CONNMAN_PROXY_AGENT_PROXY (_proxy);
+  guint n;
+  const gchar *key;
+  GVariantIter *iter;
+  _ExtendedGDBusPropertyInfo *info;
+  g_variant_get (changed_properties, "a{sv}", &iter);
+  while (g_variant_iter_next (iter, "{&sv}", &key, NULL))
+    {
+      info = (_ExtendedGDBusPropertyInfo *) g_dbus_interface_info_lookup_property ((GDBusInterfaceInfo *) &_connman_proxy_agent_interface_info, key);
+      g_datalist_remove_data (&proxy->priv->qdata, key);
+      if (info != NULL)
+        g_object_notify (G_OBJECT (proxy), info->hyphen_name);
+    }
+  g_variant_iter_free (iter);
+  for (n = 0; invalidated_properties[n] != NULL; n++)
+    {
+      info = (_ExtendedGDBusPropertyInfo *) g_dbus_interface_info_lookup_property ((GDBusInterfaceInfo *) &_connman_proxy_agent_interface_info, invalidated_properties[n]);
+      g_datalist_remove_data (&proxy->priv->qdata, invalidated_properties[n]);
+      if (info != NULL)
+        g_object_notify (G_OBJECT (proxy), info->hyphen_name);
+    }
+}
+
+static void
+connman_proxy_agent_proxy_init (ConnmanProxyAgentProxy *proxy)
+{
+  proxy->priv = G_TYPE_INSTANCE_GET_PRIVATE (proxy, CONNMAN_PROXY_TYPE_AGENT_PROXY, ConnmanProxyAgentProxyPrivate);
+  g_dbus_proxy_set_interface_info (G_DBUS_PROXY (proxy), connman_proxy_agent_interface_info ());
+}
+
+static void
+connman_proxy_agent_proxy_class_init (ConnmanProxyAgentProxyClass *klass)
+{
+  GObjectClass *gobject_class;
+  GDBusProxyClass *proxy_class;
+
+  g_type_class_add_private (klass, sizeof (ConnmanProxyAgentProxyPrivate));
+
+  gobject_class = G_OBJECT_CLASS (klass);
+  gobject_class->finalize     = connman_proxy_agent_proxy_finalize;
+  gobject_class->get_property = connman_proxy_agent_proxy_get_property;
+  gobject_class->set_property = connman_proxy_agent_proxy_set_property;
+
+  proxy_class = G_DBUS_PROXY_CLASS (klass);
+  proxy_class->g_signal = connman_proxy_agent_proxy_g_signal;
+  proxy_class->g_properties_changed = connman_proxy_agent_proxy_g_properties_changed;
+
+}
+
+static void
+connman_proxy_agent_proxy_iface_init (ConnmanProxyAgentIface *iface)
+{
+}
+
+/**
+ * connman_proxy_agent_proxy_new:
+ * @connection: A #GDBusConnection.
+ * @flags: Flags from the #GDBusProxyFlags enumeration.
+ * @name: (allow-none): A bus name (well-known or unique) or %NULL if @connection is not a message bus connection.
+ * @object_path: An object path.
+ * @cancellable: (allow-none): A #GCancellable or %NULL.
+ * @callback: A #GAsyncReadyCallback to call when the request is satisfied.
+ * @user_data: User data to pass to @callback.
+ *
+ * Asynchronously creates a proxy for the D-Bus interface <link linkend="gdbus-interface-net-connman-Agent.top_of_page">net.connman.Agent</link>. See g_dbus_proxy_new() for more details.
+ *
+ * When the operation is finished, @callback will be invoked in the <link linkend="g-main-context-push-thread-default">thread-default main loop</link> of the thread you are calling this method from.
+ * You can then call connman_proxy_agent_proxy_new_finish() to get the result of the operation.
+ *
+ * See connman_proxy_agent_proxy_new_sync() for the synchronous, blocking version of this constructor.
+ */
+void
+connman_proxy_agent_proxy_new (
+    GDBusConnection     *connection,
+    GDBusProxyFlags      flags,
+    const gchar         *name,
+    const gchar         *object_path,
+    GCancellable        *cancellable,
+    GAsyncReadyCallback  callback,
+    gpointer             user_data)
+{
+  g_async_initable_new_async (CONNMAN_PROXY_TYPE_AGENT_PROXY, G_PRIORITY_DEFAULT, cancellable, callback, user_data, "g-flags", flags, "g-name", name, "g-connection", connection, "g-object-path", object_path, "g-interface-name", "net.connman.Agent", NULL);
+}
+
+/**
+ * connman_proxy_agent_proxy_new_finish:
+ * @res: The #GAsyncResult obtained from the #GAsyncReadyCallback passed to connman_proxy_agent_proxy_new().
+ * @error: Return location for error or %NULL
+ *
+ * Finishes an operation started with connman_proxy_agent_proxy_new().
+ *
+ * Returns: (transfer full) (type ConnmanProxyAgentProxy): The constructed proxy object or %NULL if @error is set.
+ */
+ConnmanProxyAgent *
+connman_proxy_agent_proxy_new_finish (
+    GAsyncResult        *res,
+    GError             **error)
+{
+  GObject *ret;
+  GObject *source_object;
+  source_object = g_async_result_get_source_object (res);
+  ret = g_async_initable_new_finish (G_ASYNC_INITABLE (source_object), res, error);
+  g_object_unref (source_object);
+  if (ret != NULL)
+    return CONNMAN_PROXY_AGENT (ret);
+  else
+    return NULL;
+}
+
+/**
+ * connman_proxy_agent_proxy_new_sync:
+ * @connection: A #GDBusConnection.
+ * @flags: Flags from the #GDBusProxyFlags enumeration.
+ * @name: (allow-none): A bus name (well-known or unique) or %NULL if @connection is not a message bus connection.
+ * @object_path: An object path.
+ * @cancellable: (allow-none): A #GCancellable or %NULL.
+ * @error: Return location for error or %NULL
+ *
+ * Synchronously creates a proxy for the D-Bus interface <link linkend="gdbus-interface-net-connman-Agent.top_of_page">net.connman.Agent</link>. See g_dbus_proxy_new_sync() for more details.
+ *
+ * The calling thread is blocked until a reply is received.
+ *
+ * See connman_proxy_agent_proxy_new() for the asynchronous version of this constructor.
+ *
+ * Returns: (transfer full) (type ConnmanProxyAgentProxy): The constructed proxy object or %NULL if @error is set.
+ */
+ConnmanProxyAgent *
+connman_proxy_agent_proxy_new_sync (
+    GDBusConnection     *connection,
+    GDBusProxyFlags      flags,
+    const gchar         *name,
+    const gchar         *object_path,
+    GCancellable        *cancellable,
+    GError             **error)
+{
+  GInitable *ret;
+  ret = g_initable_new (CONNMAN_PROXY_TYPE_AGENT_PROXY, cancellable, error, "g-flags", flags, "g-name", name, "g-connection", connection, "g-object-path", object_path, "g-interface-name", "net.connman.Agent", NULL);
+  if (ret != NULL)
+    return CONNMAN_PROXY_AGENT (ret);
+  else
+    return NULL;
+}
+
+
+/**
+ * connman_proxy_agent_proxy_new_for_bus:
+ * @bus_type: A #GBusType.
+ * @flags: Flags from the #GDBusProxyFlags enumeration.
+ * @name: A bus name (well-known or unique).
+ * @object_path: An object path.
+ * @cancellable: (allow-none): A #GCancellable or %NULL.
+ * @callback: A #GAsyncReadyCallback to call when the request is satisfied.
+ * @user_data: User data to pass to @callback.
+ *
+ * Like connman_proxy_agent_proxy_new() but takes a #GBusType instead of a #GDBusConnection.
+ *
+ * When the operation is finished, @callback will be invoked in the <link linkend="g-main-context-push-thread-default">thread-default main loop</link> of the thread you are calling this method from.
+ * You can then call connman_proxy_agent_proxy_new_for_bus_finish() to get the result of the operation.
+ *
+ * See connman_proxy_agent_proxy_new_for_bus_sync() for the synchronous, blocking version of this constructor.
+ */
+void
+connman_proxy_agent_proxy_new_for_bus (
+    GBusType             bus_type,
+    GDBusProxyFlags      flags,
+    const gchar         *name,
+    const gchar         *object_path,
+    GCancellable        *cancellable,
+    GAsyncReadyCallback  callback,
+    gpointer             user_data)
+{
+  g_async_initable_new_async (CONNMAN_PROXY_TYPE_AGENT_PROXY, G_PRIORITY_DEFAULT, cancellable, callback, user_data, "g-flags", flags, "g-name", name, "g-bus-type", bus_type, "g-object-path", object_path, "g-interface-name", "net.connman.Agent", NULL);
+}
+
+/**
+ * connman_proxy_agent_proxy_new_for_bus_finish:
+ * @res: The #GAsyncResult obtained from the #GAsyncReadyCallback passed to connman_proxy_agent_proxy_new_for_bus().
+ * @error: Return location for error or %NULL
+ *
+ * Finishes an operation started with connman_proxy_agent_proxy_new_for_bus().
+ *
+ * Returns: (transfer full) (type ConnmanProxyAgentProxy): The constructed proxy object or %NULL if @error is set.
+ */
+ConnmanProxyAgent *
+connman_proxy_agent_proxy_new_for_bus_finish (
+    GAsyncResult        *res,
+    GError             **error)
+{
+  GObject *ret;
+  GObject *source_object;
+  source_object = g_async_result_get_source_object (res);
+  ret = g_async_initable_new_finish (G_ASYNC_INITABLE (source_object), res, error);
+  g_object_unref (source_object);
+  if (ret != NULL)
+    return CONNMAN_PROXY_AGENT (ret);
+  else
+    return NULL;
+}
+
+/**
+ * connman_proxy_agent_proxy_new_for_bus_sync:
+ * @bus_type: A #GBusType.
+ * @flags: Flags from the #GDBusProxyFlags enumeration.
+ * @name: A bus name (well-known or unique).
+ * @object_path: An object path.
+ * @cancellable: (allow-none): A #GCancellable or %NULL.
+ * @error: Return location for error or %NULL
+ *
+ * Like connman_proxy_agent_proxy_new_sync() but takes a #GBusType instead of a #GDBusConnection.
+ *
+ * The calling thread is blocked until a reply is received.
+ *
+ * See connman_proxy_agent_proxy_new_for_bus() for the asynchronous version of this constructor.
+ *
+ * Returns: (transfer full) (type ConnmanProxyAgentProxy): The constructed proxy object or %NULL if @error is set.
+ */
+ConnmanProxyAgent *
+connman_proxy_agent_proxy_new_for_bus_sync (
+    GBusType             bus_type,
+    GDBusProxyFlags      flags,
+    const gchar         *name,
+    const gchar         *object_path,
+    GCancellable        *cancellable,
+    GError             **error)
+{
+  GInitable *ret;
+  ret = g_initable_new (CONNMAN_PROXY_TYPE_AGENT_PROXY, cancellable, error, "g-flags", flags, "g-name", name, "g-bus-type", bus_type, "g-object-path", object_path, "g-interface-name", "net.connman.Agent", NULL);
+  if (ret != NULL)
+    return CONNMAN_PROXY_AGENT (ret);
+  else
+    return NULL;
+}
+
+
+/* ------------------------------------------------------------------------ */
+
+/**
+ * ConnmanProxyAgentSkeleton:
+ *
+ * The #ConnmanProxyAgentSkeleton structure contains only private data and should only be accessed using the provided API.
+ */
+
+/**
+ * ConnmanProxyAgentSkeletonClass:
+ * @parent_class: The parent class.
+ *
+ * Class structure for #ConnmanProxyAgentSkeleton.
+ */
+
+struct _ConnmanProxyAgentSkeletonPrivate
+{
+  GValueArray *properties;
+  GList *changed_properties;
+  GSource *changed_properties_idle_source;
+  GMainContext *context;
+  GMutex *lock;
+};
+
+static void
+_connman_proxy_agent_skeleton_handle_method_call (
+  GDBusConnection *connection,
+  const gchar *sender,
+  const gchar *object_path,
+  const gchar *interface_name,
+  const gchar *method_name,
+  GVariant *parameters,
+  GDBusMethodInvocation *invocation,
+  gpointer user_data)
+{
+  ConnmanProxyAgentSkeleton *skeleton = CONNMAN_PROXY_AGENT_SKELETON (user_data);
+  _ExtendedGDBusMethodInfo *info;
+  GVariantIter iter;
+  GVariant *child;
+  GValue *paramv;
+  guint num_params;
+  guint num_extra;
+  guint n;
+  guint signal_id;
+  GValue return_value = {0};
+  info = (_ExtendedGDBusMethodInfo *) g_dbus_method_invocation_get_method_info (invocation);
+  g_assert (info != NULL);
+  num_params = g_variant_n_children (parameters);
+  num_extra = info->pass_fdlist ? 3 : 2;  paramv = g_new0 (GValue, num_params + num_extra);
+  n = 0;
+  g_value_init (&paramv[n], CONNMAN_PROXY_TYPE_AGENT);
+  g_value_set_object (&paramv[n++], skeleton);
+  g_value_init (&paramv[n], G_TYPE_DBUS_METHOD_INVOCATION);
+  g_value_set_object (&paramv[n++], invocation);
+  if (info->pass_fdlist)
+    {
+#ifdef G_OS_UNIX
+      g_value_init (&paramv[n], G_TYPE_UNIX_FD_LIST);
+      g_value_set_object (&paramv[n++], g_dbus_message_get_unix_fd_list (g_dbus_method_invocation_get_message (invocation)));
+#else
+      g_assert_not_reached ();
+#endif
+    }
+  g_variant_iter_init (&iter, parameters);
+  while ((child = g_variant_iter_next_value (&iter)) != NULL)
+    {
+      _ExtendedGDBusArgInfo *arg_info = (_ExtendedGDBusArgInfo *) info->parent_struct.in_args[n - num_extra];
+      if (arg_info->use_gvariant)
+        {
+          g_value_init (&paramv[n], G_TYPE_VARIANT);
+          g_value_set_variant (&paramv[n], child);
+          n++;
+        }
+      else
+        g_dbus_gvariant_to_gvalue (child, &paramv[n++]);
+      g_variant_unref (child);
+    }
+  signal_id = g_signal_lookup (info->signal_name, CONNMAN_PROXY_TYPE_AGENT);
+  g_value_init (&return_value, G_TYPE_BOOLEAN);
+  g_signal_emitv (paramv, signal_id, 0, &return_value);
+  if (!g_value_get_boolean (&return_value))
+    g_dbus_method_invocation_return_error (invocation, G_DBUS_ERROR, G_DBUS_ERROR_UNKNOWN_METHOD, "Method %s is not implemented on interface %s", method_name, interface_name);
+  g_value_unset (&return_value);
+  for (n = 0; n < num_params + num_extra; n++)
+    g_value_unset (&paramv[n]);
+  g_free (paramv);
+}
+
+static GVariant *
+_connman_proxy_agent_skeleton_handle_get_property (
+  GDBusConnection *connection,
+  const gchar *sender,
+  const gchar *object_path,
+  const gchar *interface_name,
+  const gchar *property_name,
+  GError **error,
+  gpointer user_data)
+{
+  ConnmanProxyAgentSkeleton *skeleton = CONNMAN_PROXY_AGENT_SKELETON (user_data);
+  GValue value = {0};
+  GParamSpec *pspec;
+  _ExtendedGDBusPropertyInfo *info;
+  GVariant *ret;
+  ret = NULL;
+  info = (_ExtendedGDBusPropertyInfo *) g_dbus_interface_info_lookup_property ((GDBusInterfaceInfo *) &_connman_proxy_agent_interface_info, property_name);
+  g_assert (info != NULL);
+  pspec = g_object_class_find_property (G_OBJECT_GET_CLASS (skeleton), info->hyphen_name);
+  if (pspec == NULL)
+    {
+      g_set_error (error, G_DBUS_ERROR, G_DBUS_ERROR_INVALID_ARGS, "No property with name %s", property_name);
+    }
+  else
+    {
+      g_value_init (&value, pspec->value_type);
+      g_object_get_property (G_OBJECT (skeleton), info->hyphen_name, &value);
+      ret = g_dbus_gvalue_to_gvariant (&value, G_VARIANT_TYPE (info->parent_struct.signature));
+      g_value_unset (&value);
+    }
+  return ret;
+}
+
+static gboolean
+_connman_proxy_agent_skeleton_handle_set_property (
+  GDBusConnection *connection,
+  const gchar *sender,
+  const gchar *object_path,
+  const gchar *interface_name,
+  const gchar *property_name,
+  GVariant *variant,
+  GError **error,
+  gpointer user_data)
+{
+  ConnmanProxyAgentSkeleton *skeleton = CONNMAN_PROXY_AGENT_SKELETON (user_data);
+  GValue value = {0};
+  GParamSpec *pspec;
+  _ExtendedGDBusPropertyInfo *info;
+  gboolean ret;
+  ret = FALSE;
+  info = (_ExtendedGDBusPropertyInfo *) g_dbus_interface_info_lookup_property ((GDBusInterfaceInfo *) &_connman_proxy_agent_interface_info, property_name);
+  g_assert (info != NULL);
+  pspec = g_object_class_find_property (G_OBJECT_GET_CLASS (skeleton), info->hyphen_name);
+  if (pspec == NULL)
+    {
+      g_set_error (error, G_DBUS_ERROR, G_DBUS_ERROR_INVALID_ARGS, "No property with name %s", property_name);
+    }
+  else
+    {
+      if (info->use_gvariant)
+        g_value_set_variant (&value, variant);
+      else
+        g_dbus_gvariant_to_gvalue (variant, &value);
+      g_object_set_property (G_OBJECT (skeleton), info->hyphen_name, &value);
+      g_value_unset (&value);
+      ret = TRUE;
+    }
+  return ret;
+}
+
+static const GDBusInterfaceVTable _connman_proxy_agent_skeleton_vtable =
+{
+  _connman_proxy_agent_skeleton_handle_method_call,
+  _connman_proxy_agent_skeleton_handle_get_property,
+  _connman_proxy_agent_skeleton_handle_set_property
+};
+
+static GDBusInterfaceInfo *
+connman_proxy_agent_skeleton_dbus_interface_get_info (GDBusInterfaceSkeleton *skeleton)
+{
+  return connman_proxy_agent_interface_info ();
+}
+
+static GDBusInterfaceVTable *
+connman_proxy_agent_skeleton_dbus_interface_get_vtable (GDBusInterfaceSkeleton *skeleton)
+{
+  return (GDBusInterfaceVTable *) &_connman_proxy_agent_skeleton_vtable;
+}
+
+static GVariant *
+connman_proxy_agent_skeleton_dbus_interface_get_properties (GDBusInterfaceSkeleton *_skeleton)
+{
+  ConnmanProxyAgentSkeleton *skeleton = CONNMAN_PROXY_AGENT_SKELETON (_skeleton);
+
+  GVariantBuilder builder;
+  guint n;
+  g_variant_builder_init (&builder, G_VARIANT_TYPE ("a{sv}"));
+  if (_connman_proxy_agent_interface_info.parent_struct.properties == NULL)
+    goto out;
+  for (n = 0; _connman_proxy_agent_interface_info.parent_struct.properties[n] != NULL; n++)
+    {
+      GDBusPropertyInfo *info = _connman_proxy_agent_interface_info.parent_struct.properties[n];
+      if (info->flags & G_DBUS_PROPERTY_INFO_FLAGS_READABLE)
+        {
+          GVariant *value;
+          value = _connman_proxy_agent_skeleton_handle_get_property (g_dbus_interface_skeleton_get_connection (G_DBUS_INTERFACE_SKELETON (skeleton)), NULL, g_dbus_interface_skeleton_get_object_path (G_DBUS_INTERFACE_SKELETON (skeleton)), "net.connman.Agent", info->name, NULL, skeleton);
+          if (value != NULL)
+            {
+              g_variant_take_ref (value);
+              g_variant_builder_add (&builder, "{sv}", info->name, value);
+              g_variant_unref (value);
+            }
+        }
+    }
+out:
+  return g_variant_builder_end (&builder);
+}
+
+static void
+connman_proxy_agent_skeleton_dbus_interface_flush (GDBusInterfaceSkeleton *_skeleton)
+{
+}
+
+static void connman_proxy_agent_skeleton_iface_init (ConnmanProxyAgentIface *iface);
+G_DEFINE_TYPE_WITH_CODE (ConnmanProxyAgentSkeleton, connman_proxy_agent_skeleton, G_TYPE_DBUS_INTERFACE_SKELETON,
+                         G_IMPLEMENT_INTERFACE (CONNMAN_PROXY_TYPE_AGENT, connman_proxy_agent_skeleton_iface_init));
+
+static void
+connman_proxy_agent_skeleton_finalize (GObject *object)
+{
+  ConnmanProxyAgentSkeleton *skeleton = CONNMAN_PROXY_AGENT_SKELETON (object);
+  g_list_foreach (skeleton->priv->changed_properties, (GFunc) _changed_property_free, NULL);
+  g_list_free (skeleton->priv->changed_properties);
+  if (skeleton->priv->changed_properties_idle_source != NULL)
+    g_source_destroy (skeleton->priv->changed_properties_idle_source);
+  if (skeleton->priv->context != NULL)
+    g_main_context_unref (skeleton->priv->context);
+  g_mutex_free (skeleton->priv->lock);
+  G_OBJECT_CLASS (connman_proxy_agent_skeleton_parent_class)->finalize (object);
+}
+
+static void
+connman_proxy_agent_skeleton_init (ConnmanProxyAgentSkeleton *skeleton)
+{
+  skeleton->priv = G_TYPE_INSTANCE_GET_PRIVATE (skeleton, CONNMAN_PROXY_TYPE_AGENT_SKELETON, ConnmanProxyAgentSkeletonPrivate);
+  skeleton->priv->lock = g_mutex_new ();
+  skeleton->priv->context = g_main_context_get_thread_default ();
+  if (skeleton->priv->context != NULL)
+    g_main_context_ref (skeleton->priv->context);
+}
+
+static void
+connman_proxy_agent_skeleton_class_init (ConnmanProxyAgentSkeletonClass *klass)
+{
+  GObjectClass *gobject_class;
+  GDBusInterfaceSkeletonClass *skeleton_class;
+
+  g_type_class_add_private (klass, sizeof (ConnmanProxyAgentSkeletonPrivate));
+
+  gobject_class = G_OBJECT_CLASS (klass);
+  gobject_class->finalize = connman_proxy_agent_skeleton_finalize;
+
+  skeleton_class = G_DBUS_INTERFACE_SKELETON_CLASS (klass);
+  skeleton_class->get_info = connman_proxy_agent_skeleton_dbus_interface_get_info;
+  skeleton_class->get_properties = connman_proxy_agent_skeleton_dbus_interface_get_properties;
+  skeleton_class->flush = connman_proxy_agent_skeleton_dbus_interface_flush;
+  skeleton_class->get_vtable = connman_proxy_agent_skeleton_dbus_interface_get_vtable;
+}
+
+static void
+connman_proxy_agent_skeleton_iface_init (ConnmanProxyAgentIface *iface)
+{
+}
+
+/**
+ * connman_proxy_agent_skeleton_new:
+ *
+ * Creates a skeleton object for the D-Bus interface <link linkend="gdbus-interface-net-connman-Agent.top_of_page">net.connman.Agent</link>.
+ *
+ * Returns: (transfer full) (type ConnmanProxyAgentSkeleton): The skeleton object.
+ */
+ConnmanProxyAgent *
+connman_proxy_agent_skeleton_new (void)
+{
+  return CONNMAN_PROXY_AGENT (g_object_new (CONNMAN_PROXY_TYPE_AGENT_SKELETON, NULL));
+}
+
+/* ------------------------------------------------------------------------
+ * Code for interface net.connman.Counter
+ * ------------------------------------------------------------------------
+ */
+
+/**
+ * SECTION:ConnmanProxyCounter
+ * @title: ConnmanProxyCounter
+ * @short_description: Generated C code for the net.connman.Counter D-Bus interface
+ *
+ * This section contains code for working with the <link linkend="gdbus-interface-net-connman-Counter.top_of_page">net.connman.Counter</link> D-Bus interface in C.
+ */
+
+/* ---- Introspection data for net.connman.Counter ---- */
+
+static const _ExtendedGDBusMethodInfo _connman_proxy_counter_method_info_release =
+{
+  {
+    -1,
+    "Release",
+    NULL,
+    NULL,
+    NULL
+  },
+  "handle-release",
+  FALSE
+};
+
+static const _ExtendedGDBusArgInfo _connman_proxy_counter_method_info_usage_IN_ARG_unnamed_arg0 =
+{
+  {
+    -1,
+    "unnamed_arg0",
+    "o",
+    NULL
+  },
+  FALSE
+};
+
+static const _ExtendedGDBusArgInfo _connman_proxy_counter_method_info_usage_IN_ARG_unnamed_arg1 =
+{
+  {
+    -1,
+    "unnamed_arg1",
+    "a{sv}",
+    NULL
+  },
+  FALSE
+};
+
+static const _ExtendedGDBusArgInfo _connman_proxy_counter_method_info_usage_IN_ARG_unnamed_arg2 =
+{
+  {
+    -1,
+    "unnamed_arg2",
+    "a{sv}",
+    NULL
+  },
+  FALSE
+};
+
+static const _ExtendedGDBusArgInfo * const _connman_proxy_counter_method_info_usage_IN_ARG_pointers[] =
+{
+  &_connman_proxy_counter_method_info_usage_IN_ARG_unnamed_arg0,
+  &_connman_proxy_counter_method_info_usage_IN_ARG_unnamed_arg1,
+  &_connman_proxy_counter_method_info_usage_IN_ARG_unnamed_arg2,
+  NULL
+};
+
+static const _ExtendedGDBusMethodInfo _connman_proxy_counter_method_info_usage =
+{
+  {
+    -1,
+    "Usage",
+    (GDBusArgInfo **) &_connman_proxy_counter_method_info_usage_IN_ARG_pointers,
+    NULL,
+    NULL
+  },
+  "handle-usage",
+  FALSE
+};
+
+static const _ExtendedGDBusMethodInfo * const _connman_proxy_counter_method_info_pointers[] =
+{
+  &_connman_proxy_counter_method_info_release,
+  &_connman_proxy_counter_method_info_usage,
+  NULL
+};
+
+static const _ExtendedGDBusInterfaceInfo _connman_proxy_counter_interface_info =
+{
+  {
+    -1,
+    "net.connman.Counter",
+    (GDBusMethodInfo **) &_connman_proxy_counter_method_info_pointers,
+    NULL,
+    NULL,
+    NULL
+  },
+  "counter",
+};
+
+
+/**
+ * connman_proxy_counter_interface_info:
+ *
+ * Gets a machine-readable description of the <link linkend="gdbus-interface-net-connman-Counter.top_of_page">net.connman.Counter</link> D-Bus interface.
+ *
+ * Returns: (transfer none): A #GDBusInterfaceInfo. Do not free.
+ */
+GDBusInterfaceInfo *
+connman_proxy_counter_interface_info (void)
+{
+  return (GDBusInterfaceInfo *) &_connman_proxy_counter_interface_info;
+}
+
+/**
+ * connman_proxy_counter_override_properties:
+ * @klass: The class structure for a #GObject<!-- -->-derived class.
+ * @property_id_begin: The property id to assign to the first overridden property.
+ *
+ * Overrides all #GObject properties in the #ConnmanProxyCounter interface for a concrete class.
+ * The properties are overridden in the order they are defined.
+ *
+ * Returns: The last property id.
+ */
+guint
+connman_proxy_counter_override_properties (GObjectClass *klass, guint property_id_begin)
+{
+  return property_id_begin - 1;
+}
+
+
+
+/**
+ * ConnmanProxyCounter:
+ *
+ * Abstract interface type for the D-Bus interface <link linkend="gdbus-interface-net-connman-Counter.top_of_page">net.connman.Counter</link>.
+ */
+
+/**
+ * ConnmanProxyCounterIface:
+ * @parent_iface: The parent interface.
+ * @handle_release: Handler for the #ConnmanProxyCounter::handle-release signal.
+ * @handle_usage: Handler for the #ConnmanProxyCounter::handle-usage signal.
+ *
+ * Virtual table for the D-Bus interface <link linkend="gdbus-interface-net-connman-Counter.top_of_page">net.connman.Counter</link>.
+ */
+
+static void
+connman_proxy_counter_default_init (ConnmanProxyCounterIface *iface)
+{
+  /* GObject signals for incoming D-Bus method calls: */
+  /**
+   * ConnmanProxyCounter::handle-release:
+   * @object: A #ConnmanProxyCounter.
+   * @invocation: A #GDBusMethodInvocation.
+   *
+   * Signal emitted when a remote caller is invoking the <link linkend="gdbus-method-net-connman-Counter.Release">Release()</link> D-Bus method.
+   *
+   * If a signal handler returns %TRUE, it means the signal handler will handle the invocation (e.g. take a reference to @invocation and eventually call connman_proxy_counter_complete_release() or e.g. g_dbus_method_invocation_return_error() on it) and no order signal handlers will run. If no signal handler handles the invocation, the %G_DBUS_ERROR_UNKNOWN_METHOD error is returned.
+   *
+   * Returns: %TRUE if the invocation was handled, %FALSE to let other signal handlers run.
+   */
+  g_signal_new ("handle-release",
+    G_TYPE_FROM_INTERFACE (iface),
+    G_SIGNAL_RUN_LAST,
+    G_STRUCT_OFFSET (ConnmanProxyCounterIface, handle_release),
+    g_signal_accumulator_true_handled,
+    NULL,
+    g_cclosure_marshal_generic,
+    G_TYPE_BOOLEAN,
+    1,
+    G_TYPE_DBUS_METHOD_INVOCATION);
+
+  /**
+   * ConnmanProxyCounter::handle-usage:
+   * @object: A #ConnmanProxyCounter.
+   * @invocation: A #GDBusMethodInvocation.
+   * @arg_unnamed_arg0: Argument passed by remote caller.
+   * @arg_unnamed_arg1: Argument passed by remote caller.
+   * @arg_unnamed_arg2: Argument passed by remote caller.
+   *
+   * Signal emitted when a remote caller is invoking the <link linkend="gdbus-method-net-connman-Counter.Usage">Usage()</link> D-Bus method.
+   *
+   * If a signal handler returns %TRUE, it means the signal handler will handle the invocation (e.g. take a reference to @invocation and eventually call connman_proxy_counter_complete_usage() or e.g. g_dbus_method_invocation_return_error() on it) and no order signal handlers will run. If no signal handler handles the invocation, the %G_DBUS_ERROR_UNKNOWN_METHOD error is returned.
+   *
+   * Returns: %TRUE if the invocation was handled, %FALSE to let other signal handlers run.
+   */
+  g_signal_new ("handle-usage",
+    G_TYPE_FROM_INTERFACE (iface),
+    G_SIGNAL_RUN_LAST,
+    G_STRUCT_OFFSET (ConnmanProxyCounterIface, handle_usage),
+    g_signal_accumulator_true_handled,
+    NULL,
+    g_cclosure_marshal_generic,
+    G_TYPE_BOOLEAN,
+    4,
+    G_TYPE_DBUS_METHOD_INVOCATION, G_TYPE_STRING, G_TYPE_VARIANT, G_TYPE_VARIANT);
+
+}
+
+typedef ConnmanProxyCounterIface ConnmanProxyCounterInterface;
+G_DEFINE_INTERFACE (ConnmanProxyCounter, connman_proxy_counter, G_TYPE_OBJECT);
+
+/**
+ * connman_proxy_counter_call_release:
+ * @proxy: A #ConnmanProxyCounterProxy.
+ * @cancellable: (allow-none): A #GCancellable or %NULL.
+ * @callback: A #GAsyncReadyCallback to call when the request is satisfied or %NULL.
+ * @user_data: User data to pass to @callback.
+ *
+ * Asynchronously invokes the <link linkend="gdbus-method-net-connman-Counter.Release">Release()</link> D-Bus method on @proxy.
+ * When the operation is finished, @callback will be invoked in the <link linkend="g-main-context-push-thread-default">thread-default main loop</link> of the thread you are calling this method from.
+ * You can then call connman_proxy_counter_call_release_finish() to get the result of the operation.
+ *
+ * See connman_proxy_counter_call_release_sync() for the synchronous, blocking version of this method.
+ */
+void
+connman_proxy_counter_call_release (
+    ConnmanProxyCounter *proxy,
+    GCancellable *cancellable,
+    GAsyncReadyCallback callback,
+    gpointer user_data)
+{
+  g_dbus_proxy_call (G_DBUS_PROXY (proxy),
+    "Release",
+    g_variant_new ("()"),
+    G_DBUS_CALL_FLAGS_NONE,
+    -1,
+    cancellable,
+    callback,
+    user_data);
+}
+
+/**
+ * connman_proxy_counter_call_release_finish:
+ * @proxy: A #ConnmanProxyCounterProxy.
+ * @res: The #GAsyncResult obtained from the #GAsyncReadyCallback passed to connman_proxy_counter_call_release().
+ * @error: Return location for error or %NULL.
+ *
+ * Finishes an operation started with connman_proxy_counter_call_release().
+ *
+ * Returns: (skip): %TRUE if the call succeded, %FALSE if @error is set.
+ */
+gboolean
+connman_proxy_counter_call_release_finish (
+    ConnmanProxyCounter *proxy,
+    GAsyncResult *res,
+    GError **error)
+{
+  GVariant *_ret;
+  _ret = g_dbus_proxy_call_finish (G_DBUS_PROXY (proxy), res, error);
+  if (_ret == NULL)
+    goto _out;
+  g_variant_get (_ret,
+                 "()");
+  g_variant_unref (_ret);
+_out:
+  return _ret != NULL;
+}
+
+/**
+ * connman_proxy_counter_call_release_sync:
+ * @proxy: A #ConnmanProxyCounterProxy.
+ * @cancellable: (allow-none): A #GCancellable or %NULL.
+ * @error: Return location for error or %NULL.
+ *
+ * Synchronously invokes the <link linkend="gdbus-method-net-connman-Counter.Release">Release()</link> D-Bus method on @proxy. The calling thread is blocked until a reply is received.
+ *
+ * See connman_proxy_counter_call_release() for the asynchronous version of this method.
+ *
+ * Returns: (skip): %TRUE if the call succeded, %FALSE if @error is set.
+ */
+gboolean
+connman_proxy_counter_call_release_sync (
+    ConnmanProxyCounter *proxy,
+    GCancellable *cancellable,
+    GError **error)
+{
+  GVariant *_ret;
+  _ret = g_dbus_proxy_call_sync (G_DBUS_PROXY (proxy),
+    "Release",
+    g_variant_new ("()"),
+    G_DBUS_CALL_FLAGS_NONE,
+    -1,
+    cancellable,
+    error);
+  if (_ret == NULL)
+    goto _out;
+  g_variant_get (_ret,
+                 "()");
+  g_variant_unref (_ret);
+_out:
+  return _ret != NULL;
+}
+
+/**
+ * connman_proxy_counter_call_usage:
+ * @proxy: A #ConnmanProxyCounterProxy.
+ * @arg_unnamed_arg0: Argument to pass with the method invocation.
+ * @arg_unnamed_arg1: Argument to pass with the method invocation.
+ * @arg_unnamed_arg2: Argument to pass with the method invocation.
+ * @cancellable: (allow-none): A #GCancellable or %NULL.
+ * @callback: A #GAsyncReadyCallback to call when the request is satisfied or %NULL.
+ * @user_data: User data to pass to @callback.
+ *
+ * Asynchronously invokes the <link linkend="gdbus-method-net-connman-Counter.Usage">Usage()</link> D-Bus method on @proxy.
+ * When the operation is finished, @callback will be invoked in the <link linkend="g-main-context-push-thread-default">thread-default main loop</link> of the thread you are calling this method from.
+ * You can then call connman_proxy_counter_call_usage_finish() to get the result of the operation.
+ *
+ * See connman_proxy_counter_call_usage_sync() for the synchronous, blocking version of this method.
+ */
+void
+connman_proxy_counter_call_usage (
+    ConnmanProxyCounter *proxy,
+    const gchar *arg_unnamed_arg0,
+    GVariant *arg_unnamed_arg1,
+    GVariant *arg_unnamed_arg2,
+    GCancellable *cancellable,
+    GAsyncReadyCallback callback,
+    gpointer user_data)
+{
+  g_dbus_proxy_call (G_DBUS_PROXY (proxy),
+    "Usage",
+    g_variant_new ("(o@a{sv}@a{sv})",
+                   arg_unnamed_arg0,
+                   arg_unnamed_arg1,
+                   arg_unnamed_arg2),
+    G_DBUS_CALL_FLAGS_NONE,
+    -1,
+    cancellable,
+    callback,
+    user_data);
+}
+
+/**
+ * connman_proxy_counter_call_usage_finish:
+ * @proxy: A #ConnmanProxyCounterProxy.
+ * @res: The #GAsyncResult obtained from the #GAsyncReadyCallback passed to connman_proxy_counter_call_usage().
+ * @error: Return location for error or %NULL.
+ *
+ * Finishes an operation started with connman_proxy_counter_call_usage().
+ *
+ * Returns: (skip): %TRUE if the call succeded, %FALSE if @error is set.
+ */
+gboolean
+connman_proxy_counter_call_usage_finish (
+    ConnmanProxyCounter *proxy,
+    GAsyncResult *res,
+    GError **error)
+{
+  GVariant *_ret;
+  _ret = g_dbus_proxy_call_finish (G_DBUS_PROXY (proxy), res, error);
+  if (_ret == NULL)
+    goto _out;
+  g_variant_get (_ret,
+                 "()");
+  g_variant_unref (_ret);
+_out:
+  return _ret != NULL;
+}
+
+/**
+ * connman_proxy_counter_call_usage_sync:
+ * @proxy: A #ConnmanProxyCounterProxy.
+ * @arg_unnamed_arg0: Argument to pass with the method invocation.
+ * @arg_unnamed_arg1: Argument to pass with the method invocation.
+ * @arg_unnamed_arg2: Argument to pass with the method invocation.
+ * @cancellable: (allow-none): A #GCancellable or %NULL.
+ * @error: Return location for error or %NULL.
+ *
+ * Synchronously invokes the <link linkend="gdbus-method-net-connman-Counter.Usage">Usage()</link> D-Bus method on @proxy. The calling thread is blocked until a reply is received.
+ *
+ * See connman_proxy_counter_call_usage() for the asynchronous version of this method.
+ *
+ * Returns: (skip): %TRUE if the call succeded, %FALSE if @error is set.
+ */
+gboolean
+connman_proxy_counter_call_usage_sync (
+    ConnmanProxyCounter *proxy,
+    const gchar *arg_unnamed_arg0,
+    GVariant *arg_unnamed_arg1,
+    GVariant *arg_unnamed_arg2,
+    GCancellable *cancellable,
+    GError **error)
+{
+  GVariant *_ret;
+  _ret = g_dbus_proxy_call_sync (G_DBUS_PROXY (proxy),
+    "Usage",
+    g_variant_new ("(o@a{sv}@a{sv})",
+                   arg_unnamed_arg0,
+                   arg_unnamed_arg1,
+                   arg_unnamed_arg2),
+    G_DBUS_CALL_FLAGS_NONE,
+    -1,
+    cancellable,
+    error);
+  if (_ret == NULL)
+    goto _out;
+  g_variant_get (_ret,
+                 "()");
+  g_variant_unref (_ret);
+_out:
+  return _ret != NULL;
+}
+
+/**
+ * connman_proxy_counter_complete_release:
+ * @object: A #ConnmanProxyCounter.
+ * @invocation: (transfer full): A #GDBusMethodInvocation.
+ *
+ * Helper function used in service implementations to finish handling invocations of the <link linkend="gdbus-method-net-connman-Counter.Release">Release()</link> D-Bus method. If you instead want to finish handling an invocation by returning an error, use g_dbus_method_invocation_return_error() or similar.
+ *
+ * This method will free @invocation, you cannot use it afterwards.
+ */
+void
+connman_proxy_counter_complete_release (
+    ConnmanProxyCounter *object,
+    GDBusMethodInvocation *invocation)
+{
+  g_dbus_method_invocation_return_value (invocation,
+    g_variant_new ("()"));
+}
+
+/**
+ * connman_proxy_counter_complete_usage:
+ * @object: A #ConnmanProxyCounter.
+ * @invocation: (transfer full): A #GDBusMethodInvocation.
+ *
+ * Helper function used in service implementations to finish handling invocations of the <link linkend="gdbus-method-net-connman-Counter.Usage">Usage()</link> D-Bus method. If you instead want to finish handling an invocation by returning an error, use g_dbus_method_invocation_return_error() or similar.
+ *
+ * This method will free @invocation, you cannot use it afterwards.
+ */
+void
+connman_proxy_counter_complete_usage (
+    ConnmanProxyCounter *object,
+    GDBusMethodInvocation *invocation)
+{
+  g_dbus_method_invocation_return_value (invocation,
+    g_variant_new ("()"));
+}
+
+/* ------------------------------------------------------------------------ */
+
+/**
+ * ConnmanProxyCounterProxy:
+ *
+ * The #ConnmanProxyCounterProxy structure contains only private data and should only be accessed using the provided API.
+ */
+
+/**
+ * ConnmanProxyCounterProxyClass:
+ * @parent_class: The parent class.
+ *
+ * Class structure for #ConnmanProxyCounterProxy.
+ */
+
+struct _ConnmanProxyCounterProxyPrivate
+{
+  GData *qdata;
+};
+
+static void connman_proxy_counter_proxy_iface_init (ConnmanProxyCounterIface *iface);
+
+G_DEFINE_TYPE_WITH_CODE (ConnmanProxyCounterProxy, connman_proxy_counter_proxy, G_TYPE_DBUS_PROXY,
+                         G_IMPLEMENT_INTERFACE (CONNMAN_PROXY_TYPE_COUNTER, connman_proxy_counter_proxy_iface_init));
+
+static void
+connman_proxy_counter_proxy_finalize (GObject *object)
+{
+  ConnmanProxyCounterProxy *proxy = CONNMAN_PROXY_COUNTER_PROXY (object);
+  g_datalist_clear (&proxy->priv->qdata);
+  G_OBJECT_CLASS (connman_proxy_counter_proxy_parent_class)->finalize (object);
+}
+
+static void
+connman_proxy_counter_proxy_get_property (GObject      *object,
+  guint         prop_id,
+  GValue       *value,
+  GParamSpec   *pspec)
+{
+}
+
+static void
+connman_proxy_counter_proxy_set_property (GObject      *object,
+  guint         prop_id,
+  const GValue *value,
+  GParamSpec   *pspec)
+{
+}
+
+static void
+connman_proxy_counter_proxy_g_signal (GDBusProxy *proxy,
+  const gchar *sender_name,
+  const gchar *signal_name,
+  GVariant *parameters)
+{
+  _ExtendedGDBusSignalInfo *info;
+  GVariantIter iter;
+  GVariant *child;
+  GValue *paramv;
+  guint num_params;
+  guint n;
+  guint signal_id;
+  info = (_ExtendedGDBusSignalInfo *) g_dbus_interface_info_lookup_signal ((GDBusInterfaceInfo *) &_connman_proxy_counter_interface_info, signal_name);
+  if (info == NULL)
+    return;
+  num_params = g_variant_n_children (parameters);
+  paramv = g_new0 (GValue, num_params + 1);
+  g_value_init (&paramv[0], CONNMAN_PROXY_TYPE_COUNTER);
+  g_value_set_object (&paramv[0], proxy);
+  g_variant_iter_init (&iter, parameters);
+  n = 1;
+  while ((child = g_variant_iter_next_value (&iter)) != NULL)
+    {
+      _ExtendedGDBusArgInfo *arg_info = (_ExtendedGDBusArgInfo *) info->parent_struct.args[n - 1];
+      if (arg_info->use_gvariant)
+        {
+          g_value_init (&paramv[n], G_TYPE_VARIANT);
+          g_value_set_variant (&paramv[n], child);
+          n++;
+        }
+      else
+        g_dbus_gvariant_to_gvalue (child, &paramv[n++]);
+      g_variant_unref (child);
+    }
+  signal_id = g_signal_lookup (info->signal_name, CONNMAN_PROXY_TYPE_COUNTER);
+  g_signal_emitv (paramv, signal_id, 0, NULL);
+  for (n = 0; n < num_params + 1; n++)
+    g_value_unset (&paramv[n]);
+  g_free (paramv);
+}
+
+static void
+connman_proxy_counter_proxy_g_properties_changed (GDBusProxy *_proxy,
+  GVariant *changed_properties,
+  const gchar *const *invalidated_properties)
+{
+  ConnmanProxyCounterProxy *proxy = CONNMAN_PROXY_COUNTER_PROXY (_proxy);
+  guint n;
+  const gchar *key;
+  GVariantIter *iter;
+  _ExtendedGDBusPropertyInfo *info;
+  g_variant_get (changed_properties, "a{sv}", &iter);
+  while (g_variant_iter_next (iter, "{&sv}", &key, NULL))
+    {
+      info = (_ExtendedGDBusPropertyInfo *) g_dbus_interface_info_lookup_property ((GDBusInterfaceInfo *) &_connman_proxy_counter_interface_info, key);
+      g_datalist_remove_data (&proxy->priv->qdata, key);
+      if (info != NULL)
+        g_object_notify (G_OBJECT (proxy), info->hyphen_name);
+    }
+  g_variant_iter_free (iter);
+  for (n = 0; invalidated_properties[n] != NULL; n++)
+    {
+      info = (_ExtendedGDBusPropertyInfo *) g_dbus_interface_info_lookup_property ((GDBusInterfaceInfo *) &_connman_proxy_counter_interface_info, invalidated_properties[n]);
+      g_datalist_remove_data (&proxy->priv->qdata, invalidated_properties[n]);
+      if (info != NULL)
+        g_object_notify (G_OBJECT (proxy), info->hyphen_name);
+    }
+}
+
+static void
+connman_proxy_counter_proxy_init (ConnmanProxyCounterProxy *proxy)
+{
+  proxy->priv = G_TYPE_INSTANCE_GET_PRIVATE (proxy, CONNMAN_PROXY_TYPE_COUNTER_PROXY, ConnmanProxyCounterProxyPrivate);
+  g_dbus_proxy_set_interface_info (G_DBUS_PROXY (proxy), connman_proxy_counter_interface_info ());
+}
+
+static void
+connman_proxy_counter_proxy_class_init (ConnmanProxyCounterProxyClass *klass)
+{
+  GObjectClass *gobject_class;
+  GDBusProxyClass *proxy_class;
+
+  g_type_class_add_private (klass, sizeof (ConnmanProxyCounterProxyPrivate));
+
+  gobject_class = G_OBJECT_CLASS (klass);
+  gobject_class->finalize     = connman_proxy_counter_proxy_finalize;
+  gobject_class->get_property = connman_proxy_counter_proxy_get_property;
+  gobject_class->set_property = connman_proxy_counter_proxy_set_property;
+
+  proxy_class = G_DBUS_PROXY_CLASS (klass);
+  proxy_class->g_signal = connman_proxy_counter_proxy_g_signal;
+  proxy_class->g_properties_changed = connman_proxy_counter_proxy_g_properties_changed;
+
+}
+
+static void
+connman_proxy_counter_proxy_iface_init (ConnmanProxyCounterIface *iface)
+{
+}
+
+/**
+ * connman_proxy_counter_proxy_new:
+ * @connection: A #GDBusConnection.
+ * @flags: Flags from the #GDBusProxyFlags enumeration.
+ * @name: (allow-none): A bus name (well-known or unique) or %NULL if @connection is not a message bus connection.
+ * @object_path: An object path.
+ * @cancellable: (allow-none): A #GCancellable or %NULL.
+ * @callback: A #GAsyncReadyCallback to call when the request is satisfied.
+ * @user_data: User data to pass to @callback.
+ *
+ * Asynchronously creates a proxy for the D-Bus interface <link linkend="gdbus-interface-net-connman-Counter.top_of_page">net.connman.Counter</link>. See g_dbus_proxy_new() for more details.
+ *
+ * When the operation is finished, @callback will be invoked in the <link linkend="g-main-context-push-thread-default">thread-default main loop</link> of the thread you are calling this method from.
+ * You can then call connman_proxy_counter_proxy_new_finish() to get the result of the operation.
+ *
+ * See connman_proxy_counter_proxy_new_sync() for the synchronous, blocking version of this constructor.
+ */
+void
+connman_proxy_counter_proxy_new (
+    GDBusConnection     *connection,
+    GDBusProxyFlags      flags,
+    const gchar         *name,
+    const gchar         *object_path,
+    GCancellable        *cancellable,
+    GAsyncReadyCallback  callback,
+    gpointer             user_data)
+{
+  g_async_initable_new_async (CONNMAN_PROXY_TYPE_COUNTER_PROXY, G_PRIORITY_DEFAULT, cancellable, callback, user_data, "g-flags", flags, "g-name", name, "g-connection", connection, "g-object-path", object_path, "g-interface-name", "net.connman.Counter", NULL);
+}
+
+/**
+ * connman_proxy_counter_proxy_new_finish:
+ * @res: The #GAsyncResult obtained from the #GAsyncReadyCallback passed to connman_proxy_counter_proxy_new().
+ * @error: Return location for error or %NULL
+ *
+ * Finishes an operation started with connman_proxy_counter_proxy_new().
+ *
+ * Returns: (transfer full) (type ConnmanProxyCounterProxy): The constructed proxy object or %NULL if @error is set.
+ */
+ConnmanProxyCounter *
+connman_proxy_counter_proxy_new_finish (
+    GAsyncResult        *res,
+    GError             **error)
+{
+  GObject *ret;
+  GObject *source_object;
+  source_object = g_async_result_get_source_object (res);
+  ret = g_async_initable_new_finish (G_ASYNC_INITABLE (source_object), res, error);
+  g_object_unref (source_object);
+  if (ret != NULL)
+    return CONNMAN_PROXY_COUNTER (ret);
+  else
+    return NULL;
+}
+
+/**
+ * connman_proxy_counter_proxy_new_sync:
+ * @connection: A #GDBusConnection.
+ * @flags: Flags from the #GDBusProxyFlags enumeration.
+ * @name: (allow-none): A bus name (well-known or unique) or %NULL if @connection is not a message bus connection.
+ * @object_path: An object path.
+ * @cancellable: (allow-none): A #GCancellable or %NULL.
+ * @error: Return location for error or %NULL
+ *
+ * Synchronously creates a proxy for the D-Bus interface <link linkend="gdbus-interface-net-connman-Counter.top_of_page">net.connman.Counter</link>. See g_dbus_proxy_new_sync() for more details.
+ *
+ * The calling thread is blocked until a reply is received.
+ *
+ * See connman_proxy_counter_proxy_new() for the asynchronous version of this constructor.
+ *
+ * Returns: (transfer full) (type ConnmanProxyCounterProxy): The constructed proxy object or %NULL if @error is set.
+ */
+ConnmanProxyCounter *
+connman_proxy_counter_proxy_new_sync (
+    GDBusConnection     *connection,
+    GDBusProxyFlags      flags,
+    const gchar         *name,
+    const gchar         *object_path,
+    GCancellable        *cancellable,
+    GError             **error)
+{
+  GInitable *ret;
+  ret = g_initable_new (CONNMAN_PROXY_TYPE_COUNTER_PROXY, cancellable, error, "g-flags", flags, "g-name", name, "g-connection", connection, "g-object-path", object_path, "g-interface-name", "net.connman.Counter", NULL);
+  if (ret != NULL)
+    return CONNMAN_PROXY_COUNTER (ret);
+  else
+    return NULL;
+}
+
+
+/**
+ * connman_proxy_counter_proxy_new_for_bus:
+ * @bus_type: A #GBusType.
+ * @flags: Flags from the #GDBusProxyFlags enumeration.
+ * @name: A bus name (well-known or unique).
+ * @object_path: An object path.
+ * @cancellable: (allow-none): A #GCancellable or %NULL.
+ * @callback: A #GAsyncReadyCallback to call when the request is satisfied.
+ * @user_data: User data to pass to @callback.
+ *
+ * Like connman_proxy_counter_proxy_new() but takes a #GBusType instead of a #GDBusConnection.
+ *
+ * When the operation is finished, @callback will be invoked in the <link linkend="g-main-context-push-thread-default">thread-default main loop</link> of the thread you are calling this method from.
+ * You can then call connman_proxy_counter_proxy_new_for_bus_finish() to get the result of the operation.
+ *
+ * See connman_proxy_counter_proxy_new_for_bus_sync() for the synchronous, blocking version of this constructor.
+ */
+void
+connman_proxy_counter_proxy_new_for_bus (
+    GBusType             bus_type,
+    GDBusProxyFlags      flags,
+    const gchar         *name,
+    const gchar         *object_path,
+    GCancellable        *cancellable,
+    GAsyncReadyCallback  callback,
+    gpointer             user_data)
+{
+  g_async_initable_new_async (CONNMAN_PROXY_TYPE_COUNTER_PROXY, G_PRIORITY_DEFAULT, cancellable, callback, user_data, "g-flags", flags, "g-name", name, "g-bus-type", bus_type, "g-object-path", object_path, "g-interface-name", "net.connman.Counter", NULL);
+}
+
+/**
+ * connman_proxy_counter_proxy_new_for_bus_finish:
+ * @res: The #GAsyncResult obtained from the #GAsyncReadyCallback passed to connman_proxy_counter_proxy_new_for_bus().
+ * @error: Return location for error or %NULL
+ *
+ * Finishes an operation started with connman_proxy_counter_proxy_new_for_bus().
+ *
+ * Returns: (transfer full) (type ConnmanProxyCounterProxy): The constructed proxy object or %NULL if @error is set.
+ */
+ConnmanProxyCounter *
+connman_proxy_counter_proxy_new_for_bus_finish (
+    GAsyncResult        *res,
+    GError             **error)
+{
+  GObject *ret;
+  GObject *source_object;
+  source_object = g_async_result_get_source_object (res);
+  ret = g_async_initable_new_finish (G_ASYNC_INITABLE (source_object), res, error);
+  g_object_unref (source_object);
+  if (ret != NULL)
+    return CONNMAN_PROXY_COUNTER (ret);
+  else
+    return NULL;
+}
+
+/**
+ * connman_proxy_counter_proxy_new_for_bus_sync:
+ * @bus_type: A #GBusType.
+ * @flags: Flags from the #GDBusProxyFlags enumeration.
+ * @name: A bus name (well-known or unique).
+ * @object_path: An object path.
+ * @cancellable: (allow-none): A #GCancellable or %NULL.
+ * @error: Return location for error or %NULL
+ *
+ * Like connman_proxy_counter_proxy_new_sync() but takes a #GBusType instead of a #GDBusConnection.
+ *
+ * The calling thread is blocked until a reply is received.
+ *
+ * See connman_proxy_counter_proxy_new_for_bus() for the asynchronous version of this constructor.
+ *
+ * Returns: (transfer full) (type ConnmanProxyCounterProxy): The constructed proxy object or %NULL if @error is set.
+ */
+ConnmanProxyCounter *
+connman_proxy_counter_proxy_new_for_bus_sync (
+    GBusType             bus_type,
+    GDBusProxyFlags      flags,
+    const gchar         *name,
+    const gchar         *object_path,
+    GCancellable        *cancellable,
+    GError             **error)
+{
+  GInitable *ret;
+  ret = g_initable_new (CONNMAN_PROXY_TYPE_COUNTER_PROXY, cancellable, error, "g-flags", flags, "g-name", name, "g-bus-type", bus_type, "g-object-path", object_path, "g-interface-name", "net.connman.Counter", NULL);
+  if (ret != NULL)
+    return CONNMAN_PROXY_COUNTER (ret);
+  else
+    return NULL;
+}
+
+
+/* ------------------------------------------------------------------------ */
+
+/**
+ * ConnmanProxyCounterSkeleton:
+ *
+ * The #ConnmanProxyCounterSkeleton structure contains only private data and should only be accessed using the provided API.
+ */
+
+/**
+ * ConnmanProxyCounterSkeletonClass:
+ * @parent_class: The parent class.
+ *
+ * Class structure for #ConnmanProxyCounterSkeleton.
+ */
+
+struct _ConnmanProxyCounterSkeletonPrivate
+{
+  GValueArray *properties;
+  GList *changed_properties;
+  GSource *changed_properties_idle_source;
+  GMainContext *context;
+  GMutex *lock;
+};
+
+static void
+_connman_proxy_counter_skeleton_handle_method_call (
+  GDBusConnection *connection,
+  const gchar *sender,
+  const gchar *object_path,
+  const gchar *interface_name,
+  const gchar *method_name,
+  GVariant *parameters,
+  GDBusMethodInvocation *invocation,
+  gpointer user_data)
+{
+  ConnmanProxyCounterSkeleton *skeleton = CONNMAN_PROXY_COUNTER_SKELETON (user_data);
+  _ExtendedGDBusMethodInfo *info;
+  GVariantIter iter;
+  GVariant *child;
+  GValue *paramv;
+  guint num_params;
+  guint num_extra;
+  guint n;
+  guint signal_id;
+  GValue return_value = {0};
+  info = (_ExtendedGDBusMethodInfo *) g_dbus_method_invocation_get_method_info (invocation);
+  g_assert (info != NULL);
+  num_params = g_variant_n_children (parameters);
+  num_extra = info->pass_fdlist ? 3 : 2;  paramv = g_new0 (GValue, num_params + num_extra);
+  n = 0;
+  g_value_init (&paramv[n], CONNMAN_PROXY_TYPE_COUNTER);
+  g_value_set_object (&paramv[n++], skeleton);
+  g_value_init (&paramv[n], G_TYPE_DBUS_METHOD_INVOCATION);
+  g_value_set_object (&paramv[n++], invocation);
+  if (info->pass_fdlist)
+    {
+#ifdef G_OS_UNIX
+      g_value_init (&paramv[n], G_TYPE_UNIX_FD_LIST);
+      g_value_set_object (&paramv[n++], g_dbus_message_get_unix_fd_list (g_dbus_method_invocation_get_message (invocation)));
+#else
+      g_assert_not_reached ();
+#endif
+    }
+  g_variant_iter_init (&iter, parameters);
+  while ((child = g_variant_iter_next_value (&iter)) != NULL)
+    {
+      _ExtendedGDBusArgInfo *arg_info = (_ExtendedGDBusArgInfo *) info->parent_struct.in_args[n - num_extra];
+      if (arg_info->use_gvariant)
+        {
+          g_value_init (&paramv[n], G_TYPE_VARIANT);
+          g_value_set_variant (&paramv[n], child);
+          n++;
+        }
+      else
+        g_dbus_gvariant_to_gvalue (child, &paramv[n++]);
+      g_variant_unref (child);
+    }
+  signal_id = g_signal_lookup (info->signal_name, CONNMAN_PROXY_TYPE_COUNTER);
+  g_value_init (&return_value, G_TYPE_BOOLEAN);
+  g_signal_emitv (paramv, signal_id, 0, &return_value);
+  if (!g_value_get_boolean (&return_value))
+    g_dbus_method_invocation_return_error (invocation, G_DBUS_ERROR, G_DBUS_ERROR_UNKNOWN_METHOD, "Method %s is not implemented on interface %s", method_name, interface_name);
+  g_value_unset (&return_value);
+  for (n = 0; n < num_params + num_extra; n++)
+    g_value_unset (&paramv[n]);
+  g_free (paramv);
+}
+
+static GVariant *
+_connman_proxy_counter_skeleton_handle_get_property (
+  GDBusConnection *connection,
+  const gchar *sender,
+  const gchar *object_path,
+  const gchar *interface_name,
+  const gchar *property_name,
+  GError **error,
+  gpointer user_data)
+{
+  ConnmanProxyCounterSkeleton *skeleton = CONNMAN_PROXY_COUNTER_SKELETON (user_data);
+  GValue value = {0};
+  GParamSpec *pspec;
+  _ExtendedGDBusPropertyInfo *info;
+  GVariant *ret;
+  ret = NULL;
+  info = (_ExtendedGDBusPropertyInfo *) g_dbus_interface_info_lookup_property ((GDBusInterfaceInfo *) &_connman_proxy_counter_interface_info, property_name);
+  g_assert (info != NULL);
+  pspec = g_object_class_find_property (G_OBJECT_GET_CLASS (skeleton), info->hyphen_name);
+  if (pspec == NULL)
+    {
+      g_set_error (error, G_DBUS_ERROR, G_DBUS_ERROR_INVALID_ARGS, "No property with name %s", property_name);
+    }
+  else
+    {
+      g_value_init (&value, pspec->value_type);
+      g_object_get_property (G_OBJECT (skeleton), info->hyphen_name, &value);
+      ret = g_dbus_gvalue_to_gvariant (&value, G_VARIANT_TYPE (info->parent_struct.signature));
+      g_value_unset (&value);
+    }
+  return ret;
+}
+
+static gboolean
+_connman_proxy_counter_skeleton_handle_set_property (
+  GDBusConnection *connection,
+  const gchar *sender,
+  const gchar *object_path,
+  const gchar *interface_name,
+  const gchar *property_name,
+  GVariant *variant,
+  GError **error,
+  gpointer user_data)
+{
+  ConnmanProxyCounterSkeleton *skeleton = CONNMAN_PROXY_COUNTER_SKELETON (user_data);
+  GValue value = {0};
+  GParamSpec *pspec;
+  _ExtendedGDBusPropertyInfo *info;
+  gboolean ret;
+  ret = FALSE;
+  info = (_ExtendedGDBusPropertyInfo *) g_dbus_interface_info_lookup_property ((GDBusInterfaceInfo *) &_connman_proxy_counter_interface_info, property_name);
+  g_assert (info != NULL);
+  pspec = g_object_class_find_property (G_OBJECT_GET_CLASS (skeleton), info->hyphen_name);
+  if (pspec == NULL)
+    {
+      g_set_error (error, G_DBUS_ERROR, G_DBUS_ERROR_INVALID_ARGS, "No property with name %s", property_name);
+    }
+  else
+    {
+      if (info->use_gvariant)
+        g_value_set_variant (&value, variant);
+      else
+        g_dbus_gvariant_to_gvalue (variant, &value);
+      g_object_set_property (G_OBJECT (skeleton), info->hyphen_name, &value);
+      g_value_unset (&value);
+      ret = TRUE;
+    }
+  return ret;
+}
+
+static const GDBusInterfaceVTable _connman_proxy_counter_skeleton_vtable =
+{
+  _connman_proxy_counter_skeleton_handle_method_call,
+  _connman_proxy_counter_skeleton_handle_get_property,
+  _connman_proxy_counter_skeleton_handle_set_property
+};
+
+static GDBusInterfaceInfo *
+connman_proxy_counter_skeleton_dbus_interface_get_info (GDBusInterfaceSkeleton *skeleton)
+{
+  return connman_proxy_counter_interface_info ();
+}
+
+static GDBusInterfaceVTable *
+connman_proxy_counter_skeleton_dbus_interface_get_vtable (GDBusInterfaceSkeleton *skeleton)
+{
+  return (GDBusInterfaceVTable *) &_connman_proxy_counter_skeleton_vtable;
+}
+
+static GVariant *
+connman_proxy_counter_skeleton_dbus_interface_get_properties (GDBusInterfaceSkeleton *_skeleton)
+{
+  ConnmanProxyCounterSkeleton *skeleton = CONNMAN_PROXY_COUNTER_SKELETON (_skeleton);
+
+  GVariantBuilder builder;
+  guint n;
+  g_variant_builder_init (&builder, G_VARIANT_TYPE ("a{sv}"));
+  if (_connman_proxy_counter_interface_info.parent_struct.properties == NULL)
+    goto out;
+  for (n = 0; _connman_proxy_counter_interface_info.parent_struct.properties[n] != NULL; n++)
+    {
+      GDBusPropertyInfo *info = _connman_proxy_counter_interface_info.parent_struct.properties[n];
+      if (info->flags & G_DBUS_PROPERTY_INFO_FLAGS_READABLE)
+        {
+          GVariant *value;
+          value = _connman_proxy_counter_skeleton_handle_get_property (g_dbus_interface_skeleton_get_connection (G_DBUS_INTERFACE_SKELETON (skeleton)), NULL, g_dbus_interface_skeleton_get_object_path (G_DBUS_INTERFACE_SKELETON (skeleton)), "net.connman.Counter", info->name, NULL, skeleton);
+          if (value != NULL)
+            {
+              g_variant_take_ref (value);
+              g_variant_builder_add (&builder, "{sv}", info->name, value);
+              g_variant_unref (value);
+            }
+        }
+    }
+out:
+  return g_variant_builder_end (&builder);
+}
+
+static void
+connman_proxy_counter_skeleton_dbus_interface_flush (GDBusInterfaceSkeleton *_skeleton)
+{
+}
+
+static void connman_proxy_counter_skeleton_iface_init (ConnmanProxyCounterIface *iface);
+G_DEFINE_TYPE_WITH_CODE (ConnmanProxyCounterSkeleton, connman_proxy_counter_skeleton, G_TYPE_DBUS_INTERFACE_SKELETON,
+                         G_IMPLEMENT_INTERFACE (CONNMAN_PROXY_TYPE_COUNTER, connman_proxy_counter_skeleton_iface_init));
+
+static void
+connman_proxy_counter_skeleton_finalize (GObject *object)
+{
+  ConnmanProxyCounterSkeleton *skeleton = CONNMAN_PROXY_COUNTER_SKELETON (object);
+  g_list_foreach (skeleton->priv->changed_properties, (GFunc) _changed_property_free, NULL);
+  g_list_free (skeleton->priv->changed_properties);
+  if (skeleton->priv->changed_properties_idle_source != NULL)
+    g_source_destroy (skeleton->priv->changed_properties_idle_source);
+  if (skeleton->priv->context != NULL)
+    g_main_context_unref (skeleton->priv->context);
+  g_mutex_free (skeleton->priv->lock);
+  G_OBJECT_CLASS (connman_proxy_counter_skeleton_parent_class)->finalize (object);
+}
+
+static void
+connman_proxy_counter_skeleton_init (ConnmanProxyCounterSkeleton *skeleton)
+{
+  skeleton->priv = G_TYPE_INSTANCE_GET_PRIVATE (skeleton, CONNMAN_PROXY_TYPE_COUNTER_SKELETON, ConnmanProxyCounterSkeletonPrivate);
+  skeleton->priv->lock = g_mutex_new ();
+  skeleton->priv->context = g_main_context_get_thread_default ();
+  if (skeleton->priv->context != NULL)
+    g_main_context_ref (skeleton->priv->context);
+}
+
+static void
+connman_proxy_counter_skeleton_class_init (ConnmanProxyCounterSkeletonClass *klass)
+{
+  GObjectClass *gobject_class;
+  GDBusInterfaceSkeletonClass *skeleton_class;
+
+  g_type_class_add_private (klass, sizeof (ConnmanProxyCounterSkeletonPrivate));
+
+  gobject_class = G_OBJECT_CLASS (klass);
+  gobject_class->finalize = connman_proxy_counter_skeleton_finalize;
+
+  skeleton_class = G_DBUS_INTERFACE_SKELETON_CLASS (klass);
+  skeleton_class->get_info = connman_proxy_counter_skeleton_dbus_interface_get_info;
+  skeleton_class->get_properties = connman_proxy_counter_skeleton_dbus_interface_get_properties;
+  skeleton_class->flush = connman_proxy_counter_skeleton_dbus_interface_flush;
+  skeleton_class->get_vtable = connman_proxy_counter_skeleton_dbus_interface_get_vtable;
+}
+
+static void
+connman_proxy_counter_skeleton_iface_init (ConnmanProxyCounterIface *iface)
+{
+}
+
+/**
+ * connman_proxy_counter_skeleton_new:
+ *
+ * Creates a skeleton object for the D-Bus interface <link linkend="gdbus-interface-net-connman-Counter.top_of_page">net.connman.Counter</link>.
+ *
+ * Returns: (transfer full) (type ConnmanProxyCounterSkeleton): The skeleton object.
+ */
+ConnmanProxyCounter *
+connman_proxy_counter_skeleton_new (void)
+{
+  return CONNMAN_PROXY_COUNTER (g_object_new (CONNMAN_PROXY_TYPE_COUNTER_SKELETON, NULL));
+}
+
+/* ------------------------------------------------------------------------
+ * Code for interface net.connman.Session
+ * ------------------------------------------------------------------------
+ */
+
+/**
+ * SECTION:ConnmanProxySession
+ * @title: ConnmanProxySession
+ * @short_description: Generated C code for the net.connman.Session D-Bus interface
+ *
+ * This section contains code for working with the <link linkend="gdbus-interface-net-connman-Session.top_of_page">net.connman.Session</link> D-Bus interface in C.
+ */
+
+/* ---- Introspection data for net.connman.Session ---- */
+
+static const _ExtendedGDBusMethodInfo _connman_proxy_session_method_info_destroy =
+{
+  {
+    -1,
+    "Destroy",
+    NULL,
+    NULL,
+    NULL
+  },
+  "handle-destroy",
+  FALSE
+};
+
+static const _ExtendedGDBusMethodInfo _connman_proxy_session_method_info_connect =
+{
+  {
+    -1,
+    "Connect",
+    NULL,
+    NULL,
+    NULL
+  },
+  "handle-connect",
+  FALSE
+};
+
+static const _ExtendedGDBusMethodInfo _connman_proxy_session_method_info_disconnect =
+{
+  {
+    -1,
+    "Disconnect",
+    NULL,
+    NULL,
+    NULL
+  },
+  "handle-disconnect",
+  FALSE
+};
+
+static const _ExtendedGDBusArgInfo _connman_proxy_session_method_info_change_IN_ARG_unnamed_arg0 =
+{
+  {
+    -1,
+    "unnamed_arg0",
+    "s",
+    NULL
+  },
+  FALSE
+};
+
+static const _ExtendedGDBusArgInfo _connman_proxy_session_method_info_change_IN_ARG_unnamed_arg1 =
+{
+  {
+    -1,
+    "unnamed_arg1",
+    "v",
+    NULL
+  },
+  FALSE
+};
+
+static const _ExtendedGDBusArgInfo * const _connman_proxy_session_method_info_change_IN_ARG_pointers[] =
+{
+  &_connman_proxy_session_method_info_change_IN_ARG_unnamed_arg0,
+  &_connman_proxy_session_method_info_change_IN_ARG_unnamed_arg1,
+  NULL
+};
+
+static const _ExtendedGDBusMethodInfo _connman_proxy_session_method_info_change =
+{
+  {
+    -1,
+    "Change",
+    (GDBusArgInfo **) &_connman_proxy_session_method_info_change_IN_ARG_pointers,
+    NULL,
+    NULL
+  },
+  "handle-change",
+  FALSE
+};
+
+static const _ExtendedGDBusMethodInfo * const _connman_proxy_session_method_info_pointers[] =
+{
+  &_connman_proxy_session_method_info_destroy,
+  &_connman_proxy_session_method_info_connect,
+  &_connman_proxy_session_method_info_disconnect,
+  &_connman_proxy_session_method_info_change,
+  NULL
+};
+
+static const _ExtendedGDBusInterfaceInfo _connman_proxy_session_interface_info =
+{
+  {
+    -1,
+    "net.connman.Session",
+    (GDBusMethodInfo **) &_connman_proxy_session_method_info_pointers,
+    NULL,
+    NULL,
+    NULL
+  },
+  "session",
+};
+
+
+/**
+ * connman_proxy_session_interface_info:
+ *
+ * Gets a machine-readable description of the <link linkend="gdbus-interface-net-connman-Session.top_of_page">net.connman.Session</link> D-Bus interface.
+ *
+ * Returns: (transfer none): A #GDBusInterfaceInfo. Do not free.
+ */
+GDBusInterfaceInfo *
+connman_proxy_session_interface_info (void)
+{
+  return (GDBusInterfaceInfo *) &_connman_proxy_session_interface_info;
+}
+
+/**
+ * connman_proxy_session_override_properties:
+ * @klass: The class structure for a #GObject<!-- -->-derived class.
+ * @property_id_begin: The property id to assign to the first overridden property.
+ *
+ * Overrides all #GObject properties in the #ConnmanProxySession interface for a concrete class.
+ * The properties are overridden in the order they are defined.
+ *
+ * Returns: The last property id.
+ */
+guint
+connman_proxy_session_override_properties (GObjectClass *klass, guint property_id_begin)
+{
+  return property_id_begin - 1;
+}
+
+
+
+/**
+ * ConnmanProxySession:
+ *
+ * Abstract interface type for the D-Bus interface <link linkend="gdbus-interface-net-connman-Session.top_of_page">net.connman.Session</link>.
+ */
+
+/**
+ * ConnmanProxySessionIface:
+ * @parent_iface: The parent interface.
+ * @handle_change: Handler for the #ConnmanProxySession::handle-change signal.
+ * @handle_connect: Handler for the #ConnmanProxySession::handle-connect signal.
+ * @handle_destroy: Handler for the #ConnmanProxySession::handle-destroy signal.
+ * @handle_disconnect: Handler for the #ConnmanProxySession::handle-disconnect signal.
+ *
+ * Virtual table for the D-Bus interface <link linkend="gdbus-interface-net-connman-Session.top_of_page">net.connman.Session</link>.
+ */
+
+static void
+connman_proxy_session_default_init (ConnmanProxySessionIface *iface)
+{
+  /* GObject signals for incoming D-Bus method calls: */
+  /**
+   * ConnmanProxySession::handle-destroy:
+   * @object: A #ConnmanProxySession.
+   * @invocation: A #GDBusMethodInvocation.
+   *
+   * Signal emitted when a remote caller is invoking the <link linkend="gdbus-method-net-connman-Session.Destroy">Destroy()</link> D-Bus method.
+   *
+   * If a signal handler returns %TRUE, it means the signal handler will handle the invocation (e.g. take a reference to @invocation and eventually call connman_proxy_session_complete_destroy() or e.g. g_dbus_method_invocation_return_error() on it) and no order signal handlers will run. If no signal handler handles the invocation, the %G_DBUS_ERROR_UNKNOWN_METHOD error is returned.
+   *
+   * Returns: %TRUE if the invocation was handled, %FALSE to let other signal handlers run.
+   */
+  g_signal_new ("handle-destroy",
+    G_TYPE_FROM_INTERFACE (iface),
+    G_SIGNAL_RUN_LAST,
+    G_STRUCT_OFFSET (ConnmanProxySessionIface, handle_destroy),
+    g_signal_accumulator_true_handled,
+    NULL,
+    g_cclosure_marshal_generic,
+    G_TYPE_BOOLEAN,
+    1,
+    G_TYPE_DBUS_METHOD_INVOCATION);
+
+  /**
+   * ConnmanProxySession::handle-connect:
+   * @object: A #ConnmanProxySession.
+   * @invocation: A #GDBusMethodInvocation.
+   *
+   * Signal emitted when a remote caller is invoking the <link linkend="gdbus-method-net-connman-Session.Connect">Connect()</link> D-Bus method.
+   *
+   * If a signal handler returns %TRUE, it means the signal handler will handle the invocation (e.g. take a reference to @invocation and eventually call connman_proxy_session_complete_connect() or e.g. g_dbus_method_invocation_return_error() on it) and no order signal handlers will run. If no signal handler handles the invocation, the %G_DBUS_ERROR_UNKNOWN_METHOD error is returned.
+   *
+   * Returns: %TRUE if the invocation was handled, %FALSE to let other signal handlers run.
+   */
+  g_signal_new ("handle-connect",
+    G_TYPE_FROM_INTERFACE (iface),
+    G_SIGNAL_RUN_LAST,
+    G_STRUCT_OFFSET (ConnmanProxySessionIface, handle_connect),
+    g_signal_accumulator_true_handled,
+    NULL,
+    g_cclosure_marshal_generic,
+    G_TYPE_BOOLEAN,
+    1,
+    G_TYPE_DBUS_METHOD_INVOCATION);
+
+  /**
+   * ConnmanProxySession::handle-disconnect:
+   * @object: A #ConnmanProxySession.
+   * @invocation: A #GDBusMethodInvocation.
+   *
+   * Signal emitted when a remote caller is invoking the <link linkend="gdbus-method-net-connman-Session.Disconnect">Disconnect()</link> D-Bus method.
+   *
+   * If a signal handler returns %TRUE, it means the signal handler will handle the invocation (e.g. take a reference to @invocation and eventually call connman_proxy_session_complete_disconnect() or e.g. g_dbus_method_invocation_return_error() on it) and no order signal handlers will run. If no signal handler handles the invocation, the %G_DBUS_ERROR_UNKNOWN_METHOD error is returned.
+   *
+   * Returns: %TRUE if the invocation was handled, %FALSE to let other signal handlers run.
+   */
+  g_signal_new ("handle-disconnect",
+    G_TYPE_FROM_INTERFACE (iface),
+    G_SIGNAL_RUN_LAST,
+    G_STRUCT_OFFSET (ConnmanProxySessionIface, handle_disconnect),
+    g_signal_accumulator_true_handled,
+    NULL,
+    g_cclosure_marshal_generic,
+    G_TYPE_BOOLEAN,
+    1,
+    G_TYPE_DBUS_METHOD_INVOCATION);
+
+  /**
+   * ConnmanProxySession::handle-change:
+   * @object: A #ConnmanProxySession.
+   * @invocation: A #GDBusMethodInvocation.
+   * @arg_unnamed_arg0: Argument passed by remote caller.
+   * @arg_unnamed_arg1: Argument passed by remote caller.
+   *
+   * Signal emitted when a remote caller is invoking the <link linkend="gdbus-method-net-connman-Session.Change">Change()</link> D-Bus method.
+   *
+   * If a signal handler returns %TRUE, it means the signal handler will handle the invocation (e.g. take a reference to @invocation and eventually call connman_proxy_session_complete_change() or e.g. g_dbus_method_invocation_return_error() on it) and no order signal handlers will run. If no signal handler handles the invocation, the %G_DBUS_ERROR_UNKNOWN_METHOD error is returned.
+   *
+   * Returns: %TRUE if the invocation was handled, %FALSE to let other signal handlers run.
+   */
+  g_signal_new ("handle-change",
+    G_TYPE_FROM_INTERFACE (iface),
+    G_SIGNAL_RUN_LAST,
+    G_STRUCT_OFFSET (ConnmanProxySessionIface, handle_change),
+    g_signal_accumulator_true_handled,
+    NULL,
+    g_cclosure_marshal_generic,
+    G_TYPE_BOOLEAN,
+    3,
+    G_TYPE_DBUS_METHOD_INVOCATION, G_TYPE_STRING, G_TYPE_VARIANT);
+
+}
+
+typedef ConnmanProxySessionIface ConnmanProxySessionInterface;
+G_DEFINE_INTERFACE (ConnmanProxySession, connman_proxy_session, G_TYPE_OBJECT);
+
+/**
+ * connman_proxy_session_call_destroy:
+ * @proxy: A #ConnmanProxySessionProxy.
+ * @cancellable: (allow-none): A #GCancellable or %NULL.
+ * @callback: A #GAsyncReadyCallback to call when the request is satisfied or %NULL.
+ * @user_data: User data to pass to @callback.
+ *
+ * Asynchronously invokes the <link linkend="gdbus-method-net-connman-Session.Destroy">Destroy()</link> D-Bus method on @proxy.
+ * When the operation is finished, @callback will be invoked in the <link linkend="g-main-context-push-thread-default">thread-default main loop</link> of the thread you are calling this method from.
+ * You can then call connman_proxy_session_call_destroy_finish() to get the result of the operation.
+ *
+ * See connman_proxy_session_call_destroy_sync() for the synchronous, blocking version of this method.
+ */
+void
+connman_proxy_session_call_destroy (
+    ConnmanProxySession *proxy,
+    GCancellable *cancellable,
+    GAsyncReadyCallback callback,
+    gpointer user_data)
+{
+  g_dbus_proxy_call (G_DBUS_PROXY (proxy),
+    "Destroy",
+    g_variant_new ("()"),
+    G_DBUS_CALL_FLAGS_NONE,
+    -1,
+    cancellable,
+    callback,
+    user_data);
+}
+
+/**
+ * connman_proxy_session_call_destroy_finish:
+ * @proxy: A #ConnmanProxySessionProxy.
+ * @res: The #GAsyncResult obtained from the #GAsyncReadyCallback passed to connman_proxy_session_call_destroy().
+ * @error: Return location for error or %NULL.
+ *
+ * Finishes an operation started with connman_proxy_session_call_destroy().
+ *
+ * Returns: (skip): %TRUE if the call succeded, %FALSE if @error is set.
+ */
+gboolean
+connman_proxy_session_call_destroy_finish (
+    ConnmanProxySession *proxy,
+    GAsyncResult *res,
+    GError **error)
+{
+  GVariant *_ret;
+  _ret = g_dbus_proxy_call_finish (G_DBUS_PROXY (proxy), res, error);
+  if (_ret == NULL)
+    goto _out;
+  g_variant_get (_ret,
+                 "()");
+  g_variant_unref (_ret);
+_out:
+  return _ret != NULL;
+}
+
+/**
+ * connman_proxy_session_call_destroy_sync:
+ * @proxy: A #ConnmanProxySessionProxy.
+ * @cancellable: (allow-none): A #GCancellable or %NULL.
+ * @error: Return location for error or %NULL.
+ *
+ * Synchronously invokes the <link linkend="gdbus-method-net-connman-Session.Destroy">Destroy()</link> D-Bus method on @proxy. The calling thread is blocked until a reply is received.
+ *
+ * See connman_proxy_session_call_destroy() for the asynchronous version of this method.
+ *
+ * Returns: (skip): %TRUE if the call succeded, %FALSE if @error is set.
+ */
+gboolean
+connman_proxy_session_call_destroy_sync (
+    ConnmanProxySession *proxy,
+    GCancellable *cancellable,
+    GError **error)
+{
+  GVariant *_ret;
+  _ret = g_dbus_proxy_call_sync (G_DBUS_PROXY (proxy),
+    "Destroy",
+    g_variant_new ("()"),
+    G_DBUS_CALL_FLAGS_NONE,
+    -1,
+    cancellable,
+    error);
+  if (_ret == NULL)
+    goto _out;
+  g_variant_get (_ret,
+                 "()");
+  g_variant_unref (_ret);
+_out:
+  return _ret != NULL;
+}
+
+/**
+ * connman_proxy_session_call_connect:
+ * @proxy: A #ConnmanProxySessionProxy.
+ * @cancellable: (allow-none): A #GCancellable or %NULL.
+ * @callback: A #GAsyncReadyCallback to call when the request is satisfied or %NULL.
+ * @user_data: User data to pass to @callback.
+ *
+ * Asynchronously invokes the <link linkend="gdbus-method-net-connman-Session.Connect">Connect()</link> D-Bus method on @proxy.
+ * When the operation is finished, @callback will be invoked in the <link linkend="g-main-context-push-thread-default">thread-default main loop</link> of the thread you are calling this method from.
+ * You can then call connman_proxy_session_call_connect_finish() to get the result of the operation.
+ *
+ * See connman_proxy_session_call_connect_sync() for the synchronous, blocking version of this method.
+ */
+void
+connman_proxy_session_call_connect (
+    ConnmanProxySession *proxy,
+    GCancellable *cancellable,
+    GAsyncReadyCallback callback,
+    gpointer user_data)
+{
+  g_dbus_proxy_call (G_DBUS_PROXY (proxy),
+    "Connect",
+    g_variant_new ("()"),
+    G_DBUS_CALL_FLAGS_NONE,
+    -1,
+    cancellable,
+    callback,
+    user_data);
+}
+
+/**
+ * connman_proxy_session_call_connect_finish:
+ * @proxy: A #ConnmanProxySessionProxy.
+ * @res: The #GAsyncResult obtained from the #GAsyncReadyCallback passed to connman_proxy_session_call_connect().
+ * @error: Return location for error or %NULL.
+ *
+ * Finishes an operation started with connman_proxy_session_call_connect().
+ *
+ * Returns: (skip): %TRUE if the call succeded, %FALSE if @error is set.
+ */
+gboolean
+connman_proxy_session_call_connect_finish (
+    ConnmanProxySession *proxy,
+    GAsyncResult *res,
+    GError **error)
+{
+  GVariant *_ret;
+  _ret = g_dbus_proxy_call_finish (G_DBUS_PROXY (proxy), res, error);
+  if (_ret == NULL)
+    goto _out;
+  g_variant_get (_ret,
+                 "()");
+  g_variant_unref (_ret);
+_out:
+  return _ret != NULL;
+}
+
+/**
+ * connman_proxy_session_call_connect_sync:
+ * @proxy: A #ConnmanProxySessionProxy.
+ * @cancellable: (allow-none): A #GCancellable or %NULL.
+ * @error: Return location for error or %NULL.
+ *
+ * Synchronously invokes the <link linkend="gdbus-method-net-connman-Session.Connect">Connect()</link> D-Bus method on @proxy. The calling thread is blocked until a reply is received.
+ *
+ * See connman_proxy_session_call_connect() for the asynchronous version of this method.
+ *
+ * Returns: (skip): %TRUE if the call succeded, %FALSE if @error is set.
+ */
+gboolean
+connman_proxy_session_call_connect_sync (
+    ConnmanProxySession *proxy,
+    GCancellable *cancellable,
+    GError **error)
+{
+  GVariant *_ret;
+  _ret = g_dbus_proxy_call_sync (G_DBUS_PROXY (proxy),
+    "Connect",
+    g_variant_new ("()"),
+    G_DBUS_CALL_FLAGS_NONE,
+    -1,
+    cancellable,
+    error);
+  if (_ret == NULL)
+    goto _out;
+  g_variant_get (_ret,
+                 "()");
+  g_variant_unref (_ret);
+_out:
+  return _ret != NULL;
+}
+
+/**
+ * connman_proxy_session_call_disconnect:
+ * @proxy: A #ConnmanProxySessionProxy.
+ * @cancellable: (allow-none): A #GCancellable or %NULL.
+ * @callback: A #GAsyncReadyCallback to call when the request is satisfied or %NULL.
+ * @user_data: User data to pass to @callback.
+ *
+ * Asynchronously invokes the <link linkend="gdbus-method-net-connman-Session.Disconnect">Disconnect()</link> D-Bus method on @proxy.
+ * When the operation is finished, @callback will be invoked in the <link linkend="g-main-context-push-thread-default">thread-default main loop</link> of the thread you are calling this method from.
+ * You can then call connman_proxy_session_call_disconnect_finish() to get the result of the operation.
+ *
+ * See connman_proxy_session_call_disconnect_sync() for the synchronous, blocking version of this method.
+ */
+void
+connman_proxy_session_call_disconnect (
+    ConnmanProxySession *proxy,
+    GCancellable *cancellable,
+    GAsyncReadyCallback callback,
+    gpointer user_data)
+{
+  g_dbus_proxy_call (G_DBUS_PROXY (proxy),
+    "Disconnect",
+    g_variant_new ("()"),
+    G_DBUS_CALL_FLAGS_NONE,
+    -1,
+    cancellable,
+    callback,
+    user_data);
+}
+
+/**
+ * connman_proxy_session_call_disconnect_finish:
+ * @proxy: A #ConnmanProxySessionProxy.
+ * @res: The #GAsyncResult obtained from the #GAsyncReadyCallback passed to connman_proxy_session_call_disconnect().
+ * @error: Return location for error or %NULL.
+ *
+ * Finishes an operation started with connman_proxy_session_call_disconnect().
+ *
+ * Returns: (skip): %TRUE if the call succeded, %FALSE if @error is set.
+ */
+gboolean
+connman_proxy_session_call_disconnect_finish (
+    ConnmanProxySession *proxy,
+    GAsyncResult *res,
+    GError **error)
+{
+  GVariant *_ret;
+  _ret = g_dbus_proxy_call_finish (G_DBUS_PROXY (proxy), res, error);
+  if (_ret == NULL)
+    goto _out;
+  g_variant_get (_ret,
+                 "()");
+  g_variant_unref (_ret);
+_out:
+  return _ret != NULL;
+}
+
+/**
+ * connman_proxy_session_call_disconnect_sync:
+ * @proxy: A #ConnmanProxySessionProxy.
+ * @cancellable: (allow-none): A #GCancellable or %NULL.
+ * @error: Return location for error or %NULL.
+ *
+ * Synchronously invokes the <link linkend="gdbus-method-net-connman-Session.Disconnect">Disconnect()</link> D-Bus method on @proxy. The calling thread is blocked until a reply is received.
+ *
+ * See connman_proxy_session_call_disconnect() for the asynchronous version of this method.
+ *
+ * Returns: (skip): %TRUE if the call succeded, %FALSE if @error is set.
+ */
+gboolean
+connman_proxy_session_call_disconnect_sync (
+    ConnmanProxySession *proxy,
+    GCancellable *cancellable,
+    GError **error)
+{
+  GVariant *_ret;
+  _ret = g_dbus_proxy_call_sync (G_DBUS_PROXY (proxy),
+    "Disconnect",
+    g_variant_new ("()"),
+    G_DBUS_CALL_FLAGS_NONE,
+    -1,
+    cancellable,
+    error);
+  if (_ret == NULL)
+    goto _out;
+  g_variant_get (_ret,
+                 "()");
+  g_variant_unref (_ret);
+_out:
+  return _ret != NULL;
+}
+
+/**
+ * connman_proxy_session_call_change:
+ * @proxy: A #ConnmanProxySessionProxy.
+ * @arg_unnamed_arg0: Argument to pass with the method invocation.
+ * @arg_unnamed_arg1: Argument to pass with the method invocation.
+ * @cancellable: (allow-none): A #GCancellable or %NULL.
+ * @callback: A #GAsyncReadyCallback to call when the request is satisfied or %NULL.
+ * @user_data: User data to pass to @callback.
+ *
+ * Asynchronously invokes the <link linkend="gdbus-method-net-connman-Session.Change">Change()</link> D-Bus method on @proxy.
+ * When the operation is finished, @callback will be invoked in the <link linkend="g-main-context-push-thread-default">thread-default main loop</link> of the thread you are calling this method from.
+ * You can then call connman_proxy_session_call_change_finish() to get the result of the operation.
+ *
+ * See connman_proxy_session_call_change_sync() for the synchronous, blocking version of this method.
+ */
+void
+connman_proxy_session_call_change (
+    ConnmanProxySession *proxy,
+    const gchar *arg_unnamed_arg0,
+    GVariant *arg_unnamed_arg1,
+    GCancellable *cancellable,
+    GAsyncReadyCallback callback,
+    gpointer user_data)
+{
+  g_dbus_proxy_call (G_DBUS_PROXY (proxy),
+    "Change",
+    g_variant_new ("(s@v)",
+                   arg_unnamed_arg0,
+                   arg_unnamed_arg1),
+    G_DBUS_CALL_FLAGS_NONE,
+    -1,
+    cancellable,
+    callback,
+    user_data);
+}
+
+/**
+ * connman_proxy_session_call_change_finish:
+ * @proxy: A #ConnmanProxySessionProxy.
+ * @res: The #GAsyncResult obtained from the #GAsyncReadyCallback passed to connman_proxy_session_call_change().
+ * @error: Return location for error or %NULL.
+ *
+ * Finishes an operation started with connman_proxy_session_call_change().
+ *
+ * Returns: (skip): %TRUE if the call succeded, %FALSE if @error is set.
+ */
+gboolean
+connman_proxy_session_call_change_finish (
+    ConnmanProxySession *proxy,
+    GAsyncResult *res,
+    GError **error)
+{
+  GVariant *_ret;
+  _ret = g_dbus_proxy_call_finish (G_DBUS_PROXY (proxy), res, error);
+  if (_ret == NULL)
+    goto _out;
+  g_variant_get (_ret,
+                 "()");
+  g_variant_unref (_ret);
+_out:
+  return _ret != NULL;
+}
+
+/**
+ * connman_proxy_session_call_change_sync:
+ * @proxy: A #ConnmanProxySessionProxy.
+ * @arg_unnamed_arg0: Argument to pass with the method invocation.
+ * @arg_unnamed_arg1: Argument to pass with the method invocation.
+ * @cancellable: (allow-none): A #GCancellable or %NULL.
+ * @error: Return location for error or %NULL.
+ *
+ * Synchronously invokes the <link linkend="gdbus-method-net-connman-Session.Change">Change()</link> D-Bus method on @proxy. The calling thread is blocked until a reply is received.
+ *
+ * See connman_proxy_session_call_change() for the asynchronous version of this method.
+ *
+ * Returns: (skip): %TRUE if the call succeded, %FALSE if @error is set.
+ */
+gboolean
+connman_proxy_session_call_change_sync (
+    ConnmanProxySession *proxy,
+    const gchar *arg_unnamed_arg0,
+    GVariant *arg_unnamed_arg1,
+    GCancellable *cancellable,
+    GError **error)
+{
+  GVariant *_ret;
+  _ret = g_dbus_proxy_call_sync (G_DBUS_PROXY (proxy),
+    "Change",
+    g_variant_new ("(s@v)",
+                   arg_unnamed_arg0,
+                   arg_unnamed_arg1),
+    G_DBUS_CALL_FLAGS_NONE,
+    -1,
+    cancellable,
+    error);
+  if (_ret == NULL)
+    goto _out;
+  g_variant_get (_ret,
+                 "()");
+  g_variant_unref (_ret);
+_out:
+  return _ret != NULL;
+}
+
+/**
+ * connman_proxy_session_complete_destroy:
+ * @object: A #ConnmanProxySession.
+ * @invocation: (transfer full): A #GDBusMethodInvocation.
+ *
+ * Helper function used in service implementations to finish handling invocations of the <link linkend="gdbus-method-net-connman-Session.Destroy">Destroy()</link> D-Bus method. If you instead want to finish handling an invocation by returning an error, use g_dbus_method_invocation_return_error() or similar.
+ *
+ * This method will free @invocation, you cannot use it afterwards.
+ */
+void
+connman_proxy_session_complete_destroy (
+    ConnmanProxySession *object,
+    GDBusMethodInvocation *invocation)
+{
+  g_dbus_method_invocation_return_value (invocation,
+    g_variant_new ("()"));
+}
+
+/**
+ * connman_proxy_session_complete_connect:
+ * @object: A #ConnmanProxySession.
+ * @invocation: (transfer full): A #GDBusMethodInvocation.
+ *
+ * Helper function used in service implementations to finish handling invocations of the <link linkend="gdbus-method-net-connman-Session.Connect">Connect()</link> D-Bus method. If you instead want to finish handling an invocation by returning an error, use g_dbus_method_invocation_return_error() or similar.
+ *
+ * This method will free @invocation, you cannot use it afterwards.
+ */
+void
+connman_proxy_session_complete_connect (
+    ConnmanProxySession *object,
+    GDBusMethodInvocation *invocation)
+{
+  g_dbus_method_invocation_return_value (invocation,
+    g_variant_new ("()"));
+}
+
+/**
+ * connman_proxy_session_complete_disconnect:
+ * @object: A #ConnmanProxySession.
+ * @invocation: (transfer full): A #GDBusMethodInvocation.
+ *
+ * Helper function used in service implementations to finish handling invocations of the <link linkend="gdbus-method-net-connman-Session.Disconnect">Disconnect()</link> D-Bus method. If you instead want to finish handling an invocation by returning an error, use g_dbus_method_invocation_return_error() or similar.
+ *
+ * This method will free @invocation, you cannot use it afterwards.
+ */
+void
+connman_proxy_session_complete_disconnect (
+    ConnmanProxySession *object,
+    GDBusMethodInvocation *invocation)
+{
+  g_dbus_method_invocation_return_value (invocation,
+    g_variant_new ("()"));
+}
+
+/**
+ * connman_proxy_session_complete_change:
+ * @object: A #ConnmanProxySession.
+ * @invocation: (transfer full): A #GDBusMethodInvocation.
+ *
+ * Helper function used in service implementations to finish handling invocations of the <link linkend="gdbus-method-net-connman-Session.Change">Change()</link> D-Bus method. If you instead want to finish handling an invocation by returning an error, use g_dbus_method_invocation_return_error() or similar.
+ *
+ * This method will free @invocation, you cannot use it afterwards.
+ */
+void
+connman_proxy_session_complete_change (
+    ConnmanProxySession *object,
+    GDBusMethodInvocation *invocation)
+{
+  g_dbus_method_invocation_return_value (invocation,
+    g_variant_new ("()"));
+}
+
+/* ------------------------------------------------------------------------ */
+
+/**
+ * ConnmanProxySessionProxy:
+ *
+ * The #ConnmanProxySessionProxy structure contains only private data and should only be accessed using the provided API.
+ */
+
+/**
+ * ConnmanProxySessionProxyClass:
+ * @parent_class: The parent class.
+ *
+ * Class structure for #ConnmanProxySessionProxy.
+ */
+
+struct _ConnmanProxySessionProxyPrivate
+{
+  GData *qdata;
+};
+
+static void connman_proxy_session_proxy_iface_init (ConnmanProxySessionIface *iface);
+
+G_DEFINE_TYPE_WITH_CODE (ConnmanProxySessionProxy, connman_proxy_session_proxy, G_TYPE_DBUS_PROXY,
+                         G_IMPLEMENT_INTERFACE (CONNMAN_PROXY_TYPE_SESSION, connman_proxy_session_proxy_iface_init));
+
+static void
+connman_proxy_session_proxy_finalize (GObject *object)
+{
+  ConnmanProxySessionProxy *proxy = CONNMAN_PROXY_SESSION_PROXY (object);
+  g_datalist_clear (&proxy->priv->qdata);
+  G_OBJECT_CLASS (connman_proxy_session_proxy_parent_class)->finalize (object);
+}
+
+static void
+connman_proxy_session_proxy_get_property (GObject      *object,
+  guint         prop_id,
+  GValue       *value,
+  GParamSpec   *pspec)
+{
+}
+
+static void
+connman_proxy_session_proxy_set_property (GObject      *object,
+  guint         prop_id,
+  const GValue *value,
+  GParamSpec   *pspec)
+{
+}
+
+static void
+connman_proxy_session_proxy_g_signal (GDBusProxy *proxy,
+  const gchar *sender_name,
+  const gchar *signal_name,
+  GVariant *parameters)
+{
+  _ExtendedGDBusSignalInfo *info;
+  GVariantIter iter;
+  GVariant *child;
+  GValue *paramv;
+  guint num_params;
+  guint n;
+  guint signal_id;
+  info = (_ExtendedGDBusSignalInfo *) g_dbus_interface_info_lookup_signal ((GDBusInterfaceInfo *) &_connman_proxy_session_interface_info, signal_name);
+  if (info == NULL)
+    return;
+  num_params = g_variant_n_children (parameters);
+  paramv = g_new0 (GValue, num_params + 1);
+  g_value_init (&paramv[0], CONNMAN_PROXY_TYPE_SESSION);
+  g_value_set_object (&paramv[0], proxy);
+  g_variant_iter_init (&iter, parameters);
+  n = 1;
+  while ((child = g_variant_iter_next_value (&iter)) != NULL)
+    {
+      _ExtendedGDBusArgInfo *arg_info = (_ExtendedGDBusArgInfo *) info->parent_struct.args[n - 1];
+      if (arg_info->use_gvariant)
+        {
+          g_value_init (&paramv[n], G_TYPE_VARIANT);
+          g_value_set_variant (&paramv[n], child);
+          n++;
+        }
+      else
+        g_dbus_gvariant_to_gvalue (child, &paramv[n++]);
+      g_variant_unref (child);
+    }
+  signal_id = g_signal_lookup (info->signal_name, CONNMAN_PROXY_TYPE_SESSION);
+  g_signal_emitv (paramv, signal_id, 0, NULL);
+  for (n = 0; n < num_params + 1; n++)
+    g_value_unset (&paramv[n]);
+  g_free (paramv);
+}
+
+static void
+connman_proxy_session_proxy_g_properties_changed (GDBusProxy *_proxy,
+  GVariant *changed_properties,
+  const gchar *const *invalidated_properties)
+{
+  ConnmanProxySessionProxy *proxy = CONNMAN_PROXY_SESSION_PROXY (_proxy);
+  guint n;
+  const gchar *key;
+  GVariantIter *iter;
+  _ExtendedGDBusPropertyInfo *info;
+  g_variant_get (changed_properties, "a{sv}", &iter);
+  while (g_variant_iter_next (iter, "{&sv}", &key, NULL))
+    {
+      info = (_ExtendedGDBusPropertyInfo *) g_dbus_interface_info_lookup_property ((GDBusInterfaceInfo *) &_connman_proxy_session_interface_info, key);
+      g_datalist_remove_data (&proxy->priv->qdata, key);
+      if (info != NULL)
+        g_object_notify (G_OBJECT (proxy), info->hyphen_name);
+    }
+  g_variant_iter_free (iter);
+  for (n = 0; invalidated_properties[n] != NULL; n++)
+    {
+      info = (_ExtendedGDBusPropertyInfo *) g_dbus_interface_info_lookup_property ((GDBusInterfaceInfo *) &_connman_proxy_session_interface_info, invalidated_properties[n]);
+      g_datalist_remove_data (&proxy->priv->qdata, invalidated_properties[n]);
+      if (info != NULL)
+        g_object_notify (G_OBJECT (proxy), info->hyphen_name);
+    }
+}
+
+static void
+connman_proxy_session_proxy_init (ConnmanProxySessionProxy *proxy)
+{
+  proxy->priv = G_TYPE_INSTANCE_GET_PRIVATE (proxy, CONNMAN_PROXY_TYPE_SESSION_PROXY, ConnmanProxySessionProxyPrivate);
+  g_dbus_proxy_set_interface_info (G_DBUS_PROXY (proxy), connman_proxy_session_interface_info ());
+}
+
+static void
+connman_proxy_session_proxy_class_init (ConnmanProxySessionProxyClass *klass)
+{
+  GObjectClass *gobject_class;
+  GDBusProxyClass *proxy_class;
+
+  g_type_class_add_private (klass, sizeof (ConnmanProxySessionProxyPrivate));
+
+  gobject_class = G_OBJECT_CLASS (klass);
+  gobject_class->finalize     = connman_proxy_session_proxy_finalize;
+  gobject_class->get_property = connman_proxy_session_proxy_get_property;
+  gobject_class->set_property = connman_proxy_session_proxy_set_property;
+
+  proxy_class = G_DBUS_PROXY_CLASS (klass);
+  proxy_class->g_signal = connman_proxy_session_proxy_g_signal;
+  proxy_class->g_properties_changed = connman_proxy_session_proxy_g_properties_changed;
+
+}
+
+static void
+connman_proxy_session_proxy_iface_init (ConnmanProxySessionIface *iface)
+{
+}
+
+/**
+ * connman_proxy_session_proxy_new:
+ * @connection: A #GDBusConnection.
+ * @flags: Flags from the #GDBusProxyFlags enumeration.
+ * @name: (allow-none): A bus name (well-known or unique) or %NULL if @connection is not a message bus connection.
+ * @object_path: An object path.
+ * @cancellable: (allow-none): A #GCancellable or %NULL.
+ * @callback: A #GAsyncReadyCallback to call when the request is satisfied.
+ * @user_data: User data to pass to @callback.
+ *
+ * Asynchronously creates a proxy for the D-Bus interface <link linkend="gdbus-interface-net-connman-Session.top_of_page">net.connman.Session</link>. See g_dbus_proxy_new() for more details.
+ *
+ * When the operation is finished, @callback will be invoked in the <link linkend="g-main-context-push-thread-default">thread-default main loop</link> of the thread you are calling this method from.
+ * You can then call connman_proxy_session_proxy_new_finish() to get the result of the operation.
+ *
+ * See connman_proxy_session_proxy_new_sync() for the synchronous, blocking version of this constructor.
+ */
+void
+connman_proxy_session_proxy_new (
+    GDBusConnection     *connection,
+    GDBusProxyFlags      flags,
+    const gchar         *name,
+    const gchar         *object_path,
+    GCancellable        *cancellable,
+    GAsyncReadyCallback  callback,
+    gpointer             user_data)
+{
+  g_async_initable_new_async (CONNMAN_PROXY_TYPE_SESSION_PROXY, G_PRIORITY_DEFAULT, cancellable, callback, user_data, "g-flags", flags, "g-name", name, "g-connection", connection, "g-object-path", object_path, "g-interface-name", "net.connman.Session", NULL);
+}
+
+/**
+ * connman_proxy_session_proxy_new_finish:
+ * @res: The #GAsyncResult obtained from the #GAsyncReadyCallback passed to connman_proxy_session_proxy_new().
+ * @error: Return location for error or %NULL
+ *
+ * Finishes an operation started with connman_proxy_session_proxy_new().
+ *
+ * Returns: (transfer full) (type ConnmanProxySessionProxy): The constructed proxy object or %NULL if @error is set.
+ */
+ConnmanProxySession *
+connman_proxy_session_proxy_new_finish (
+    GAsyncResult        *res,
+    GError             **error)
+{
+  GObject *ret;
+  GObject *source_object;
+  source_object = g_async_result_get_source_object (res);
+  ret = g_async_initable_new_finish (G_ASYNC_INITABLE (source_object), res, error);
+  g_object_unref (source_object);
+  if (ret != NULL)
+    return CONNMAN_PROXY_SESSION (ret);
+  else
+    return NULL;
+}
+
+/**
+ * connman_proxy_session_proxy_new_sync:
+ * @connection: A #GDBusConnection.
+ * @flags: Flags from the #GDBusProxyFlags enumeration.
+ * @name: (allow-none): A bus name (well-known or unique) or %NULL if @connection is not a message bus connection.
+ * @object_path: An object path.
+ * @cancellable: (allow-none): A #GCancellable or %NULL.
+ * @error: Return location for error or %NULL
+ *
+ * Synchronously creates a proxy for the D-Bus interface <link linkend="gdbus-interface-net-connman-Session.top_of_page">net.connman.Session</link>. See g_dbus_proxy_new_sync() for more details.
+ *
+ * The calling thread is blocked until a reply is received.
+ *
+ * See connman_proxy_session_proxy_new() for the asynchronous version of this constructor.
+ *
+ * Returns: (transfer full) (type ConnmanProxySessionProxy): The constructed proxy object or %NULL if @error is set.
+ */
+ConnmanProxySession *
+connman_proxy_session_proxy_new_sync (
+    GDBusConnection     *connection,
+    GDBusProxyFlags      flags,
+    const gchar         *name,
+    const gchar         *object_path,
+    GCancellable        *cancellable,
+    GError             **error)
+{
+  GInitable *ret;
+  ret = g_initable_new (CONNMAN_PROXY_TYPE_SESSION_PROXY, cancellable, error, "g-flags", flags, "g-name", name, "g-connection", connection, "g-object-path", object_path, "g-interface-name", "net.connman.Session", NULL);
+  if (ret != NULL)
+    return CONNMAN_PROXY_SESSION (ret);
+  else
+    return NULL;
+}
+
+
+/**
+ * connman_proxy_session_proxy_new_for_bus:
+ * @bus_type: A #GBusType.
+ * @flags: Flags from the #GDBusProxyFlags enumeration.
+ * @name: A bus name (well-known or unique).
+ * @object_path: An object path.
+ * @cancellable: (allow-none): A #GCancellable or %NULL.
+ * @callback: A #GAsyncReadyCallback to call when the request is satisfied.
+ * @user_data: User data to pass to @callback.
+ *
+ * Like connman_proxy_session_proxy_new() but takes a #GBusType instead of a #GDBusConnection.
+ *
+ * When the operation is finished, @callback will be invoked in the <link linkend="g-main-context-push-thread-default">thread-default main loop</link> of the thread you are calling this method from.
+ * You can then call connman_proxy_session_proxy_new_for_bus_finish() to get the result of the operation.
+ *
+ * See connman_proxy_session_proxy_new_for_bus_sync() for the synchronous, blocking version of this constructor.
+ */
+void
+connman_proxy_session_proxy_new_for_bus (
+    GBusType             bus_type,
+    GDBusProxyFlags      flags,
+    const gchar         *name,
+    const gchar         *object_path,
+    GCancellable        *cancellable,
+    GAsyncReadyCallback  callback,
+    gpointer             user_data)
+{
+  g_async_initable_new_async (CONNMAN_PROXY_TYPE_SESSION_PROXY, G_PRIORITY_DEFAULT, cancellable, callback, user_data, "g-flags", flags, "g-name", name, "g-bus-type", bus_type, "g-object-path", object_path, "g-interface-name", "net.connman.Session", NULL);
+}
+
+/**
+ * connman_proxy_session_proxy_new_for_bus_finish:
+ * @res: The #GAsyncResult obtained from the #GAsyncReadyCallback passed to connman_proxy_session_proxy_new_for_bus().
+ * @error: Return location for error or %NULL
+ *
+ * Finishes an operation started with connman_proxy_session_proxy_new_for_bus().
+ *
+ * Returns: (transfer full) (type ConnmanProxySessionProxy): The constructed proxy object or %NULL if @error is set.
+ */
+ConnmanProxySession *
+connman_proxy_session_proxy_new_for_bus_finish (
+    GAsyncResult        *res,
+    GError             **error)
+{
+  GObject *ret;
+  GObject *source_object;
+  source_object = g_async_result_get_source_object (res);
+  ret = g_async_initable_new_finish (G_ASYNC_INITABLE (source_object), res, error);
+  g_object_unref (source_object);
+  if (ret != NULL)
+    return CONNMAN_PROXY_SESSION (ret);
+  else
+    return NULL;
+}
+
+/**
+ * connman_proxy_session_proxy_new_for_bus_sync:
+ * @bus_type: A #GBusType.
+ * @flags: Flags from the #GDBusProxyFlags enumeration.
+ * @name: A bus name (well-known or unique).
+ * @object_path: An object path.
+ * @cancellable: (allow-none): A #GCancellable or %NULL.
+ * @error: Return location for error or %NULL
+ *
+ * Like connman_proxy_session_proxy_new_sync() but takes a #GBusType instead of a #GDBusConnection.
+ *
+ * The calling thread is blocked until a reply is received.
+ *
+ * See connman_proxy_session_proxy_new_for_bus() for the asynchronous version of this constructor.
+ *
+ * Returns: (transfer full) (type ConnmanProxySessionProxy): The constructed proxy object or %NULL if @error is set.
+ */
+ConnmanProxySession *
+connman_proxy_session_proxy_new_for_bus_sync (
+    GBusType             bus_type,
+    GDBusProxyFlags      flags,
+    const gchar         *name,
+    const gchar         *object_path,
+    GCancellable        *cancellable,
+    GError             **error)
+{
+  GInitable *ret;
+  ret = g_initable_new (CONNMAN_PROXY_TYPE_SESSION_PROXY, cancellable, error, "g-flags", flags, "g-name", name, "g-bus-type", bus_type, "g-object-path", object_path, "g-interface-name", "net.connman.Session", NULL);
+  if (ret != NULL)
+    return CONNMAN_PROXY_SESSION (ret);
+  else
+    return NULL;
+}
+
+
+/* ------------------------------------------------------------------------ */
+
+/**
+ * ConnmanProxySessionSkeleton:
+ *
+ * The #ConnmanProxySessionSkeleton structure contains only private data and should only be accessed using the provided API.
+ */
+
+/**
+ * ConnmanProxySessionSkeletonClass:
+ * @parent_class: The parent class.
+ *
+ * Class structure for #ConnmanProxySessionSkeleton.
+ */
+
+struct _ConnmanProxySessionSkeletonPrivate
+{
+  GValueArray *properties;
+  GList *changed_properties;
+  GSource *changed_properties_idle_source;
+  GMainContext *context;
+  GMutex *lock;
+};
+
+static void
+_connman_proxy_session_skeleton_handle_method_call (
+  GDBusConnection *connection,
+  const gchar *sender,
+  const gchar *object_path,
+  const gchar *interface_name,
+  const gchar *method_name,
+  GVariant *parameters,
+  GDBusMethodInvocation *invocation,
+  gpointer user_data)
+{
+  ConnmanProxySessionSkeleton *skeleton = CONNMAN_PROXY_SESSION_SKELETON (user_data);
+  _ExtendedGDBusMethodInfo *info;
+  GVariantIter iter;
+  GVariant *child;
+  GValue *paramv;
+  guint num_params;
+  guint num_extra;
+  guint n;
+  guint signal_id;
+  GValue return_value = {0};
+  info = (_ExtendedGDBusMethodInfo *) g_dbus_method_invocation_get_method_info (invocation);
+  g_assert (info != NULL);
+  num_params = g_variant_n_children (parameters);
+  num_extra = info->pass_fdlist ? 3 : 2;  paramv = g_new0 (GValue, num_params + num_extra);
+  n = 0;
+  g_value_init (&paramv[n], CONNMAN_PROXY_TYPE_SESSION);
+  g_value_set_object (&paramv[n++], skeleton);
+  g_value_init (&paramv[n], G_TYPE_DBUS_METHOD_INVOCATION);
+  g_value_set_object (&paramv[n++], invocation);
+  if (info->pass_fdlist)
+    {
+#ifdef G_OS_UNIX
+      g_value_init (&paramv[n], G_TYPE_UNIX_FD_LIST);
+      g_value_set_object (&paramv[n++], g_dbus_message_get_unix_fd_list (g_dbus_method_invocation_get_message (invocation)));
+#else
+      g_assert_not_reached ();
+#endif
+    }
+  g_variant_iter_init (&iter, parameters);
+  while ((child = g_variant_iter_next_value (&iter)) != NULL)
+    {
+      _ExtendedGDBusArgInfo *arg_info = (_ExtendedGDBusArgInfo *) info->parent_struct.in_args[n - num_extra];
+      if (arg_info->use_gvariant)
+        {
+          g_value_init (&paramv[n], G_TYPE_VARIANT);
+          g_value_set_variant (&paramv[n], child);
+          n++;
+        }
+      else
+        g_dbus_gvariant_to_gvalue (child, &paramv[n++]);
+      g_variant_unref (child);
+    }
+  signal_id = g_signal_lookup (info->signal_name, CONNMAN_PROXY_TYPE_SESSION);
+  g_value_init (&return_value, G_TYPE_BOOLEAN);
+  g_signal_emitv (paramv, signal_id, 0, &return_value);
+  if (!g_value_get_boolean (&return_value))
+    g_dbus_method_invocation_return_error (invocation, G_DBUS_ERROR, G_DBUS_ERROR_UNKNOWN_METHOD, "Method %s is not implemented on interface %s", method_name, interface_name);
+  g_value_unset (&return_value);
+  for (n = 0; n < num_params + num_extra; n++)
+    g_value_unset (&paramv[n]);
+  g_free (paramv);
+}
+
+static GVariant *
+_connman_proxy_session_skeleton_handle_get_property (
+  GDBusConnection *connection,
+  const gchar *sender,
+  const gchar *object_path,
+  const gchar *interface_name,
+  const gchar *property_name,
+  GError **error,
+  gpointer user_data)
+{
+  ConnmanProxySessionSkeleton *skeleton = CONNMAN_PROXY_SESSION_SKELETON (user_data);
+  GValue value = {0};
+  GParamSpec *pspec;
+  _ExtendedGDBusPropertyInfo *info;
+  GVariant *ret;
+  ret = NULL;
+  info = (_ExtendedGDBusPropertyInfo *) g_dbus_interface_info_lookup_property ((GDBusInterfaceInfo *) &_connman_proxy_session_interface_info, property_name);
+  g_assert (info != NULL);
+  pspec = g_object_class_find_property (G_OBJECT_GET_CLASS (skeleton), info->hyphen_name);
+  if (pspec == NULL)
+    {
+      g_set_error (error, G_DBUS_ERROR, G_DBUS_ERROR_INVALID_ARGS, "No property with name %s", property_name);
+    }
+  else
+    {
+      g_value_init (&value, pspec->value_type);
+      g_object_get_property (G_OBJECT (skeleton), info->hyphen_name, &value);
+      ret = g_dbus_gvalue_to_gvariant (&value, G_VARIANT_TYPE (info->parent_struct.signature));
+      g_value_unset (&value);
+    }
+  return ret;
+}
+
+static gboolean
+_connman_proxy_session_skeleton_handle_set_property (
+  GDBusConnection *connection,
+  const gchar *sender,
+  const gchar *object_path,
+  const gchar *interface_name,
+  const gchar *property_name,
+  GVariant *variant,
+  GError **error,
+  gpointer user_data)
+{
+  ConnmanProxySessionSkeleton *skeleton = CONNMAN_PROXY_SESSION_SKELETON (user_data);
+  GValue value = {0};
+  GParamSpec *pspec;
+  _ExtendedGDBusPropertyInfo *info;
+  gboolean ret;
+  ret = FALSE;
+  info = (_ExtendedGDBusPropertyInfo *) g_dbus_interface_info_lookup_property ((GDBusInterfaceInfo *) &_connman_proxy_session_interface_info, property_name);
+  g_assert (info != NULL);
+  pspec = g_object_class_find_property (G_OBJECT_GET_CLASS (skeleton), info->hyphen_name);
+  if (pspec == NULL)
+    {
+      g_set_error (error, G_DBUS_ERROR, G_DBUS_ERROR_INVALID_ARGS, "No property with name %s", property_name);
+    }
+  else
+    {
+      if (info->use_gvariant)
+        g_value_set_variant (&value, variant);
+      else
+        g_dbus_gvariant_to_gvalue (variant, &value);
+      g_object_set_property (G_OBJECT (skeleton), info->hyphen_name, &value);
+      g_value_unset (&value);
+      ret = TRUE;
+    }
+  return ret;
+}
+
+static const GDBusInterfaceVTable _connman_proxy_session_skeleton_vtable =
+{
+  _connman_proxy_session_skeleton_handle_method_call,
+  _connman_proxy_session_skeleton_handle_get_property,
+  _connman_proxy_session_skeleton_handle_set_property
+};
+
+static GDBusInterfaceInfo *
+connman_proxy_session_skeleton_dbus_interface_get_info (GDBusInterfaceSkeleton *skeleton)
+{
+  return connman_proxy_session_interface_info ();
+}
+
+static GDBusInterfaceVTable *
+connman_proxy_session_skeleton_dbus_interface_get_vtable (GDBusInterfaceSkeleton *skeleton)
+{
+  return (GDBusInterfaceVTable *) &_connman_proxy_session_skeleton_vtable;
+}
+
+static GVariant *
+connman_proxy_session_skeleton_dbus_interface_get_properties (GDBusInterfaceSkeleton *_skeleton)
+{
+  ConnmanProxySessionSkeleton *skeleton = CONNMAN_PROXY_SESSION_SKELETON (_skeleton);
+
+  GVariantBuilder builder;
+  guint n;
+  g_variant_builder_init (&builder, G_VARIANT_TYPE ("a{sv}"));
+  if (_connman_proxy_session_interface_info.parent_struct.properties == NULL)
+    goto out;
+  for (n = 0; _connman_proxy_session_interface_info.parent_struct.properties[n] != NULL; n++)
+    {
+      GDBusPropertyInfo *info = _connman_proxy_session_interface_info.parent_struct.properties[n];
+      if (info->flags & G_DBUS_PROPERTY_INFO_FLAGS_READABLE)
+        {
+          GVariant *value;
+          value = _connman_proxy_session_skeleton_handle_get_property (g_dbus_interface_skeleton_get_connection (G_DBUS_INTERFACE_SKELETON (skeleton)), NULL, g_dbus_interface_skeleton_get_object_path (G_DBUS_INTERFACE_SKELETON (skeleton)), "net.connman.Session", info->name, NULL, skeleton);
+          if (value != NULL)
+            {
+              g_variant_take_ref (value);
+              g_variant_builder_add (&builder, "{sv}", info->name, value);
+              g_variant_unref (value);
+            }
+        }
+    }
+out:
+  return g_variant_builder_end (&builder);
+}
+
+static void
+connman_proxy_session_skeleton_dbus_interface_flush (GDBusInterfaceSkeleton *_skeleton)
+{
+}
+
+static void connman_proxy_session_skeleton_iface_init (ConnmanProxySessionIface *iface);
+G_DEFINE_TYPE_WITH_CODE (ConnmanProxySessionSkeleton, connman_proxy_session_skeleton, G_TYPE_DBUS_INTERFACE_SKELETON,
+                         G_IMPLEMENT_INTERFACE (CONNMAN_PROXY_TYPE_SESSION, connman_proxy_session_skeleton_iface_init));
+
+static void
+connman_proxy_session_skeleton_finalize (GObject *object)
+{
+  ConnmanProxySessionSkeleton *skeleton = CONNMAN_PROXY_SESSION_SKELETON (object);
+  g_list_foreach (skeleton->priv->changed_properties, (GFunc) _changed_property_free, NULL);
+  g_list_free (skeleton->priv->changed_properties);
+  if (skeleton->priv->changed_properties_idle_source != NULL)
+    g_source_destroy (skeleton->priv->changed_properties_idle_source);
+  if (skeleton->priv->context != NULL)
+    g_main_context_unref (skeleton->priv->context);
+  g_mutex_free (skeleton->priv->lock);
+  G_OBJECT_CLASS (connman_proxy_session_skeleton_parent_class)->finalize (object);
+}
+
+static void
+connman_proxy_session_skeleton_init (ConnmanProxySessionSkeleton *skeleton)
+{
+  skeleton->priv = G_TYPE_INSTANCE_GET_PRIVATE (skeleton, CONNMAN_PROXY_TYPE_SESSION_SKELETON, ConnmanProxySessionSkeletonPrivate);
+  skeleton->priv->lock = g_mutex_new ();
+  skeleton->priv->context = g_main_context_get_thread_default ();
+  if (skeleton->priv->context != NULL)
+    g_main_context_ref (skeleton->priv->context);
+}
+
+static void
+connman_proxy_session_skeleton_class_init (ConnmanProxySessionSkeletonClass *klass)
+{
+  GObjectClass *gobject_class;
+  GDBusInterfaceSkeletonClass *skeleton_class;
+
+  g_type_class_add_private (klass, sizeof (ConnmanProxySessionSkeletonPrivate));
+
+  gobject_class = G_OBJECT_CLASS (klass);
+  gobject_class->finalize = connman_proxy_session_skeleton_finalize;
+
+  skeleton_class = G_DBUS_INTERFACE_SKELETON_CLASS (klass);
+  skeleton_class->get_info = connman_proxy_session_skeleton_dbus_interface_get_info;
+  skeleton_class->get_properties = connman_proxy_session_skeleton_dbus_interface_get_properties;
+  skeleton_class->flush = connman_proxy_session_skeleton_dbus_interface_flush;
+  skeleton_class->get_vtable = connman_proxy_session_skeleton_dbus_interface_get_vtable;
+}
+
+static void
+connman_proxy_session_skeleton_iface_init (ConnmanProxySessionIface *iface)
+{
+}
+
+/**
+ * connman_proxy_session_skeleton_new:
+ *
+ * Creates a skeleton object for the D-Bus interface <link linkend="gdbus-interface-net-connman-Session.top_of_page">net.connman.Session</link>.
+ *
+ * Returns: (transfer full) (type ConnmanProxySessionSkeleton): The skeleton object.
+ */
+ConnmanProxySession *
+connman_proxy_session_skeleton_new (void)
+{
+  return CONNMAN_PROXY_SESSION (g_object_new (CONNMAN_PROXY_TYPE_SESSION_SKELETON, NULL));
+}
+
+/* ------------------------------------------------------------------------
+ * Code for interface net.connman.Notification
+ * ------------------------------------------------------------------------
+ */
+
+/**
+ * SECTION:ConnmanProxyNotification
+ * @title: ConnmanProxyNotification
+ * @short_description: Generated C code for the net.connman.Notification D-Bus interface
+ *
+ * This section contains code for working with the <link linkend="gdbus-interface-net-connman-Notification.top_of_page">net.connman.Notification</link> D-Bus interface in C.
+ */
+
+/* ---- Introspection data for net.connman.Notification ---- */
+
+static const _ExtendedGDBusMethodInfo _connman_proxy_notification_method_info_release =
+{
+  {
+    -1,
+    "Release",
+    NULL,
+    NULL,
+    NULL
+  },
+  "handle-release",
+  FALSE
+};
+
+static const _ExtendedGDBusArgInfo _connman_proxy_notification_method_info_update_IN_ARG_unnamed_arg0 =
+{
+  {
+    -1,
+    "unnamed_arg0",
+    "a{sv}",
+    NULL
+  },
+  FALSE
+};
+
+static const _ExtendedGDBusArgInfo * const _connman_proxy_notification_method_info_update_IN_ARG_pointers[] =
+{
+  &_connman_proxy_notification_method_info_update_IN_ARG_unnamed_arg0,
+  NULL
+};
+
+static const _ExtendedGDBusMethodInfo _connman_proxy_notification_method_info_update =
+{
+  {
+    -1,
+    "Update",
+    (GDBusArgInfo **) &_connman_proxy_notification_method_info_update_IN_ARG_pointers,
+    NULL,
+    NULL
+  },
+  "handle-update",
+  FALSE
+};
+
+static const _ExtendedGDBusMethodInfo * const _connman_proxy_notification_method_info_pointers[] =
+{
+  &_connman_proxy_notification_method_info_release,
+  &_connman_proxy_notification_method_info_update,
+  NULL
+};
+
+static const _ExtendedGDBusInterfaceInfo _connman_proxy_notification_interface_info =
+{
+  {
+    -1,
+    "net.connman.Notification",
+    (GDBusMethodInfo **) &_connman_proxy_notification_method_info_pointers,
+    NULL,
+    NULL,
+    NULL
+  },
+  "notification",
+};
+
+
+/**
+ * connman_proxy_notification_interface_info:
+ *
+ * Gets a machine-readable description of the <link linkend="gdbus-interface-net-connman-Notification.top_of_page">net.connman.Notification</link> D-Bus interface.
+ *
+ * Returns: (transfer none): A #GDBusInterfaceInfo. Do not free.
+ */
+GDBusInterfaceInfo *
+connman_proxy_notification_interface_info (void)
+{
+  return (GDBusInterfaceInfo *) &_connman_proxy_notification_interface_info;
+}
+
+/**
+ * connman_proxy_notification_override_properties:
+ * @klass: The class structure for a #GObject<!-- -->-derived class.
+ * @property_id_begin: The property id to assign to the first overridden property.
+ *
+ * Overrides all #GObject properties in the #ConnmanProxyNotification interface for a concrete class.
+ * The properties are overridden in the order they are defined.
+ *
+ * Returns: The last property id.
+ */
+guint
+connman_proxy_notification_override_properties (GObjectClass *klass, guint property_id_begin)
+{
+  return property_id_begin - 1;
+}
+
+
+
+/**
+ * ConnmanProxyNotification:
+ *
+ * Abstract interface type for the D-Bus interface <link linkend="gdbus-interface-net-connman-Notification.top_of_page">net.connman.Notification</link>.
+ */
+
+/**
+ * ConnmanProxyNotificationIface:
+ * @parent_iface: The parent interface.
+ * @handle_release: Handler for the #ConnmanProxyNotification::handle-release signal.
+ * @handle_update: Handler for the #ConnmanProxyNotification::handle-update signal.
+ *
+ * Virtual table for the D-Bus interface <link linkend="gdbus-interface-net-connman-Notification.top_of_page">net.connman.Notification</link>.
+ */
+
+static void
+connman_proxy_notification_default_init (ConnmanProxyNotificationIface *iface)
+{
+  /* GObject signals for incoming D-Bus method calls: */
+  /**
+   * ConnmanProxyNotification::handle-release:
+   * @object: A #ConnmanProxyNotification.
+   * @invocation: A #GDBusMethodInvocation.
+   *
+   * Signal emitted when a remote caller is invoking the <link linkend="gdbus-method-net-connman-Notification.Release">Release()</link> D-Bus method.
+   *
+   * If a signal handler returns %TRUE, it means the signal handler will handle the invocation (e.g. take a reference to @invocation and eventually call connman_proxy_notification_complete_release() or e.g. g_dbus_method_invocation_return_error() on it) and no order signal handlers will run. If no signal handler handles the invocation, the %G_DBUS_ERROR_UNKNOWN_METHOD error is returned.
+   *
+   * Returns: %TRUE if the invocation was handled, %FALSE to let other signal handlers run.
+   */
+  g_signal_new ("handle-release",
+    G_TYPE_FROM_INTERFACE (iface),
+    G_SIGNAL_RUN_LAST,
+    G_STRUCT_OFFSET (ConnmanProxyNotificationIface, handle_release),
+    g_signal_accumulator_true_handled,
+    NULL,
+    g_cclosure_marshal_generic,
+    G_TYPE_BOOLEAN,
+    1,
+    G_TYPE_DBUS_METHOD_INVOCATION);
+
+  /**
+   * ConnmanProxyNotification::handle-update:
+   * @object: A #ConnmanProxyNotification.
+   * @invocation: A #GDBusMethodInvocation.
+   * @arg_unnamed_arg0: Argument passed by remote caller.
+   *
+   * Signal emitted when a remote caller is invoking the <link linkend="gdbus-method-net-connman-Notification.Update">Update()</link> D-Bus method.
+   *
+   * If a signal handler returns %TRUE, it means the signal handler will handle the invocation (e.g. take a reference to @invocation and eventually call connman_proxy_notification_complete_update() or e.g. g_dbus_method_invocation_return_error() on it) and no order signal handlers will run. If no signal handler handles the invocation, the %G_DBUS_ERROR_UNKNOWN_METHOD error is returned.
+   *
+   * Returns: %TRUE if the invocation was handled, %FALSE to let other signal handlers run.
+   */
+  g_signal_new ("handle-update",
+    G_TYPE_FROM_INTERFACE (iface),
+    G_SIGNAL_RUN_LAST,
+    G_STRUCT_OFFSET (ConnmanProxyNotificationIface, handle_update),
+    g_signal_accumulator_true_handled,
+    NULL,
+    g_cclosure_marshal_generic,
+    G_TYPE_BOOLEAN,
+    2,
+    G_TYPE_DBUS_METHOD_INVOCATION, G_TYPE_VARIANT);
+
+}
+
+typedef ConnmanProxyNotificationIface ConnmanProxyNotificationInterface;
+G_DEFINE_INTERFACE (ConnmanProxyNotification, connman_proxy_notification, G_TYPE_OBJECT);
+
+/**
+ * connman_proxy_notification_call_release:
+ * @proxy: A #ConnmanProxyNotificationProxy.
+ * @cancellable: (allow-none): A #GCancellable or %NULL.
+ * @callback: A #GAsyncReadyCallback to call when the request is satisfied or %NULL.
+ * @user_data: User data to pass to @callback.
+ *
+ * Asynchronously invokes the <link linkend="gdbus-method-net-connman-Notification.Release">Release()</link> D-Bus method on @proxy.
+ * When the operation is finished, @callback will be invoked in the <link linkend="g-main-context-push-thread-default">thread-default main loop</link> of the thread you are calling this method from.
+ * You can then call connman_proxy_notification_call_release_finish() to get the result of the operation.
+ *
+ * See connman_proxy_notification_call_release_sync() for the synchronous, blocking version of this method.
+ */
+void
+connman_proxy_notification_call_release (
+    ConnmanProxyNotification *proxy,
+    GCancellable *cancellable,
+    GAsyncReadyCallback callback,
+    gpointer user_data)
+{
+  g_dbus_proxy_call (G_DBUS_PROXY (proxy),
+    "Release",
+    g_variant_new ("()"),
+    G_DBUS_CALL_FLAGS_NONE,
+    -1,
+    cancellable,
+    callback,
+    user_data);
+}
+
+/**
+ * connman_proxy_notification_call_release_finish:
+ * @proxy: A #ConnmanProxyNotificationProxy.
+ * @res: The #GAsyncResult obtained from the #GAsyncReadyCallback passed to connman_proxy_notification_call_release().
+ * @error: Return location for error or %NULL.
+ *
+ * Finishes an operation started with connman_proxy_notification_call_release().
+ *
+ * Returns: (skip): %TRUE if the call succeded, %FALSE if @error is set.
+ */
+gboolean
+connman_proxy_notification_call_release_finish (
+    ConnmanProxyNotification *proxy,
+    GAsyncResult *res,
+    GError **error)
+{
+  GVariant *_ret;
+  _ret = g_dbus_proxy_call_finish (G_DBUS_PROXY (proxy), res, error);
+  if (_ret == NULL)
+    goto _out;
+  g_variant_get (_ret,
+                 "()");
+  g_variant_unref (_ret);
+_out:
+  return _ret != NULL;
+}
+
+/**
+ * connman_proxy_notification_call_release_sync:
+ * @proxy: A #ConnmanProxyNotificationProxy.
+ * @cancellable: (allow-none): A #GCancellable or %NULL.
+ * @error: Return location for error or %NULL.
+ *
+ * Synchronously invokes the <link linkend="gdbus-method-net-connman-Notification.Release">Release()</link> D-Bus method on @proxy. The calling thread is blocked until a reply is received.
+ *
+ * See connman_proxy_notification_call_release() for the asynchronous version of this method.
+ *
+ * Returns: (skip): %TRUE if the call succeded, %FALSE if @error is set.
+ */
+gboolean
+connman_proxy_notification_call_release_sync (
+    ConnmanProxyNotification *proxy,
+    GCancellable *cancellable,
+    GError **error)
+{
+  GVariant *_ret;
+  _ret = g_dbus_proxy_call_sync (G_DBUS_PROXY (proxy),
+    "Release",
+    g_variant_new ("()"),
+    G_DBUS_CALL_FLAGS_NONE,
+    -1,
+    cancellable,
+    error);
+  if (_ret == NULL)
+    goto _out;
+  g_variant_get (_ret,
+                 "()");
+  g_variant_unref (_ret);
+_out:
+  return _ret != NULL;
+}
+
+/**
+ * connman_proxy_notification_call_update:
+ * @proxy: A #ConnmanProxyNotificationProxy.
+ * @arg_unnamed_arg0: Argument to pass with the method invocation.
+ * @cancellable: (allow-none): A #GCancellable or %NULL.
+ * @callback: A #GAsyncReadyCallback to call when the request is satisfied or %NULL.
+ * @user_data: User data to pass to @callback.
+ *
+ * Asynchronously invokes the <link linkend="gdbus-method-net-connman-Notification.Update">Update()</link> D-Bus method on @proxy.
+ * When the operation is finished, @callback will be invoked in the <link linkend="g-main-context-push-thread-default">thread-default main loop</link> of the thread you are calling this method from.
+ * You can then call connman_proxy_notification_call_update_finish() to get the result of the operation.
+ *
+ * See connman_proxy_notification_call_update_sync() for the synchronous, blocking version of this method.
+ */
+void
+connman_proxy_notification_call_update (
+    ConnmanProxyNotification *proxy,
+    GVariant *arg_unnamed_arg0,
+    GCancellable *cancellable,
+    GAsyncReadyCallback callback,
+    gpointer user_data)
+{
+  g_dbus_proxy_call (G_DBUS_PROXY (proxy),
+    "Update",
+    g_variant_new ("(@a{sv})",
+                   arg_unnamed_arg0),
+    G_DBUS_CALL_FLAGS_NONE,
+    -1,
+    cancellable,
+    callback,
+    user_data);
+}
+
+/**
+ * connman_proxy_notification_call_update_finish:
+ * @proxy: A #ConnmanProxyNotificationProxy.
+ * @res: The #GAsyncResult obtained from the #GAsyncReadyCallback passed to connman_proxy_notification_call_update().
+ * @error: Return location for error or %NULL.
+ *
+ * Finishes an operation started with connman_proxy_notification_call_update().
+ *
+ * Returns: (skip): %TRUE if the call succeded, %FALSE if @error is set.
+ */
+gboolean
+connman_proxy_notification_call_update_finish (
+    ConnmanProxyNotification *proxy,
+    GAsyncResult *res,
+    GError **error)
+{
+  GVariant *_ret;
+  _ret = g_dbus_proxy_call_finish (G_DBUS_PROXY (proxy), res, error);
+  if (_ret == NULL)
+    goto _out;
+  g_variant_get (_ret,
+                 "()");
+  g_variant_unref (_ret);
+_out:
+  return _ret != NULL;
+}
+
+/**
+ * connman_proxy_notification_call_update_sync:
+ * @proxy: A #ConnmanProxyNotificationProxy.
+ * @arg_unnamed_arg0: Argument to pass with the method invocation.
+ * @cancellable: (allow-none): A #GCancellable or %NULL.
+ * @error: Return location for error or %NULL.
+ *
+ * Synchronously invokes the <link linkend="gdbus-method-net-connman-Notification.Update">Update()</link> D-Bus method on @proxy. The calling thread is blocked until a reply is received.
+ *
+ * See connman_proxy_notification_call_update() for the asynchronous version of this method.
+ *
+ * Returns: (skip): %TRUE if the call succeded, %FALSE if @error is set.
+ */
+gboolean
+connman_proxy_notification_call_update_sync (
+    ConnmanProxyNotification *proxy,
+    GVariant *arg_unnamed_arg0,
+    GCancellable *cancellable,
+    GError **error)
+{
+  GVariant *_ret;
+  _ret = g_dbus_proxy_call_sync (G_DBUS_PROXY (proxy),
+    "Update",
+    g_variant_new ("(@a{sv})",
+                   arg_unnamed_arg0),
+    G_DBUS_CALL_FLAGS_NONE,
+    -1,
+    cancellable,
+    error);
+  if (_ret == NULL)
+    goto _out;
+  g_variant_get (_ret,
+                 "()");
+  g_variant_unref (_ret);
+_out:
+  return _ret != NULL;
+}
+
+/**
+ * connman_proxy_notification_complete_release:
+ * @object: A #ConnmanProxyNotification.
+ * @invocation: (transfer full): A #GDBusMethodInvocation.
+ *
+ * Helper function used in service implementations to finish handling invocations of the <link linkend="gdbus-method-net-connman-Notification.Release">Release()</link> D-Bus method. If you instead want to finish handling an invocation by returning an error, use g_dbus_method_invocation_return_error() or similar.
+ *
+ * This method will free @invocation, you cannot use it afterwards.
+ */
+void
+connman_proxy_notification_complete_release (
+    ConnmanProxyNotification *object,
+    GDBusMethodInvocation *invocation)
+{
+  g_dbus_method_invocation_return_value (invocation,
+    g_variant_new ("()"));
+}
+
+/**
+ * connman_proxy_notification_complete_update:
+ * @object: A #ConnmanProxyNotification.
+ * @invocation: (transfer full): A #GDBusMethodInvocation.
+ *
+ * Helper function used in service implementations to finish handling invocations of the <link linkend="gdbus-method-net-connman-Notification.Update">Update()</link> D-Bus method. If you instead want to finish handling an invocation by returning an error, use g_dbus_method_invocation_return_error() or similar.
+ *
+ * This method will free @invocation, you cannot use it afterwards.
+ */
+void
+connman_proxy_notification_complete_update (
+    ConnmanProxyNotification *object,
+    GDBusMethodInvocation *invocation)
+{
+  g_dbus_method_invocation_return_value (invocation,
+    g_variant_new ("()"));
+}
+
+/* ------------------------------------------------------------------------ */
+
+/**
+ * ConnmanProxyNotificationProxy:
+ *
+ * The #ConnmanProxyNotificationProxy structure contains only private data and should only be accessed using the provided API.
+ */
+
+/**
+ * ConnmanProxyNotificationProxyClass:
+ * @parent_class: The parent class.
+ *
+ * Class structure for #ConnmanProxyNotificationProxy.
+ */
+
+struct _ConnmanProxyNotificationProxyPrivate
+{
+  GData *qdata;
+};
+
+static void connman_proxy_notification_proxy_iface_init (ConnmanProxyNotificationIface *iface);
+
+G_DEFINE_TYPE_WITH_CODE (ConnmanProxyNotificationProxy, connman_proxy_notification_proxy, G_TYPE_DBUS_PROXY,
+                         G_IMPLEMENT_INTERFACE (CONNMAN_PROXY_TYPE_NOTIFICATION, connman_proxy_notification_proxy_iface_init));
+
+static void
+connman_proxy_notification_proxy_finalize (GObject *object)
+{
+  ConnmanProxyNotificationProxy *proxy = CONNMAN_PROXY_NOTIFICATION_PROXY (object);
+  g_datalist_clear (&proxy->priv->qdata);
+  G_OBJECT_CLASS (connman_proxy_notification_proxy_parent_class)->finalize (object);
+}
+
+static void
+connman_proxy_notification_proxy_get_property (GObject      *object,
+  guint         prop_id,
+  GValue       *value,
+  GParamSpec   *pspec)
+{
+}
+
+static void
+connman_proxy_notification_proxy_set_property (GObject      *object,
+  guint         prop_id,
+  const GValue *value,
+  GParamSpec   *pspec)
+{
+}
+
+static void
+connman_proxy_notification_proxy_g_signal (GDBusProxy *proxy,
+  const gchar *sender_name,
+  const gchar *signal_name,
+  GVariant *parameters)
+{
+  _ExtendedGDBusSignalInfo *info;
+  GVariantIter iter;
+  GVariant *child;
+  GValue *paramv;
+  guint num_params;
+  guint n;
+  guint signal_id;
+  info = (_ExtendedGDBusSignalInfo *) g_dbus_interface_info_lookup_signal ((GDBusInterfaceInfo *) &_connman_proxy_notification_interface_info, signal_name);
+  if (info == NULL)
+    return;
+  num_params = g_variant_n_children (parameters);
+  paramv = g_new0 (GValue, num_params + 1);
+  g_value_init (&paramv[0], CONNMAN_PROXY_TYPE_NOTIFICATION);
+  g_value_set_object (&paramv[0], proxy);
+  g_variant_iter_init (&iter, parameters);
+  n = 1;
+  while ((child = g_variant_iter_next_value (&iter)) != NULL)
+    {
+      _ExtendedGDBusArgInfo *arg_info = (_ExtendedGDBusArgInfo *) info->parent_struct.args[n - 1];
+      if (arg_info->use_gvariant)
+        {
+          g_value_init (&paramv[n], G_TYPE_VARIANT);
+          g_value_set_variant (&paramv[n], child);
+          n++;
+        }
+      else
+        g_dbus_gvariant_to_gvalue (child, &paramv[n++]);
+      g_variant_unref (child);
+    }
+  signal_id = g_signal_lookup (info->signal_name, CONNMAN_PROXY_TYPE_NOTIFICATION);
+  g_signal_emitv (paramv, signal_id, 0, NULL);
+  for (n = 0; n < num_params + 1; n++)
+    g_value_unset (&paramv[n]);
+  g_free (paramv);
+}
+
+static void
+connman_proxy_notification_proxy_g_properties_changed (GDBusProxy *_proxy,
+  GVariant *changed_properties,
+  const gchar *const *invalidated_properties)
+{
+  ConnmanProxyNotificationProxy *proxy = CONNMAN_PROXY_NOTIFICATION_PROXY (_proxy);
+  guint n;
+  const gchar *key;
+  GVariantIter *iter;
+  _ExtendedGDBusPropertyInfo *info;
+  g_variant_get (changed_properties, "a{sv}", &iter);
+  while (g_variant_iter_next (iter, "{&sv}", &key, NULL))
+    {
+      info = (_ExtendedGDBusPropertyInfo *) g_dbus_interface_info_lookup_property ((GDBusInterfaceInfo *) &_connman_proxy_notification_interface_info, key);
+      g_datalist_remove_data (&proxy->priv->qdata, key);
+      if (info != NULL)
+        g_object_notify (G_OBJECT (proxy), info->hyphen_name);
+    }
+  g_variant_iter_free (iter);
+  for (n = 0; invalidated_properties[n] != NULL; n++)
+    {
+      info = (_ExtendedGDBusPropertyInfo *) g_dbus_interface_info_lookup_property ((GDBusInterfaceInfo *) &_connman_proxy_notification_interface_info, invalidated_properties[n]);
+      g_datalist_remove_data (&proxy->priv->qdata, invalidated_properties[n]);
+      if (info != NULL)
+        g_object_notify (G_OBJECT (proxy), info->hyphen_name);
+    }
+}
+
+static void
+connman_proxy_notification_proxy_init (ConnmanProxyNotificationProxy *proxy)
+{
+  proxy->priv = G_TYPE_INSTANCE_GET_PRIVATE (proxy, CONNMAN_PROXY_TYPE_NOTIFICATION_PROXY, ConnmanProxyNotificationProxyPrivate);
+  g_dbus_proxy_set_interface_info (G_DBUS_PROXY (proxy), connman_proxy_notification_interface_info ());
+}
+
+static void
+connman_proxy_notification_proxy_class_init (ConnmanProxyNotificationProxyClass *klass)
+{
+  GObjectClass *gobject_class;
+  GDBusProxyClass *proxy_class;
+
+  g_type_class_add_private (klass, sizeof (ConnmanProxyNotificationProxyPrivate));
+
+  gobject_class = G_OBJECT_CLASS (klass);
+  gobject_class->finalize     = connman_proxy_notification_proxy_finalize;
+  gobject_class->get_property = connman_proxy_notification_proxy_get_property;
+  gobject_class->set_property = connman_proxy_notification_proxy_set_property;
+
+  proxy_class = G_DBUS_PROXY_CLASS (klass);
+  proxy_class->g_signal = connman_proxy_notification_proxy_g_signal;
+  proxy_class->g_properties_changed = connman_proxy_notification_proxy_g_properties_changed;
+
+}
+
+static void
+connman_proxy_notification_proxy_iface_init (ConnmanProxyNotificationIface *iface)
+{
+}
+
+/**
+ * connman_proxy_notification_proxy_new:
+ * @connection: A #GDBusConnection.
+ * @flags: Flags from the #GDBusProxyFlags enumeration.
+ * @name: (allow-none): A bus name (well-known or unique) or %NULL if @connection is not a message bus connection.
+ * @object_path: An object path.
+ * @cancellable: (allow-none): A #GCancellable or %NULL.
+ * @callback: A #GAsyncReadyCallback to call when the request is satisfied.
+ * @user_data: User data to pass to @callback.
+ *
+ * Asynchronously creates a proxy for the D-Bus interface <link linkend="gdbus-interface-net-connman-Notification.top_of_page">net.connman.Notification</link>. See g_dbus_proxy_new() for more details.
+ *
+ * When the operation is finished, @callback will be invoked in the <link linkend="g-main-context-push-thread-default">thread-default main loop</link> of the thread you are calling this method from.
+ * You can then call connman_proxy_notification_proxy_new_finish() to get the result of the operation.
+ *
+ * See connman_proxy_notification_proxy_new_sync() for the synchronous, blocking version of this constructor.
+ */
+void
+connman_proxy_notification_proxy_new (
+    GDBusConnection     *connection,
+    GDBusProxyFlags      flags,
+    const gchar         *name,
+    const gchar         *object_path,
+    GCancellable        *cancellable,
+    GAsyncReadyCallback  callback,
+    gpointer             user_data)
+{
+  g_async_initable_new_async (CONNMAN_PROXY_TYPE_NOTIFICATION_PROXY, G_PRIORITY_DEFAULT, cancellable, callback, user_data, "g-flags", flags, "g-name", name, "g-connection", connection, "g-object-path", object_path, "g-interface-name", "net.connman.Notification", NULL);
+}
+
+/**
+ * connman_proxy_notification_proxy_new_finish:
+ * @res: The #GAsyncResult obtained from the #GAsyncReadyCallback passed to connman_proxy_notification_proxy_new().
+ * @error: Return location for error or %NULL
+ *
+ * Finishes an operation started with connman_proxy_notification_proxy_new().
+ *
+ * Returns: (transfer full) (type ConnmanProxyNotificationProxy): The constructed proxy object or %NULL if @error is set.
+ */
+ConnmanProxyNotification *
+connman_proxy_notification_proxy_new_finish (
+    GAsyncResult        *res,
+    GError             **error)
+{
+  GObject *ret;
+  GObject *source_object;
+  source_object = g_async_result_get_source_object (res);
+  ret = g_async_initable_new_finish (G_ASYNC_INITABLE (source_object), res, error);
+  g_object_unref (source_object);
+  if (ret != NULL)
+    return CONNMAN_PROXY_NOTIFICATION (ret);
+  else
+    return NULL;
+}
+
+/**
+ * connman_proxy_notification_proxy_new_sync:
+ * @connection: A #GDBusConnection.
+ * @flags: Flags from the #GDBusProxyFlags enumeration.
+ * @name: (allow-none): A bus name (well-known or unique) or %NULL if @connection is not a message bus connection.
+ * @object_path: An object path.
+ * @cancellable: (allow-none): A #GCancellable or %NULL.
+ * @error: Return location for error or %NULL
+ *
+ * Synchronously creates a proxy for the D-Bus interface <link linkend="gdbus-interface-net-connman-Notification.top_of_page">net.connman.Notification</link>. See g_dbus_proxy_new_sync() for more details.
+ *
+ * The calling thread is blocked until a reply is received.
+ *
+ * See connman_proxy_notification_proxy_new() for the asynchronous version of this constructor.
+ *
+ * Returns: (transfer full) (type ConnmanProxyNotificationProxy): The constructed proxy object or %NULL if @error is set.
+ */
+ConnmanProxyNotification *
+connman_proxy_notification_proxy_new_sync (
+    GDBusConnection     *connection,
+    GDBusProxyFlags      flags,
+    const gchar         *name,
+    const gchar         *object_path,
+    GCancellable        *cancellable,
+    GError             **error)
+{
+  GInitable *ret;
+  ret = g_initable_new (CONNMAN_PROXY_TYPE_NOTIFICATION_PROXY, cancellable, error, "g-flags", flags, "g-name", name, "g-connection", connection, "g-object-path", object_path, "g-interface-name", "net.connman.Notification", NULL);
+  if (ret != NULL)
+    return CONNMAN_PROXY_NOTIFICATION (ret);
+  else
+    return NULL;
+}
+
+
+/**
+ * connman_proxy_notification_proxy_new_for_bus:
+ * @bus_type: A #GBusType.
+ * @flags: Flags from the #GDBusProxyFlags enumeration.
+ * @name: A bus name (well-known or unique).
+ * @object_path: An object path.
+ * @cancellable: (allow-none): A #GCancellable or %NULL.
+ * @callback: A #GAsyncReadyCallback to call when the request is satisfied.
+ * @user_data: User data to pass to @callback.
+ *
+ * Like connman_proxy_notification_proxy_new() but takes a #GBusType instead of a #GDBusConnection.
+ *
+ * When the operation is finished, @callback will be invoked in the <link linkend="g-main-context-push-thread-default">thread-default main loop</link> of the thread you are calling this method from.
+ * You can then call connman_proxy_notification_proxy_new_for_bus_finish() to get the result of the operation.
+ *
+ * See connman_proxy_notification_proxy_new_for_bus_sync() for the synchronous, blocking version of this constructor.
+ */
+void
+connman_proxy_notification_proxy_new_for_bus (
+    GBusType             bus_type,
+    GDBusProxyFlags      flags,
+    const gchar         *name,
+    const gchar         *object_path,
+    GCancellable        *cancellable,
+    GAsyncReadyCallback  callback,
+    gpointer             user_data)
+{
+  g_async_initable_new_async (CONNMAN_PROXY_TYPE_NOTIFICATION_PROXY, G_PRIORITY_DEFAULT, cancellable, callback, user_data, "g-flags", flags, "g-name", name, "g-bus-type", bus_type, "g-object-path", object_path, "g-interface-name", "net.connman.Notification", NULL);
+}
+
+/**
+ * connman_proxy_notification_proxy_new_for_bus_finish:
+ * @res: The #GAsyncResult obtained from the #GAsyncReadyCallback passed to connman_proxy_notification_proxy_new_for_bus().
+ * @error: Return location for error or %NULL
+ *
+ * Finishes an operation started with connman_proxy_notification_proxy_new_for_bus().
+ *
+ * Returns: (transfer full) (type ConnmanProxyNotificationProxy): The constructed proxy object or %NULL if @error is set.
+ */
+ConnmanProxyNotification *
+connman_proxy_notification_proxy_new_for_bus_finish (
+    GAsyncResult        *res,
+    GError             **error)
+{
+  GObject *ret;
+  GObject *source_object;
+  source_object = g_async_result_get_source_object (res);
+  ret = g_async_initable_new_finish (G_ASYNC_INITABLE (source_object), res, error);
+  g_object_unref (source_object);
+  if (ret != NULL)
+    return CONNMAN_PROXY_NOTIFICATION (ret);
+  else
+    return NULL;
+}
+
+/**
+ * connman_proxy_notification_proxy_new_for_bus_sync:
+ * @bus_type: A #GBusType.
+ * @flags: Flags from the #GDBusProxyFlags enumeration.
+ * @name: A bus name (well-known or unique).
+ * @object_path: An object path.
+ * @cancellable: (allow-none): A #GCancellable or %NULL.
+ * @error: Return location for error or %NULL
+ *
+ * Like connman_proxy_notification_proxy_new_sync() but takes a #GBusType instead of a #GDBusConnection.
+ *
+ * The calling thread is blocked until a reply is received.
+ *
+ * See connman_proxy_notification_proxy_new_for_bus() for the asynchronous version of this constructor.
+ *
+ * Returns: (transfer full) (type ConnmanProxyNotificationProxy): The constructed proxy object or %NULL if @error is set.
+ */
+ConnmanProxyNotification *
+connman_proxy_notification_proxy_new_for_bus_sync (
+    GBusType             bus_type,
+    GDBusProxyFlags      flags,
+    const gchar         *name,
+    const gchar         *object_path,
+    GCancellable        *cancellable,
+    GError             **error)
+{
+  GInitable *ret;
+  ret = g_initable_new (CONNMAN_PROXY_TYPE_NOTIFICATION_PROXY, cancellable, error, "g-flags", flags, "g-name", name, "g-bus-type", bus_type, "g-object-path", object_path, "g-interface-name", "net.connman.Notification", NULL);
+  if (ret != NULL)
+    return CONNMAN_PROXY_NOTIFICATION (ret);
+  else
+    return NULL;
+}
+
+
+/* ------------------------------------------------------------------------ */
+
+/**
+ * ConnmanProxyNotificationSkeleton:
+ *
+ * The #ConnmanProxyNotificationSkeleton structure contains only private data and should only be accessed using the provided API.
+ */
+
+/**
+ * ConnmanProxyNotificationSkeletonClass:
+ * @parent_class: The parent class.
+ *
+ * Class structure for #ConnmanProxyNotificationSkeleton.
+ */
+
+struct _ConnmanProxyNotificationSkeletonPrivate
+{
+  GValueArray *properties;
+  GList *changed_properties;
+  GSource *changed_properties_idle_source;
+  GMainContext *context;
+  GMutex *lock;
+};
+
+static void
+_connman_proxy_notification_skeleton_handle_method_call (
+  GDBusConnection *connection,
+  const gchar *sender,
+  const gchar *object_path,
+  const gchar *interface_name,
+  const gchar *method_name,
+  GVariant *parameters,
+  GDBusMethodInvocation *invocation,
+  gpointer user_data)
+{
+  ConnmanProxyNotificationSkeleton *skeleton = CONNMAN_PROXY_NOTIFICATION_SKELETON (user_data);
+  _ExtendedGDBusMethodInfo *info;
+  GVariantIter iter;
+  GVariant *child;
+  GValue *paramv;
+  guint num_params;
+  guint num_extra;
+  guint n;
+  guint signal_id;
+  GValue return_value = {0};
+  info = (_ExtendedGDBusMethodInfo *) g_dbus_method_invocation_get_method_info (invocation);
+  g_assert (info != NULL);
+  num_params = g_variant_n_children (parameters);
+  num_extra = info->pass_fdlist ? 3 : 2;  paramv = g_new0 (GValue, num_params + num_extra);
+  n = 0;
+  g_value_init (&paramv[n], CONNMAN_PROXY_TYPE_NOTIFICATION);
+  g_value_set_object (&paramv[n++], skeleton);
+  g_value_init (&paramv[n], G_TYPE_DBUS_METHOD_INVOCATION);
+  g_value_set_object (&paramv[n++], invocation);
+  if (info->pass_fdlist)
+    {
+#ifdef G_OS_UNIX
+      g_value_init (&paramv[n], G_TYPE_UNIX_FD_LIST);
+      g_value_set_object (&paramv[n++], g_dbus_message_get_unix_fd_list (g_dbus_method_invocation_get_message (invocation)));
+#else
+      g_assert_not_reached ();
+#endif
+    }
+  g_variant_iter_init (&iter, parameters);
+  while ((child = g_variant_iter_next_value (&iter)) != NULL)
+    {
+      _ExtendedGDBusArgInfo *arg_info = (_ExtendedGDBusArgInfo *) info->parent_struct.in_args[n - num_extra];
+      if (arg_info->use_gvariant)
+        {
+          g_value_init (&paramv[n], G_TYPE_VARIANT);
+          g_value_set_variant (&paramv[n], child);
+          n++;
+        }
+      else
+        g_dbus_gvariant_to_gvalue (child, &paramv[n++]);
+      g_variant_unref (child);
+    }
+  signal_id = g_signal_lookup (info->signal_name, CONNMAN_PROXY_TYPE_NOTIFICATION);
+  g_value_init (&return_value, G_TYPE_BOOLEAN);
+  g_signal_emitv (paramv, signal_id, 0, &return_value);
+  if (!g_value_get_boolean (&return_value))
+    g_dbus_method_invocation_return_error (invocation, G_DBUS_ERROR, G_DBUS_ERROR_UNKNOWN_METHOD, "Method %s is not implemented on interface %s", method_name, interface_name);
+  g_value_unset (&return_value);
+  for (n = 0; n < num_params + num_extra; n++)
+    g_value_unset (&paramv[n]);
+  g_free (paramv);
+}
+
+static GVariant *
+_connman_proxy_notification_skeleton_handle_get_property (
+  GDBusConnection *connection,
+  const gchar *sender,
+  const gchar *object_path,
+  const gchar *interface_name,
+  const gchar *property_name,
+  GError **error,
+  gpointer user_data)
+{
+  ConnmanProxyNotificationSkeleton *skeleton = CONNMAN_PROXY_NOTIFICATION_SKELETON (user_data);
+  GValue value = {0};
+  GParamSpec *pspec;
+  _ExtendedGDBusPropertyInfo *info;
+  GVariant *ret;
+  ret = NULL;
+  info = (_ExtendedGDBusPropertyInfo *) g_dbus_interface_info_lookup_property ((GDBusInterfaceInfo *) &_connman_proxy_notification_interface_info, property_name);
+  g_assert (info != NULL);
+  pspec = g_object_class_find_property (G_OBJECT_GET_CLASS (skeleton), info->hyphen_name);
+  if (pspec == NULL)
+    {
+      g_set_error (error, G_DBUS_ERROR, G_DBUS_ERROR_INVALID_ARGS, "No property with name %s", property_name);
+    }
+  else
+    {
+      g_value_init (&value, pspec->value_type);
+      g_object_get_property (G_OBJECT (skeleton), info->hyphen_name, &value);
+      ret = g_dbus_gvalue_to_gvariant (&value, G_VARIANT_TYPE (info->parent_struct.signature));
+      g_value_unset (&value);
+    }
+  return ret;
+}
+
+static gboolean
+_connman_proxy_notification_skeleton_handle_set_property (
+  GDBusConnection *connection,
+  const gchar *sender,
+  const gchar *object_path,
+  const gchar *interface_name,
+  const gchar *property_name,
+  GVariant *variant,
+  GError **error,
+  gpointer user_data)
+{
+  ConnmanProxyNotificationSkeleton *skeleton = CONNMAN_PROXY_NOTIFICATION_SKELETON (user_data);
+  GValue value = {0};
+  GParamSpec *pspec;
+  _ExtendedGDBusPropertyInfo *info;
+  gboolean ret;
+  ret = FALSE;
+  info = (_ExtendedGDBusPropertyInfo *) g_dbus_interface_info_lookup_property ((GDBusInterfaceInfo *) &_connman_proxy_notification_interface_info, property_name);
+  g_assert (info != NULL);
+  pspec = g_object_class_find_property (G_OBJECT_GET_CLASS (skeleton), info->hyphen_name);
+  if (pspec == NULL)
+    {
+      g_set_error (error, G_DBUS_ERROR, G_DBUS_ERROR_INVALID_ARGS, "No property with name %s", property_name);
+    }
+  else
+    {
+      if (info->use_gvariant)
+        g_value_set_variant (&value, variant);
+      else
+        g_dbus_gvariant_to_gvalue (variant, &value);
+      g_object_set_property (G_OBJECT (skeleton), info->hyphen_name, &value);
+      g_value_unset (&value);
+      ret = TRUE;
+    }
+  return ret;
+}
+
+static const GDBusInterfaceVTable _connman_proxy_notification_skeleton_vtable =
+{
+  _connman_proxy_notification_skeleton_handle_method_call,
+  _connman_proxy_notification_skeleton_handle_get_property,
+  _connman_proxy_notification_skeleton_handle_set_property
+};
+
+static GDBusInterfaceInfo *
+connman_proxy_notification_skeleton_dbus_interface_get_info (GDBusInterfaceSkeleton *skeleton)
+{
+  return connman_proxy_notification_interface_info ();
+}
+
+static GDBusInterfaceVTable *
+connman_proxy_notification_skeleton_dbus_interface_get_vtable (GDBusInterfaceSkeleton *skeleton)
+{
+  return (GDBusInterfaceVTable *) &_connman_proxy_notification_skeleton_vtable;
+}
+
+static GVariant *
+connman_proxy_notification_skeleton_dbus_interface_get_properties (GDBusInterfaceSkeleton *_skeleton)
+{
+  ConnmanProxyNotificationSkeleton *skeleton = CONNMAN_PROXY_NOTIFICATION_SKELETON (_skeleton);
+
+  GVariantBuilder builder;
+  guint n;
+  g_variant_builder_init (&builder, G_VARIANT_TYPE ("a{sv}"));
+  if (_connman_proxy_notification_interface_info.parent_struct.properties == NULL)
+    goto out;
+  for (n = 0; _connman_proxy_notification_interface_info.parent_struct.properties[n] != NULL; n++)
+    {
+      GDBusPropertyInfo *info = _connman_proxy_notification_interface_info.parent_struct.properties[n];
+      if (info->flags & G_DBUS_PROPERTY_INFO_FLAGS_READABLE)
+        {
+          GVariant *value;
+          value = _connman_proxy_notification_skeleton_handle_get_property (g_dbus_interface_skeleton_get_connection (G_DBUS_INTERFACE_SKELETON (skeleton)), NULL, g_dbus_interface_skeleton_get_object_path (G_DBUS_INTERFACE_SKELETON (skeleton)), "net.connman.Notification", info->name, NULL, skeleton);
+          if (value != NULL)
+            {
+              g_variant_take_ref (value);
+              g_variant_builder_add (&builder, "{sv}", info->name, value);
+              g_variant_unref (value);
+            }
+        }
+    }
+out:
+  return g_variant_builder_end (&builder);
+}
+
+static void
+connman_proxy_notification_skeleton_dbus_interface_flush (GDBusInterfaceSkeleton *_skeleton)
+{
+}
+
+static void connman_proxy_notification_skeleton_iface_init (ConnmanProxyNotificationIface *iface);
+G_DEFINE_TYPE_WITH_CODE (ConnmanProxyNotificationSkeleton, connman_proxy_notification_skeleton, G_TYPE_DBUS_INTERFACE_SKELETON,
+                         G_IMPLEMENT_INTERFACE (CONNMAN_PROXY_TYPE_NOTIFICATION, connman_proxy_notification_skeleton_iface_init));
+
+static void
+connman_proxy_notification_skeleton_finalize (GObject *object)
+{
+  ConnmanProxyNotificationSkeleton *skeleton = CONNMAN_PROXY_NOTIFICATION_SKELETON (object);
+  g_list_foreach (skeleton->priv->changed_properties, (GFunc) _changed_property_free, NULL);
+  g_list_free (skeleton->priv->changed_properties);
+  if (skeleton->priv->changed_properties_idle_source != NULL)
+    g_source_destroy (skeleton->priv->changed_properties_idle_source);
+  if (skeleton->priv->context != NULL)
+    g_main_context_unref (skeleton->priv->context);
+  g_mutex_free (skeleton->priv->lock);
+  G_OBJECT_CLASS (connman_proxy_notification_skeleton_parent_class)->finalize (object);
+}
+
+static void
+connman_proxy_notification_skeleton_init (ConnmanProxyNotificationSkeleton *skeleton)
+{
+  skeleton->priv = G_TYPE_INSTANCE_GET_PRIVATE (skeleton, CONNMAN_PROXY_TYPE_NOTIFICATION_SKELETON, ConnmanProxyNotificationSkeletonPrivate);
+  skeleton->priv->lock = g_mutex_new ();
+  skeleton->priv->context = g_main_context_get_thread_default ();
+  if (skeleton->priv->context != NULL)
+    g_main_context_ref (skeleton->priv->context);
+}
+
+static void
+connman_proxy_notification_skeleton_class_init (ConnmanProxyNotificationSkeletonClass *klass)
+{
+  GObjectClass *gobject_class;
+  GDBusInterfaceSkeletonClass *skeleton_class;
+
+  g_type_class_add_private (klass, sizeof (ConnmanProxyNotificationSkeletonPrivate));
+
+  gobject_class = G_OBJECT_CLASS (klass);
+  gobject_class->finalize = connman_proxy_notification_skeleton_finalize;
+
+  skeleton_class = G_DBUS_INTERFACE_SKELETON_CLASS (klass);
+  skeleton_class->get_info = connman_proxy_notification_skeleton_dbus_interface_get_info;
+  skeleton_class->get_properties = connman_proxy_notification_skeleton_dbus_interface_get_properties;
+  skeleton_class->flush = connman_proxy_notification_skeleton_dbus_interface_flush;
+  skeleton_class->get_vtable = connman_proxy_notification_skeleton_dbus_interface_get_vtable;
+}
+
+static void
+connman_proxy_notification_skeleton_iface_init (ConnmanProxyNotificationIface *iface)
+{
+}
+
+/**
+ * connman_proxy_notification_skeleton_new:
+ *
+ * Creates a skeleton object for the D-Bus interface <link linkend="gdbus-interface-net-connman-Notification.top_of_page">net.connman.Notification</link>.
+ *
+ * Returns: (transfer full) (type ConnmanProxyNotificationSkeleton): The skeleton object.
+ */
+ConnmanProxyNotification *
+connman_proxy_notification_skeleton_new (void)
+{
+  return CONNMAN_PROXY_NOTIFICATION (g_object_new (CONNMAN_PROXY_TYPE_NOTIFICATION_SKELETON, NULL));
+}
+
+/* ------------------------------------------------------------------------
+ * Code for interface net.connman.Service
+ * ------------------------------------------------------------------------
+ */
+
+/**
+ * SECTION:ConnmanProxyService
+ * @title: ConnmanProxyService
+ * @short_description: Generated C code for the net.connman.Service D-Bus interface
+ *
+ * This section contains code for working with the <link linkend="gdbus-interface-net-connman-Service.top_of_page">net.connman.Service</link> D-Bus interface in C.
+ */
+
+/* ---- Introspection data for net.connman.Service ---- */
+
+static const _ExtendedGDBusArgInfo _connman_proxy_service_method_info_get_properties_OUT_ARG_unnamed_arg0 =
+{
+  {
+    -1,
+    "unnamed_arg0",
+    "a{sv}",
+    NULL
+  },
+  FALSE
+};
+
+static const _ExtendedGDBusArgInfo * const _connman_proxy_service_method_info_get_properties_OUT_ARG_pointers[] =
+{
+  &_connman_proxy_service_method_info_get_properties_OUT_ARG_unnamed_arg0,
+  NULL
+};
+
+static const _ExtendedGDBusMethodInfo _connman_proxy_service_method_info_get_properties =
+{
+  {
+    -1,
+    "GetProperties",
+    NULL,
+    (GDBusArgInfo **) &_connman_proxy_service_method_info_get_properties_OUT_ARG_pointers,
+    NULL
+  },
+  "handle-get-properties",
+  FALSE
+};
+
+static const _ExtendedGDBusArgInfo _connman_proxy_service_method_info_set_property_IN_ARG_unnamed_arg0 =
+{
+  {
+    -1,
+    "unnamed_arg0",
+    "s",
+    NULL
+  },
+  FALSE
+};
+
+static const _ExtendedGDBusArgInfo _connman_proxy_service_method_info_set_property_IN_ARG_unnamed_arg1 =
+{
+  {
+    -1,
+    "unnamed_arg1",
+    "v",
+    NULL
+  },
+  FALSE
+};
+
+static const _ExtendedGDBusArgInfo * const _connman_proxy_service_method_info_set_property_IN_ARG_pointers[] =
+{
+  &_connman_proxy_service_method_info_set_property_IN_ARG_unnamed_arg0,
+  &_connman_proxy_service_method_info_set_property_IN_ARG_unnamed_arg1,
+  NULL
+};
+
+static const _ExtendedGDBusMethodInfo _connman_proxy_service_method_info_set_property =
+{
+  {
+    -1,
+    "SetProperty",
+    (GDBusArgInfo **) &_connman_proxy_service_method_info_set_property_IN_ARG_pointers,
+    NULL,
+    NULL
+  },
+  "handle-set-property",
+  FALSE
+};
+
+static const _ExtendedGDBusArgInfo _connman_proxy_service_method_info_clear_property_IN_ARG_unnamed_arg0 =
+{
+  {
+    -1,
+    "unnamed_arg0",
+    "s",
+    NULL
+  },
+  FALSE
+};
+
+static const _ExtendedGDBusArgInfo * const _connman_proxy_service_method_info_clear_property_IN_ARG_pointers[] =
+{
+  &_connman_proxy_service_method_info_clear_property_IN_ARG_unnamed_arg0,
+  NULL
+};
+
+static const _ExtendedGDBusMethodInfo _connman_proxy_service_method_info_clear_property =
+{
+  {
+    -1,
+    "ClearProperty",
+    (GDBusArgInfo **) &_connman_proxy_service_method_info_clear_property_IN_ARG_pointers,
+    NULL,
+    NULL
+  },
+  "handle-clear-property",
+  FALSE
+};
+
+static const _ExtendedGDBusMethodInfo _connman_proxy_service_method_info_connect =
+{
+  {
+    -1,
+    "Connect",
+    NULL,
+    NULL,
+    NULL
+  },
+  "handle-connect",
+  FALSE
+};
+
+static const _ExtendedGDBusMethodInfo _connman_proxy_service_method_info_disconnect =
+{
+  {
+    -1,
+    "Disconnect",
+    NULL,
+    NULL,
+    NULL
+  },
+  "handle-disconnect",
+  FALSE
+};
+
+static const _ExtendedGDBusMethodInfo _connman_proxy_service_method_info_remove =
+{
+  {
+    -1,
+    "Remove",
+    NULL,
+    NULL,
+    NULL
+  },
+  "handle-remove",
+  FALSE
+};
+
+static const _ExtendedGDBusArgInfo _connman_proxy_service_method_info_move_before_IN_ARG_unnamed_arg0 =
+{
+  {
+    -1,
+    "unnamed_arg0",
+    "o",
+    NULL
+  },
+  FALSE
+};
+
+static const _ExtendedGDBusArgInfo * const _connman_proxy_service_method_info_move_before_IN_ARG_pointers[] =
+{
+  &_connman_proxy_service_method_info_move_before_IN_ARG_unnamed_arg0,
+  NULL
+};
+
+static const _ExtendedGDBusMethodInfo _connman_proxy_service_method_info_move_before =
+{
+  {
+    -1,
+    "MoveBefore",
+    (GDBusArgInfo **) &_connman_proxy_service_method_info_move_before_IN_ARG_pointers,
+    NULL,
+    NULL
+  },
+  "handle-move-before",
+  FALSE
+};
+
+static const _ExtendedGDBusArgInfo _connman_proxy_service_method_info_move_after_IN_ARG_unnamed_arg0 =
+{
+  {
+    -1,
+    "unnamed_arg0",
+    "o",
+    NULL
+  },
+  FALSE
+};
+
+static const _ExtendedGDBusArgInfo * const _connman_proxy_service_method_info_move_after_IN_ARG_pointers[] =
+{
+  &_connman_proxy_service_method_info_move_after_IN_ARG_unnamed_arg0,
+  NULL
+};
+
+static const _ExtendedGDBusMethodInfo _connman_proxy_service_method_info_move_after =
+{
+  {
+    -1,
+    "MoveAfter",
+    (GDBusArgInfo **) &_connman_proxy_service_method_info_move_after_IN_ARG_pointers,
+    NULL,
+    NULL
+  },
+  "handle-move-after",
+  FALSE
+};
+
+static const _ExtendedGDBusMethodInfo _connman_proxy_service_method_info_reset_counters =
+{
+  {
+    -1,
+    "ResetCounters",
+    NULL,
+    NULL,
+    NULL
+  },
+  "handle-reset-counters",
+  FALSE
+};
+
+static const _ExtendedGDBusMethodInfo * const _connman_proxy_service_method_info_pointers[] =
+{
+  &_connman_proxy_service_method_info_get_properties,
+  &_connman_proxy_service_method_info_set_property,
+  &_connman_proxy_service_method_info_clear_property,
+  &_connman_proxy_service_method_info_connect,
+  &_connman_proxy_service_method_info_disconnect,
+  &_connman_proxy_service_method_info_remove,
+  &_connman_proxy_service_method_info_move_before,
+  &_connman_proxy_service_method_info_move_after,
+  &_connman_proxy_service_method_info_reset_counters,
+  NULL
+};
+
+static const _ExtendedGDBusArgInfo _connman_proxy_service_signal_info_property_changed_ARG_unnamed_arg0 =
+{
+  {
+    -1,
+    "unnamed_arg0",
+    "s",
+    NULL
+  },
+  FALSE
+};
+
+static const _ExtendedGDBusArgInfo _connman_proxy_service_signal_info_property_changed_ARG_unnamed_arg1 =
+{
+  {
+    -1,
+    "unnamed_arg1",
+    "v",
+    NULL
+  },
+  FALSE
+};
+
+static const _ExtendedGDBusArgInfo * const _connman_proxy_service_signal_info_property_changed_ARG_pointers[] =
+{
+  &_connman_proxy_service_signal_info_property_changed_ARG_unnamed_arg0,
+  &_connman_proxy_service_signal_info_property_changed_ARG_unnamed_arg1,
+  NULL
+};
+
+static const _ExtendedGDBusSignalInfo _connman_proxy_service_signal_info_property_changed =
+{
+  {
+    -1,
+    "PropertyChanged",
+    (GDBusArgInfo **) &_connman_proxy_service_signal_info_property_changed_ARG_pointers,
+    NULL
+  },
+  "property-changed"
+};
+
+static const _ExtendedGDBusSignalInfo * const _connman_proxy_service_signal_info_pointers[] =
+{
+  &_connman_proxy_service_signal_info_property_changed,
+  NULL
+};
+
+static const _ExtendedGDBusInterfaceInfo _connman_proxy_service_interface_info =
+{
+  {
+    -1,
+    "net.connman.Service",
+    (GDBusMethodInfo **) &_connman_proxy_service_method_info_pointers,
+    (GDBusSignalInfo **) &_connman_proxy_service_signal_info_pointers,
+    NULL,
+    NULL
+  },
+  "service",
+};
+
+
+/**
+ * connman_proxy_service_interface_info:
+ *
+ * Gets a machine-readable description of the <link linkend="gdbus-interface-net-connman-Service.top_of_page">net.connman.Service</link> D-Bus interface.
+ *
+ * Returns: (transfer none): A #GDBusInterfaceInfo. Do not free.
+ */
+GDBusInterfaceInfo *
+connman_proxy_service_interface_info (void)
+{
+  return (GDBusInterfaceInfo *) &_connman_proxy_service_interface_info;
+}
+
+/**
+ * connman_proxy_service_override_properties:
+ * @klass: The class structure for a #GObject<!-- -->-derived class.
+ * @property_id_begin: The property id to assign to the first overridden property.
+ *
+ * Overrides all #GObject properties in the #ConnmanProxyService interface for a concrete class.
+ * The properties are overridden in the order they are defined.
+ *
+ * Returns: The last property id.
+ */
+guint
+connman_proxy_service_override_properties (GObjectClass *klass, guint property_id_begin)
+{
+  return property_id_begin - 1;
+}
+
+
+
+/**
+ * ConnmanProxyService:
+ *
+ * Abstract interface type for the D-Bus interface <link linkend="gdbus-interface-net-connman-Service.top_of_page">net.connman.Service</link>.
+ */
+
+/**
+ * ConnmanProxyServiceIface:
+ * @parent_iface: The parent interface.
+ * @handle_clear_property: Handler for the #ConnmanProxyService::handle-clear-property signal.
+ * @handle_connect: Handler for the #ConnmanProxyService::handle-connect signal.
+ * @handle_disconnect: Handler for the #ConnmanProxyService::handle-disconnect signal.
+ * @handle_get_properties: Handler for the #ConnmanProxyService::handle-get-properties signal.
+ * @handle_move_after: Handler for the #ConnmanProxyService::handle-move-after signal.
+ * @handle_move_before: Handler for the #ConnmanProxyService::handle-move-before signal.
+ * @handle_remove: Handler for the #ConnmanProxyService::handle-remove signal.
+ * @handle_reset_counters: Handler for the #ConnmanProxyService::handle-reset-counters signal.
+ * @handle_set_property: Handler for the #ConnmanProxyService::handle-set-property signal.
+ * @property_changed: Handler for the #ConnmanProxyService::property-changed signal.
+ *
+ * Virtual table for the D-Bus interface <link linkend="gdbus-interface-net-connman-Service.top_of_page">net.connman.Service</link>.
+ */
+
+static void
+connman_proxy_service_default_init (ConnmanProxyServiceIface *iface)
+{
+  /* GObject signals for incoming D-Bus method calls: */
+  /**
+   * ConnmanProxyService::handle-get-properties:
+   * @object: A #ConnmanProxyService.
+   * @invocation: A #GDBusMethodInvocation.
+   *
+   * Signal emitted when a remote caller is invoking the <link linkend="gdbus-method-net-connman-Service.GetProperties">GetProperties()</link> D-Bus method.
+   *
+   * If a signal handler returns %TRUE, it means the signal handler will handle the invocation (e.g. take a reference to @invocation and eventually call connman_proxy_service_complete_get_properties() or e.g. g_dbus_method_invocation_return_error() on it) and no order signal handlers will run. If no signal handler handles the invocation, the %G_DBUS_ERROR_UNKNOWN_METHOD error is returned.
+   *
+   * Returns: %TRUE if the invocation was handled, %FALSE to let other signal handlers run.
+   */
+  g_signal_new ("handle-get-properties",
+    G_TYPE_FROM_INTERFACE (iface),
+    G_SIGNAL_RUN_LAST,
+    G_STRUCT_OFFSET (ConnmanProxyServiceIface, handle_get_properties),
+    g_signal_accumulator_true_handled,
+    NULL,
+    g_cclosure_marshal_generic,
+    G_TYPE_BOOLEAN,
+    1,
+    G_TYPE_DBUS_METHOD_INVOCATION);
+
+  /**
+   * ConnmanProxyService::handle-set-property:
+   * @object: A #ConnmanProxyService.
+   * @invocation: A #GDBusMethodInvocation.
+   * @arg_unnamed_arg0: Argument passed by remote caller.
+   * @arg_unnamed_arg1: Argument passed by remote caller.
+   *
+   * Signal emitted when a remote caller is invoking the <link linkend="gdbus-method-net-connman-Service.SetProperty">SetProperty()</link> D-Bus method.
+   *
+   * If a signal handler returns %TRUE, it means the signal handler will handle the invocation (e.g. take a reference to @invocation and eventually call connman_proxy_service_complete_set_property() or e.g. g_dbus_method_invocation_return_error() on it) and no order signal handlers will run. If no signal handler handles the invocation, the %G_DBUS_ERROR_UNKNOWN_METHOD error is returned.
+   *
+   * Returns: %TRUE if the invocation was handled, %FALSE to let other signal handlers run.
+   */
+  g_signal_new ("handle-set-property",
+    G_TYPE_FROM_INTERFACE (iface),
+    G_SIGNAL_RUN_LAST,
+    G_STRUCT_OFFSET (ConnmanProxyServiceIface, handle_set_property),
+    g_signal_accumulator_true_handled,
+    NULL,
+    g_cclosure_marshal_generic,
+    G_TYPE_BOOLEAN,
+    3,
+    G_TYPE_DBUS_METHOD_INVOCATION, G_TYPE_STRING, G_TYPE_VARIANT);
+
+  /**
+   * ConnmanProxyService::handle-clear-property:
+   * @object: A #ConnmanProxyService.
+   * @invocation: A #GDBusMethodInvocation.
+   * @arg_unnamed_arg0: Argument passed by remote caller.
+   *
+   * Signal emitted when a remote caller is invoking the <link linkend="gdbus-method-net-connman-Service.ClearProperty">ClearProperty()</link> D-Bus method.
+   *
+   * If a signal handler returns %TRUE, it means the signal handler will handle the invocation (e.g. take a reference to @invocation and eventually call connman_proxy_service_complete_clear_property() or e.g. g_dbus_method_invocation_return_error() on it) and no order signal handlers will run. If no signal handler handles the invocation, the %G_DBUS_ERROR_UNKNOWN_METHOD error is returned.
+   *
+   * Returns: %TRUE if the invocation was handled, %FALSE to let other signal handlers run.
+   */
+  g_signal_new ("handle-clear-property",
+    G_TYPE_FROM_INTERFACE (iface),
+    G_SIGNAL_RUN_LAST,
+    G_STRUCT_OFFSET (ConnmanProxyServiceIface, handle_clear_property),
+    g_signal_accumulator_true_handled,
+    NULL,
+    g_cclosure_marshal_generic,
+    G_TYPE_BOOLEAN,
+    2,
+    G_TYPE_DBUS_METHOD_INVOCATION, G_TYPE_STRING);
+
+  /**
+   * ConnmanProxyService::handle-connect:
+   * @object: A #ConnmanProxyService.
+   * @invocation: A #GDBusMethodInvocation.
+   *
+   * Signal emitted when a remote caller is invoking the <link linkend="gdbus-method-net-connman-Service.Connect">Connect()</link> D-Bus method.
+   *
+   * If a signal handler returns %TRUE, it means the signal handler will handle the invocation (e.g. take a reference to @invocation and eventually call connman_proxy_service_complete_connect() or e.g. g_dbus_method_invocation_return_error() on it) and no order signal handlers will run. If no signal handler handles the invocation, the %G_DBUS_ERROR_UNKNOWN_METHOD error is returned.
+   *
+   * Returns: %TRUE if the invocation was handled, %FALSE to let other signal handlers run.
+   */
+  g_signal_new ("handle-connect",
+    G_TYPE_FROM_INTERFACE (iface),
+    G_SIGNAL_RUN_LAST,
+    G_STRUCT_OFFSET (ConnmanProxyServiceIface, handle_connect),
+    g_signal_accumulator_true_handled,
+    NULL,
+    g_cclosure_marshal_generic,
+    G_TYPE_BOOLEAN,
+    1,
+    G_TYPE_DBUS_METHOD_INVOCATION);
+
+  /**
+   * ConnmanProxyService::handle-disconnect:
+   * @object: A #ConnmanProxyService.
+   * @invocation: A #GDBusMethodInvocation.
+   *
+   * Signal emitted when a remote caller is invoking the <link linkend="gdbus-method-net-connman-Service.Disconnect">Disconnect()</link> D-Bus method.
+   *
+   * If a signal handler returns %TRUE, it means the signal handler will handle the invocation (e.g. take a reference to @invocation and eventually call connman_proxy_service_complete_disconnect() or e.g. g_dbus_method_invocation_return_error() on it) and no order signal handlers will run. If no signal handler handles the invocation, the %G_DBUS_ERROR_UNKNOWN_METHOD error is returned.
+   *
+   * Returns: %TRUE if the invocation was handled, %FALSE to let other signal handlers run.
+   */
+  g_signal_new ("handle-disconnect",
+    G_TYPE_FROM_INTERFACE (iface),
+    G_SIGNAL_RUN_LAST,
+    G_STRUCT_OFFSET (ConnmanProxyServiceIface, handle_disconnect),
+    g_signal_accumulator_true_handled,
+    NULL,
+    g_cclosure_marshal_generic,
+    G_TYPE_BOOLEAN,
+    1,
+    G_TYPE_DBUS_METHOD_INVOCATION);
+
+  /**
+   * ConnmanProxyService::handle-remove:
+   * @object: A #ConnmanProxyService.
+   * @invocation: A #GDBusMethodInvocation.
+   *
+   * Signal emitted when a remote caller is invoking the <link linkend="gdbus-method-net-connman-Service.Remove">Remove()</link> D-Bus method.
+   *
+   * If a signal handler returns %TRUE, it means the signal handler will handle the invocation (e.g. take a reference to @invocation and eventually call connman_proxy_service_complete_remove() or e.g. g_dbus_method_invocation_return_error() on it) and no order signal handlers will run. If no signal handler handles the invocation, the %G_DBUS_ERROR_UNKNOWN_METHOD error is returned.
+   *
+   * Returns: %TRUE if the invocation was handled, %FALSE to let other signal handlers run.
+   */
+  g_signal_new ("handle-remove",
+    G_TYPE_FROM_INTERFACE (iface),
+    G_SIGNAL_RUN_LAST,
+    G_STRUCT_OFFSET (ConnmanProxyServiceIface, handle_remove),
+    g_signal_accumulator_true_handled,
+    NULL,
+    g_cclosure_marshal_generic,
+    G_TYPE_BOOLEAN,
+    1,
+    G_TYPE_DBUS_METHOD_INVOCATION);
+
+  /**
+   * ConnmanProxyService::handle-move-before:
+   * @object: A #ConnmanProxyService.
+   * @invocation: A #GDBusMethodInvocation.
+   * @arg_unnamed_arg0: Argument passed by remote caller.
+   *
+   * Signal emitted when a remote caller is invoking the <link linkend="gdbus-method-net-connman-Service.MoveBefore">MoveBefore()</link> D-Bus method.
+   *
+   * If a signal handler returns %TRUE, it means the signal handler will handle the invocation (e.g. take a reference to @invocation and eventually call connman_proxy_service_complete_move_before() or e.g. g_dbus_method_invocation_return_error() on it) and no order signal handlers will run. If no signal handler handles the invocation, the %G_DBUS_ERROR_UNKNOWN_METHOD error is returned.
+   *
+   * Returns: %TRUE if the invocation was handled, %FALSE to let other signal handlers run.
+   */
+  g_signal_new ("handle-move-before",
+    G_TYPE_FROM_INTERFACE (iface),
+    G_SIGNAL_RUN_LAST,
+    G_STRUCT_OFFSET (ConnmanProxyServiceIface, handle_move_before),
+    g_signal_accumulator_true_handled,
+    NULL,
+    g_cclosure_marshal_generic,
+    G_TYPE_BOOLEAN,
+    2,
+    G_TYPE_DBUS_METHOD_INVOCATION, G_TYPE_STRING);
+
+  /**
+   * ConnmanProxyService::handle-move-after:
+   * @object: A #ConnmanProxyService.
+   * @invocation: A #GDBusMethodInvocation.
+   * @arg_unnamed_arg0: Argument passed by remote caller.
+   *
+   * Signal emitted when a remote caller is invoking the <link linkend="gdbus-method-net-connman-Service.MoveAfter">MoveAfter()</link> D-Bus method.
+   *
+   * If a signal handler returns %TRUE, it means the signal handler will handle the invocation (e.g. take a reference to @invocation and eventually call connman_proxy_service_complete_move_after() or e.g. g_dbus_method_invocation_return_error() on it) and no order signal handlers will run. If no signal handler handles the invocation, the %G_DBUS_ERROR_UNKNOWN_METHOD error is returned.
+   *
+   * Returns: %TRUE if the invocation was handled, %FALSE to let other signal handlers run.
+   */
+  g_signal_new ("handle-move-after",
+    G_TYPE_FROM_INTERFACE (iface),
+    G_SIGNAL_RUN_LAST,
+    G_STRUCT_OFFSET (ConnmanProxyServiceIface, handle_move_after),
+    g_signal_accumulator_true_handled,
+    NULL,
+    g_cclosure_marshal_generic,
+    G_TYPE_BOOLEAN,
+    2,
+    G_TYPE_DBUS_METHOD_INVOCATION, G_TYPE_STRING);
+
+  /**
+   * ConnmanProxyService::handle-reset-counters:
+   * @object: A #ConnmanProxyService.
+   * @invocation: A #GDBusMethodInvocation.
+   *
+   * Signal emitted when a remote caller is invoking the <link linkend="gdbus-method-net-connman-Service.ResetCounters">ResetCounters()</link> D-Bus method.
+   *
+   * If a signal handler returns %TRUE, it means the signal handler will handle the invocation (e.g. take a reference to @invocation and eventually call connman_proxy_service_complete_reset_counters() or e.g. g_dbus_method_invocation_return_error() on it) and no order signal handlers will run. If no signal handler handles the invocation, the %G_DBUS_ERROR_UNKNOWN_METHOD error is returned.
+   *
+   * Returns: %TRUE if the invocation was handled, %FALSE to let other signal handlers run.
+   */
+  g_signal_new ("handle-reset-counters",
+    G_TYPE_FROM_INTERFACE (iface),
+    G_SIGNAL_RUN_LAST,
+    G_STRUCT_OFFSET (ConnmanProxyServiceIface, handle_reset_counters),
+    g_signal_accumulator_true_handled,
+    NULL,
+    g_cclosure_marshal_generic,
+    G_TYPE_BOOLEAN,
+    1,
+    G_TYPE_DBUS_METHOD_INVOCATION);
+
+  /* GObject signals for received D-Bus signals: */
+  /**
+   * ConnmanProxyService::property-changed:
+   * @object: A #ConnmanProxyService.
+   * @arg_unnamed_arg0: Argument.
+   * @arg_unnamed_arg1: Argument.
+   *
+   * On the client-side, this signal is emitted whenever the D-Bus signal <link linkend="gdbus-signal-net-connman-Service.PropertyChanged">"PropertyChanged"</link> is received.
+   *
+   * On the service-side, this signal can be used with e.g. g_signal_emit_by_name() to make the object emit the D-Bus signal.
+   */
+  g_signal_new ("property-changed",
+    G_TYPE_FROM_INTERFACE (iface),
+    G_SIGNAL_RUN_LAST,
+    G_STRUCT_OFFSET (ConnmanProxyServiceIface, property_changed),
+    NULL,
+    NULL,
+    g_cclosure_marshal_generic,
+    G_TYPE_NONE,
+    2, G_TYPE_STRING, G_TYPE_VARIANT);
+
+}
+
+typedef ConnmanProxyServiceIface ConnmanProxyServiceInterface;
+G_DEFINE_INTERFACE (ConnmanProxyService, connman_proxy_service, G_TYPE_OBJECT);
+
+/**
+ * connman_proxy_service_emit_property_changed:
+ * @object: A #ConnmanProxyService.
+ * @arg_unnamed_arg0: Argument to pass with the signal.
+ * @arg_unnamed_arg1: Argument to pass with the signal.
+ *
+ * Emits the <link linkend="gdbus-signal-net-connman-Service.PropertyChanged">"PropertyChanged"</link> D-Bus signal.
+ */
+void
+connman_proxy_service_emit_property_changed (
+    ConnmanProxyService *object,
+    const gchar *arg_unnamed_arg0,
+    GVariant *arg_unnamed_arg1)
+{
+  g_signal_emit_by_name (object, "property-changed", arg_unnamed_arg0, arg_unnamed_arg1);
+}
+
+/**
+ * connman_proxy_service_call_get_properties:
+ * @proxy: A #ConnmanProxyServiceProxy.
+ * @cancellable: (allow-none): A #GCancellable or %NULL.
+ * @callback: A #GAsyncReadyCallback to call when the request is satisfied or %NULL.
+ * @user_data: User data to pass to @callback.
+ *
+ * Asynchronously invokes the <link linkend="gdbus-method-net-connman-Service.GetProperties">GetProperties()</link> D-Bus method on @proxy.
+ * When the operation is finished, @callback will be invoked in the <link linkend="g-main-context-push-thread-default">thread-default main loop</link> of the thread you are calling this method from.
+ * You can then call connman_proxy_service_call_get_properties_finish() to get the result of the operation.
+ *
+ * See connman_proxy_service_call_get_properties_sync() for the synchronous, blocking version of this method.
+ */
+void
+connman_proxy_service_call_get_properties (
+    ConnmanProxyService *proxy,
+    GCancellable *cancellable,
+    GAsyncReadyCallback callback,
+    gpointer user_data)
+{
+  g_dbus_proxy_call (G_DBUS_PROXY (proxy),
+    "GetProperties",
+    g_variant_new ("()"),
+    G_DBUS_CALL_FLAGS_NONE,
+    -1,
+    cancellable,
+    callback,
+    user_data);
+}
+
+/**
+ * connman_proxy_service_call_get_properties_finish:
+ * @proxy: A #ConnmanProxyServiceProxy.
+ * @out_unnamed_arg0: (out): Return location for return parameter or %NULL to ignore.
+ * @res: The #GAsyncResult obtained from the #GAsyncReadyCallback passed to connman_proxy_service_call_get_properties().
+ * @error: Return location for error or %NULL.
+ *
+ * Finishes an operation started with connman_proxy_service_call_get_properties().
+ *
+ * Returns: (skip): %TRUE if the call succeded, %FALSE if @error is set.
+ */
+gboolean
+connman_proxy_service_call_get_properties_finish (
+    ConnmanProxyService *proxy,
+    GVariant **out_unnamed_arg0,
+    GAsyncResult *res,
+    GError **error)
+{
+  GVariant *_ret;
+  _ret = g_dbus_proxy_call_finish (G_DBUS_PROXY (proxy), res, error);
+  if (_ret == NULL)
+    goto _out;
+  g_variant_get (_ret,
+                 "(@a{sv})",
+                 out_unnamed_arg0);
+  g_variant_unref (_ret);
+_out:
+  return _ret != NULL;
+}
+
+/**
+ * connman_proxy_service_call_get_properties_sync:
+ * @proxy: A #ConnmanProxyServiceProxy.
+ * @out_unnamed_arg0: (out): Return location for return parameter or %NULL to ignore.
+ * @cancellable: (allow-none): A #GCancellable or %NULL.
+ * @error: Return location for error or %NULL.
+ *
+ * Synchronously invokes the <link linkend="gdbus-method-net-connman-Service.GetProperties">GetProperties()</link> D-Bus method on @proxy. The calling thread is blocked until a reply is received.
+ *
+ * See connman_proxy_service_call_get_properties() for the asynchronous version of this method.
+ *
+ * Returns: (skip): %TRUE if the call succeded, %FALSE if @error is set.
+ */
+gboolean
+connman_proxy_service_call_get_properties_sync (
+    ConnmanProxyService *proxy,
+    GVariant **out_unnamed_arg0,
+    GCancellable *cancellable,
+    GError **error)
+{
+  GVariant *_ret;
+  _ret = g_dbus_proxy_call_sync (G_DBUS_PROXY (proxy),
+    "GetProperties",
+    g_variant_new ("()"),
+    G_DBUS_CALL_FLAGS_NONE,
+    -1,
+    cancellable,
+    error);
+  if (_ret == NULL)
+    goto _out;
+  g_variant_get (_ret,
+                 "(@a{sv})",
+                 out_unnamed_arg0);
+  g_variant_unref (_ret);
+_out:
+  return _ret != NULL;
+}
+
+/**
+ * connman_proxy_service_call_set_property:
+ * @proxy: A #ConnmanProxyServiceProxy.
+ * @arg_unnamed_arg0: Argument to pass with the method invocation.
+ * @arg_unnamed_arg1: Argument to pass with the method invocation.
+ * @cancellable: (allow-none): A #GCancellable or %NULL.
+ * @callback: A #GAsyncReadyCallback to call when the request is satisfied or %NULL.
+ * @user_data: User data to pass to @callback.
+ *
+ * Asynchronously invokes the <link linkend="gdbus-method-net-connman-Service.SetProperty">SetProperty()</link> D-Bus method on @proxy.
+ * When the operation is finished, @callback will be invoked in the <link linkend="g-main-context-push-thread-default">thread-default main loop</link> of the thread you are calling this method from.
+ * You can then call connman_proxy_service_call_set_property_finish() to get the result of the operation.
+ *
+ * See connman_proxy_service_call_set_property_sync() for the synchronous, blocking version of this method.
+ */
+void
+connman_proxy_service_call_set_property (
+    ConnmanProxyService *proxy,
+    const gchar *arg_unnamed_arg0,
+    GVariant *arg_unnamed_arg1,
+    GCancellable *cancellable,
+    GAsyncReadyCallback callback,
+    gpointer user_data)
+{
+  g_dbus_proxy_call (G_DBUS_PROXY (proxy),
+    "SetProperty",
+    g_variant_new ("(s@v)",
+                   arg_unnamed_arg0,
+                   arg_unnamed_arg1),
+    G_DBUS_CALL_FLAGS_NONE,
+    -1,
+    cancellable,
+    callback,
+    user_data);
+}
+
+/**
+ * connman_proxy_service_call_set_property_finish:
+ * @proxy: A #ConnmanProxyServiceProxy.
+ * @res: The #GAsyncResult obtained from the #GAsyncReadyCallback passed to connman_proxy_service_call_set_property().
+ * @error: Return location for error or %NULL.
+ *
+ * Finishes an operation started with connman_proxy_service_call_set_property().
+ *
+ * Returns: (skip): %TRUE if the call succeded, %FALSE if @error is set.
+ */
+gboolean
+connman_proxy_service_call_set_property_finish (
+    ConnmanProxyService *proxy,
+    GAsyncResult *res,
+    GError **error)
+{
+  GVariant *_ret;
+  _ret = g_dbus_proxy_call_finish (G_DBUS_PROXY (proxy), res, error);
+  if (_ret == NULL)
+    goto _out;
+  g_variant_get (_ret,
+                 "()");
+  g_variant_unref (_ret);
+_out:
+  return _ret != NULL;
+}
+
+/**
+ * connman_proxy_service_call_set_property_sync:
+ * @proxy: A #ConnmanProxyServiceProxy.
+ * @arg_unnamed_arg0: Argument to pass with the method invocation.
+ * @arg_unnamed_arg1: Argument to pass with the method invocation.
+ * @cancellable: (allow-none): A #GCancellable or %NULL.
+ * @error: Return location for error or %NULL.
+ *
+ * Synchronously invokes the <link linkend="gdbus-method-net-connman-Service.SetProperty">SetProperty()</link> D-Bus method on @proxy. The calling thread is blocked until a reply is received.
+ *
+ * See connman_proxy_service_call_set_property() for the asynchronous version of this method.
+ *
+ * Returns: (skip): %TRUE if the call succeded, %FALSE if @error is set.
+ */
+gboolean
+connman_proxy_service_call_set_property_sync (
+    ConnmanProxyService *proxy,
+    const gchar *arg_unnamed_arg0,
+    GVariant *arg_unnamed_arg1,
+    GCancellable *cancellable,
+    GError **error)
+{
+  GVariant *_ret;
+  _ret = g_dbus_proxy_call_sync (G_DBUS_PROXY (proxy),
+    "SetProperty",
+    g_variant_new ("(s@v)",
+                   arg_unnamed_arg0,
+                   arg_unnamed_arg1),
+    G_DBUS_CALL_FLAGS_NONE,
+    -1,
+    cancellable,
+    error);
+  if (_ret == NULL)
+    goto _out;
+  g_variant_get (_ret,
+                 "()");
+  g_variant_unref (_ret);
+_out:
+  return _ret != NULL;
+}
+
+/**
+ * connman_proxy_service_call_clear_property:
+ * @proxy: A #ConnmanProxyServiceProxy.
+ * @arg_unnamed_arg0: Argument to pass with the method invocation.
+ * @cancellable: (allow-none): A #GCancellable or %NULL.
+ * @callback: A #GAsyncReadyCallback to call when the request is satisfied or %NULL.
+ * @user_data: User data to pass to @callback.
+ *
+ * Asynchronously invokes the <link linkend="gdbus-method-net-connman-Service.ClearProperty">ClearProperty()</link> D-Bus method on @proxy.
+ * When the operation is finished, @callback will be invoked in the <link linkend="g-main-context-push-thread-default">thread-default main loop</link> of the thread you are calling this method from.
+ * You can then call connman_proxy_service_call_clear_property_finish() to get the result of the operation.
+ *
+ * See connman_proxy_service_call_clear_property_sync() for the synchronous, blocking version of this method.
+ */
+void
+connman_proxy_service_call_clear_property (
+    ConnmanProxyService *proxy,
+    const gchar *arg_unnamed_arg0,
+    GCancellable *cancellable,
+    GAsyncReadyCallback callback,
+    gpointer user_data)
+{
+  g_dbus_proxy_call (G_DBUS_PROXY (proxy),
+    "ClearProperty",
+    g_variant_new ("(s)",
+                   arg_unnamed_arg0),
+    G_DBUS_CALL_FLAGS_NONE,
+    -1,
+    cancellable,
+    callback,
+    user_data);
+}
+
+/**
+ * connman_proxy_service_call_clear_property_finish:
+ * @proxy: A #ConnmanProxyServiceProxy.
+ * @res: The #GAsyncResult obtained from the #GAsyncReadyCallback passed to connman_proxy_service_call_clear_property().
+ * @error: Return location for error or %NULL.
+ *
+ * Finishes an operation started with connman_proxy_service_call_clear_property().
+ *
+ * Returns: (skip): %TRUE if the call succeded, %FALSE if @error is set.
+ */
+gboolean
+connman_proxy_service_call_clear_property_finish (
+    ConnmanProxyService *proxy,
+    GAsyncResult *res,
+    GError **error)
+{
+  GVariant *_ret;
+  _ret = g_dbus_proxy_call_finish (G_DBUS_PROXY (proxy), res, error);
+  if (_ret == NULL)
+    goto _out;
+  g_variant_get (_ret,
+                 "()");
+  g_variant_unref (_ret);
+_out:
+  return _ret != NULL;
+}
+
+/**
+ * connman_proxy_service_call_clear_property_sync:
+ * @proxy: A #ConnmanProxyServiceProxy.
+ * @arg_unnamed_arg0: Argument to pass with the method invocation.
+ * @cancellable: (allow-none): A #GCancellable or %NULL.
+ * @error: Return location for error or %NULL.
+ *
+ * Synchronously invokes the <link linkend="gdbus-method-net-connman-Service.ClearProperty">ClearProperty()</link> D-Bus method on @proxy. The calling thread is blocked until a reply is received.
+ *
+ * See connman_proxy_service_call_clear_property() for the asynchronous version of this method.
+ *
+ * Returns: (skip): %TRUE if the call succeded, %FALSE if @error is set.
+ */
+gboolean
+connman_proxy_service_call_clear_property_sync (
+    ConnmanProxyService *proxy,
+    const gchar *arg_unnamed_arg0,
+    GCancellable *cancellable,
+    GError **error)
+{
+  GVariant *_ret;
+  _ret = g_dbus_proxy_call_sync (G_DBUS_PROXY (proxy),
+    "ClearProperty",
+    g_variant_new ("(s)",
+                   arg_unnamed_arg0),
+    G_DBUS_CALL_FLAGS_NONE,
+    -1,
+    cancellable,
+    error);
+  if (_ret == NULL)
+    goto _out;
+  g_variant_get (_ret,
+                 "()");
+  g_variant_unref (_ret);
+_out:
+  return _ret != NULL;
+}
+
+/**
+ * connman_proxy_service_call_connect:
+ * @proxy: A #ConnmanProxyServiceProxy.
+ * @cancellable: (allow-none): A #GCancellable or %NULL.
+ * @callback: A #GAsyncReadyCallback to call when the request is satisfied or %NULL.
+ * @user_data: User data to pass to @callback.
+ *
+ * Asynchronously invokes the <link linkend="gdbus-method-net-connman-Service.Connect">Connect()</link> D-Bus method on @proxy.
+ * When the operation is finished, @callback will be invoked in the <link linkend="g-main-context-push-thread-default">thread-default main loop</link> of the thread you are calling this method from.
+ * You can then call connman_proxy_service_call_connect_finish() to get the result of the operation.
+ *
+ * See connman_proxy_service_call_connect_sync() for the synchronous, blocking version of this method.
+ */
+void
+connman_proxy_service_call_connect (
+    ConnmanProxyService *proxy,
+    GCancellable *cancellable,
+    GAsyncReadyCallback callback,
+    gpointer user_data)
+{
+  g_dbus_proxy_call (G_DBUS_PROXY (proxy),
+    "Connect",
+    g_variant_new ("()"),
+    G_DBUS_CALL_FLAGS_NONE,
+    -1,
+    cancellable,
+    callback,
+    user_data);
+}
+
+/**
+ * connman_proxy_service_call_connect_finish:
+ * @proxy: A #ConnmanProxyServiceProxy.
+ * @res: The #GAsyncResult obtained from the #GAsyncReadyCallback passed to connman_proxy_service_call_connect().
+ * @error: Return location for error or %NULL.
+ *
+ * Finishes an operation started with connman_proxy_service_call_connect().
+ *
+ * Returns: (skip): %TRUE if the call succeded, %FALSE if @error is set.
+ */
+gboolean
+connman_proxy_service_call_connect_finish (
+    ConnmanProxyService *proxy,
+    GAsyncResult *res,
+    GError **error)
+{
+  GVariant *_ret;
+  _ret = g_dbus_proxy_call_finish (G_DBUS_PROXY (proxy), res, error);
+  if (_ret == NULL)
+    goto _out;
+  g_variant_get (_ret,
+                 "()");
+  g_variant_unref (_ret);
+_out:
+  return _ret != NULL;
+}
+
+/**
+ * connman_proxy_service_call_connect_sync:
+ * @proxy: A #ConnmanProxyServiceProxy.
+ * @cancellable: (allow-none): A #GCancellable or %NULL.
+ * @error: Return location for error or %NULL.
+ *
+ * Synchronously invokes the <link linkend="gdbus-method-net-connman-Service.Connect">Connect()</link> D-Bus method on @proxy. The calling thread is blocked until a reply is received.
+ *
+ * See connman_proxy_service_call_connect() for the asynchronous version of this method.
+ *
+ * Returns: (skip): %TRUE if the call succeded, %FALSE if @error is set.
+ */
+gboolean
+connman_proxy_service_call_connect_sync (
+    ConnmanProxyService *proxy,
+    GCancellable *cancellable,
+    GError **error)
+{
+  GVariant *_ret;
+  _ret = g_dbus_proxy_call_sync (G_DBUS_PROXY (proxy),
+    "Connect",
+    g_variant_new ("()"),
+    G_DBUS_CALL_FLAGS_NONE,
+    -1,
+    cancellable,
+    error);
+  if (_ret == NULL)
+    goto _out;
+  g_variant_get (_ret,
+                 "()");
+  g_variant_unref (_ret);
+_out:
+  return _ret != NULL;
+}
+
+/**
+ * connman_proxy_service_call_disconnect:
+ * @proxy: A #ConnmanProxyServiceProxy.
+ * @cancellable: (allow-none): A #GCancellable or %NULL.
+ * @callback: A #GAsyncReadyCallback to call when the request is satisfied or %NULL.
+ * @user_data: User data to pass to @callback.
+ *
+ * Asynchronously invokes the <link linkend="gdbus-method-net-connman-Service.Disconnect">Disconnect()</link> D-Bus method on @proxy.
+ * When the operation is finished, @callback will be invoked in the <link linkend="g-main-context-push-thread-default">thread-default main loop</link> of the thread you are calling this method from.
+ * You can then call connman_proxy_service_call_disconnect_finish() to get the result of the operation.
+ *
+ * See connman_proxy_service_call_disconnect_sync() for the synchronous, blocking version of this method.
+ */
+void
+connman_proxy_service_call_disconnect (
+    ConnmanProxyService *proxy,
+    GCancellable *cancellable,
+    GAsyncReadyCallback callback,
+    gpointer user_data)
+{
+  g_dbus_proxy_call (G_DBUS_PROXY (proxy),
+    "Disconnect",
+    g_variant_new ("()"),
+    G_DBUS_CALL_FLAGS_NONE,
+    -1,
+    cancellable,
+    callback,
+    user_data);
+}
+
+/**
+ * connman_proxy_service_call_disconnect_finish:
+ * @proxy: A #ConnmanProxyServiceProxy.
+ * @res: The #GAsyncResult obtained from the #GAsyncReadyCallback passed to connman_proxy_service_call_disconnect().
+ * @error: Return location for error or %NULL.
+ *
+ * Finishes an operation started with connman_proxy_service_call_disconnect().
+ *
+ * Returns: (skip): %TRUE if the call succeded, %FALSE if @error is set.
+ */
+gboolean
+connman_proxy_service_call_disconnect_finish (
+    ConnmanProxyService *proxy,
+    GAsyncResult *res,
+    GError **error)
+{
+  GVariant *_ret;
+  _ret = g_dbus_proxy_call_finish (G_DBUS_PROXY (proxy), res, error);
+  if (_ret == NULL)
+    goto _out;
+  g_variant_get (_ret,
+                 "()");
+  g_variant_unref (_ret);
+_out:
+  return _ret != NULL;
+}
+
+/**
+ * connman_proxy_service_call_disconnect_sync:
+ * @proxy: A #ConnmanProxyServiceProxy.
+ * @cancellable: (allow-none): A #GCancellable or %NULL.
+ * @error: Return location for error or %NULL.
+ *
+ * Synchronously invokes the <link linkend="gdbus-method-net-connman-Service.Disconnect">Disconnect()</link> D-Bus method on @proxy. The calling thread is blocked until a reply is received.
+ *
+ * See connman_proxy_service_call_disconnect() for the asynchronous version of this method.
+ *
+ * Returns: (skip): %TRUE if the call succeded, %FALSE if @error is set.
+ */
+gboolean
+connman_proxy_service_call_disconnect_sync (
+    ConnmanProxyService *proxy,
+    GCancellable *cancellable,
+    GError **error)
+{
+  GVariant *_ret;
+  _ret = g_dbus_proxy_call_sync (G_DBUS_PROXY (proxy),
+    "Disconnect",
+    g_variant_new ("()"),
+    G_DBUS_CALL_FLAGS_NONE,
+    -1,
+    cancellable,
+    error);
+  if (_ret == NULL)
+    goto _out;
+  g_variant_get (_ret,
+                 "()");
+  g_variant_unref (_ret);
+_out:
+  return _ret != NULL;
+}
+
+/**
+ * connman_proxy_service_call_remove:
+ * @proxy: A #ConnmanProxyServiceProxy.
+ * @cancellable: (allow-none): A #GCancellable or %NULL.
+ * @callback: A #GAsyncReadyCallback to call when the request is satisfied or %NULL.
+ * @user_data: User data to pass to @callback.
+ *
+ * Asynchronously invokes the <link linkend="gdbus-method-net-connman-Service.Remove">Remove()</link> D-Bus method on @proxy.
+ * When the operation is finished, @callback will be invoked in the <link linkend="g-main-context-push-thread-default">thread-default main loop</link> of the thread you are calling this method from.
+ * You can then call connman_proxy_service_call_remove_finish() to get the result of the operation.
+ *
+ * See connman_proxy_service_call_remove_sync() for the synchronous, blocking version of this method.
+ */
+void
+connman_proxy_service_call_remove (
+    ConnmanProxyService *proxy,
+    GCancellable *cancellable,
+    GAsyncReadyCallback callback,
+    gpointer user_data)
+{
+  g_dbus_proxy_call (G_DBUS_PROXY (proxy),
+    "Remove",
+    g_variant_new ("()"),
+    G_DBUS_CALL_FLAGS_NONE,
+    -1,
+    cancellable,
+    callback,
+    user_data);
+}
+
+/**
+ * connman_proxy_service_call_remove_finish:
+ * @proxy: A #ConnmanProxyServiceProxy.
+ * @res: The #GAsyncResult obtained from the #GAsyncReadyCallback passed to connman_proxy_service_call_remove().
+ * @error: Return location for error or %NULL.
+ *
+ * Finishes an operation started with connman_proxy_service_call_remove().
+ *
+ * Returns: (skip): %TRUE if the call succeded, %FALSE if @error is set.
+ */
+gboolean
+connman_proxy_service_call_remove_finish (
+    ConnmanProxyService *proxy,
+    GAsyncResult *res,
+    GError **error)
+{
+  GVariant *_ret;
+  _ret = g_dbus_proxy_call_finish (G_DBUS_PROXY (proxy), res, error);
+  if (_ret == NULL)
+    goto _out;
+  g_variant_get (_ret,
+                 "()");
+  g_variant_unref (_ret);
+_out:
+  return _ret != NULL;
+}
+
+/**
+ * connman_proxy_service_call_remove_sync:
+ * @proxy: A #ConnmanProxyServiceProxy.
+ * @cancellable: (allow-none): A #GCancellable or %NULL.
+ * @error: Return location for error or %NULL.
+ *
+ * Synchronously invokes the <link linkend="gdbus-method-net-connman-Service.Remove">Remove()</link> D-Bus method on @proxy. The calling thread is blocked until a reply is received.
+ *
+ * See connman_proxy_service_call_remove() for the asynchronous version of this method.
+ *
+ * Returns: (skip): %TRUE if the call succeded, %FALSE if @error is set.
+ */
+gboolean
+connman_proxy_service_call_remove_sync (
+    ConnmanProxyService *proxy,
+    GCancellable *cancellable,
+    GError **error)
+{
+  GVariant *_ret;
+  _ret = g_dbus_proxy_call_sync (G_DBUS_PROXY (proxy),
+    "Remove",
+    g_variant_new ("()"),
+    G_DBUS_CALL_FLAGS_NONE,
+    -1,
+    cancellable,
+    error);
+  if (_ret == NULL)
+    goto _out;
+  g_variant_get (_ret,
+                 "()");
+  g_variant_unref (_ret);
+_out:
+  return _ret != NULL;
+}
+
+/**
+ * connman_proxy_service_call_move_before:
+ * @proxy: A #ConnmanProxyServiceProxy.
+ * @arg_unnamed_arg0: Argument to pass with the method invocation.
+ * @cancellable: (allow-none): A #GCancellable or %NULL.
+ * @callback: A #GAsyncReadyCallback to call when the request is satisfied or %NULL.
+ * @user_data: User data to pass to @callback.
+ *
+ * Asynchronously invokes the <link linkend="gdbus-method-net-connman-Service.MoveBefore">MoveBefore()</link> D-Bus method on @proxy.
+ * When the operation is finished, @callback will be invoked in the <link linkend="g-main-context-push-thread-default">thread-default main loop</link> of the thread you are calling this method from.
+ * You can then call connman_proxy_service_call_move_before_finish() to get the result of the operation.
+ *
+ * See connman_proxy_service_call_move_before_sync() for the synchronous, blocking version of this method.
+ */
+void
+connman_proxy_service_call_move_before (
+    ConnmanProxyService *proxy,
+    const gchar *arg_unnamed_arg0,
+    GCancellable *cancellable,
+    GAsyncReadyCallback callback,
+    gpointer user_data)
+{
+  g_dbus_proxy_call (G_DBUS_PROXY (proxy),
+    "MoveBefore",
+    g_variant_new ("(o)",
+                   arg_unnamed_arg0),
+    G_DBUS_CALL_FLAGS_NONE,
+    -1,
+    cancellable,
+    callback,
+    user_data);
+}
+
+/**
+ * connman_proxy_service_call_move_before_finish:
+ * @proxy: A #ConnmanProxyServiceProxy.
+ * @res: The #GAsyncResult obtained from the #GAsyncReadyCallback passed to connman_proxy_service_call_move_before().
+ * @error: Return location for error or %NULL.
+ *
+ * Finishes an operation started with connman_proxy_service_call_move_before().
+ *
+ * Returns: (skip): %TRUE if the call succeded, %FALSE if @error is set.
+ */
+gboolean
+connman_proxy_service_call_move_before_finish (
+    ConnmanProxyService *proxy,
+    GAsyncResult *res,
+    GError **error)
+{
+  GVariant *_ret;
+  _ret = g_dbus_proxy_call_finish (G_DBUS_PROXY (proxy), res, error);
+  if (_ret == NULL)
+    goto _out;
+  g_variant_get (_ret,
+                 "()");
+  g_variant_unref (_ret);
+_out:
+  return _ret != NULL;
+}
+
+/**
+ * connman_proxy_service_call_move_before_sync:
+ * @proxy: A #ConnmanProxyServiceProxy.
+ * @arg_unnamed_arg0: Argument to pass with the method invocation.
+ * @cancellable: (allow-none): A #GCancellable or %NULL.
+ * @error: Return location for error or %NULL.
+ *
+ * Synchronously invokes the <link linkend="gdbus-method-net-connman-Service.MoveBefore">MoveBefore()</link> D-Bus method on @proxy. The calling thread is blocked until a reply is received.
+ *
+ * See connman_proxy_service_call_move_before() for the asynchronous version of this method.
+ *
+ * Returns: (skip): %TRUE if the call succeded, %FALSE if @error is set.
+ */
+gboolean
+connman_proxy_service_call_move_before_sync (
+    ConnmanProxyService *proxy,
+    const gchar *arg_unnamed_arg0,
+    GCancellable *cancellable,
+    GError **error)
+{
+  GVariant *_ret;
+  _ret = g_dbus_proxy_call_sync (G_DBUS_PROXY (proxy),
+    "MoveBefore",
+    g_variant_new ("(o)",
+                   arg_unnamed_arg0),
+    G_DBUS_CALL_FLAGS_NONE,
+    -1,
+    cancellable,
+    error);
+  if (_ret == NULL)
+    goto _out;
+  g_variant_get (_ret,
+                 "()");
+  g_variant_unref (_ret);
+_out:
+  return _ret != NULL;
+}
+
+/**
+ * connman_proxy_service_call_move_after:
+ * @proxy: A #ConnmanProxyServiceProxy.
+ * @arg_unnamed_arg0: Argument to pass with the method invocation.
+ * @cancellable: (allow-none): A #GCancellable or %NULL.
+ * @callback: A #GAsyncReadyCallback to call when the request is satisfied or %NULL.
+ * @user_data: User data to pass to @callback.
+ *
+ * Asynchronously invokes the <link linkend="gdbus-method-net-connman-Service.MoveAfter">MoveAfter()</link> D-Bus method on @proxy.
+ * When the operation is finished, @callback will be invoked in the <link linkend="g-main-context-push-thread-default">thread-default main loop</link> of the thread you are calling this method from.
+ * You can then call connman_proxy_service_call_move_after_finish() to get the result of the operation.
+ *
+ * See connman_proxy_service_call_move_after_sync() for the synchronous, blocking version of this method.
+ */
+void
+connman_proxy_service_call_move_after (
+    ConnmanProxyService *proxy,
+    const gchar *arg_unnamed_arg0,
+    GCancellable *cancellable,
+    GAsyncReadyCallback callback,
+    gpointer user_data)
+{
+  g_dbus_proxy_call (G_DBUS_PROXY (proxy),
+    "MoveAfter",
+    g_variant_new ("(o)",
+                   arg_unnamed_arg0),
+    G_DBUS_CALL_FLAGS_NONE,
+    -1,
+    cancellable,
+    callback,
+    user_data);
+}
+
+/**
+ * connman_proxy_service_call_move_after_finish:
+ * @proxy: A #ConnmanProxyServiceProxy.
+ * @res: The #GAsyncResult obtained from the #GAsyncReadyCallback passed to connman_proxy_service_call_move_after().
+ * @error: Return location for error or %NULL.
+ *
+ * Finishes an operation started with connman_proxy_service_call_move_after().
+ *
+ * Returns: (skip): %TRUE if the call succeded, %FALSE if @error is set.
+ */
+gboolean
+connman_proxy_service_call_move_after_finish (
+    ConnmanProxyService *proxy,
+    GAsyncResult *res,
+    GError **error)
+{
+  GVariant *_ret;
+  _ret = g_dbus_proxy_call_finish (G_DBUS_PROXY (proxy), res, error);
+  if (_ret == NULL)
+    goto _out;
+  g_variant_get (_ret,
+                 "()");
+  g_variant_unref (_ret);
+_out:
+  return _ret != NULL;
+}
+
+/**
+ * connman_proxy_service_call_move_after_sync:
+ * @proxy: A #ConnmanProxyServiceProxy.
+ * @arg_unnamed_arg0: Argument to pass with the method invocation.
+ * @cancellable: (allow-none): A #GCancellable or %NULL.
+ * @error: Return location for error or %NULL.
+ *
+ * Synchronously invokes the <link linkend="gdbus-method-net-connman-Service.MoveAfter">MoveAfter()</link> D-Bus method on @proxy. The calling thread is blocked until a reply is received.
+ *
+ * See connman_proxy_service_call_move_after() for the asynchronous version of this method.
+ *
+ * Returns: (skip): %TRUE if the call succeded, %FALSE if @error is set.
+ */
+gboolean
+connman_proxy_service_call_move_after_sync (
+    ConnmanProxyService *proxy,
+    const gchar *arg_unnamed_arg0,
+    GCancellable *cancellable,
+    GError **error)
+{
+  GVariant *_ret;
+  _ret = g_dbus_proxy_call_sync (G_DBUS_PROXY (proxy),
+    "MoveAfter",
+    g_variant_new ("(o)",
+                   arg_unnamed_arg0),
+    G_DBUS_CALL_FLAGS_NONE,
+    -1,
+    cancellable,
+    error);
+  if (_ret == NULL)
+    goto _out;
+  g_variant_get (_ret,
+                 "()");
+  g_variant_unref (_ret);
+_out:
+  return _ret != NULL;
+}
+
+/**
+ * connman_proxy_service_call_reset_counters:
+ * @proxy: A #ConnmanProxyServiceProxy.
+ * @cancellable: (allow-none): A #GCancellable or %NULL.
+ * @callback: A #GAsyncReadyCallback to call when the request is satisfied or %NULL.
+ * @user_data: User data to pass to @callback.
+ *
+ * Asynchronously invokes the <link linkend="gdbus-method-net-connman-Service.ResetCounters">ResetCounters()</link> D-Bus method on @proxy.
+ * When the operation is finished, @callback will be invoked in the <link linkend="g-main-context-push-thread-default">thread-default main loop</link> of the thread you are calling this method from.
+ * You can then call connman_proxy_service_call_reset_counters_finish() to get the result of the operation.
+ *
+ * See connman_proxy_service_call_reset_counters_sync() for the synchronous, blocking version of this method.
+ */
+void
+connman_proxy_service_call_reset_counters (
+    ConnmanProxyService *proxy,
+    GCancellable *cancellable,
+    GAsyncReadyCallback callback,
+    gpointer user_data)
+{
+  g_dbus_proxy_call (G_DBUS_PROXY (proxy),
+    "ResetCounters",
+    g_variant_new ("()"),
+    G_DBUS_CALL_FLAGS_NONE,
+    -1,
+    cancellable,
+    callback,
+    user_data);
+}
+
+/**
+ * connman_proxy_service_call_reset_counters_finish:
+ * @proxy: A #ConnmanProxyServiceProxy.
+ * @res: The #GAsyncResult obtained from the #GAsyncReadyCallback passed to connman_proxy_service_call_reset_counters().
+ * @error: Return location for error or %NULL.
+ *
+ * Finishes an operation started with connman_proxy_service_call_reset_counters().
+ *
+ * Returns: (skip): %TRUE if the call succeded, %FALSE if @error is set.
+ */
+gboolean
+connman_proxy_service_call_reset_counters_finish (
+    ConnmanProxyService *proxy,
+    GAsyncResult *res,
+    GError **error)
+{
+  GVariant *_ret;
+  _ret = g_dbus_proxy_call_finish (G_DBUS_PROXY (proxy), res, error);
+  if (_ret == NULL)
+    goto _out;
+  g_variant_get (_ret,
+                 "()");
+  g_variant_unref (_ret);
+_out:
+  return _ret != NULL;
+}
+
+/**
+ * connman_proxy_service_call_reset_counters_sync:
+ * @proxy: A #ConnmanProxyServiceProxy.
+ * @cancellable: (allow-none): A #GCancellable or %NULL.
+ * @error: Return location for error or %NULL.
+ *
+ * Synchronously invokes the <link linkend="gdbus-method-net-connman-Service.ResetCounters">ResetCounters()</link> D-Bus method on @proxy. The calling thread is blocked until a reply is received.
+ *
+ * See connman_proxy_service_call_reset_counters() for the asynchronous version of this method.
+ *
+ * Returns: (skip): %TRUE if the call succeded, %FALSE if @error is set.
+ */
+gboolean
+connman_proxy_service_call_reset_counters_sync (
+    ConnmanProxyService *proxy,
+    GCancellable *cancellable,
+    GError **error)
+{
+  GVariant *_ret;
+  _ret = g_dbus_proxy_call_sync (G_DBUS_PROXY (proxy),
+    "ResetCounters",
+    g_variant_new ("()"),
+    G_DBUS_CALL_FLAGS_NONE,
+    -1,
+    cancellable,
+    error);
+  if (_ret == NULL)
+    goto _out;
+  g_variant_get (_ret,
+                 "()");
+  g_variant_unref (_ret);
+_out:
+  return _ret != NULL;
+}
+
+/**
+ * connman_proxy_service_complete_get_properties:
+ * @object: A #ConnmanProxyService.
+ * @invocation: (transfer full): A #GDBusMethodInvocation.
+ * @unnamed_arg0: Parameter to return.
+ *
+ * Helper function used in service implementations to finish handling invocations of the <link linkend="gdbus-method-net-connman-Service.GetProperties">GetProperties()</link> D-Bus method. If you instead want to finish handling an invocation by returning an error, use g_dbus_method_invocation_return_error() or similar.
+ *
+ * This method will free @invocation, you cannot use it afterwards.
+ */
+void
+connman_proxy_service_complete_get_properties (
+    ConnmanProxyService *object,
+    GDBusMethodInvocation *invocation,
+    GVariant *unnamed_arg0)
+{
+  g_dbus_method_invocation_return_value (invocation,
+    g_variant_new ("(@a{sv})",
+                   unnamed_arg0));
+}
+
+/**
+ * connman_proxy_service_complete_set_property:
+ * @object: A #ConnmanProxyService.
+ * @invocation: (transfer full): A #GDBusMethodInvocation.
+ *
+ * Helper function used in service implementations to finish handling invocations of the <link linkend="gdbus-method-net-connman-Service.SetProperty">SetProperty()</link> D-Bus method. If you instead want to finish handling an invocation by returning an error, use g_dbus_method_invocation_return_error() or similar.
+ *
+ * This method will free @invocation, you cannot use it afterwards.
+ */
+void
+connman_proxy_service_complete_set_property (
+    ConnmanProxyService *object,
+    GDBusMethodInvocation *invocation)
+{
+  g_dbus_method_invocation_return_value (invocation,
+    g_variant_new ("()"));
+}
+
+/**
+ * connman_proxy_service_complete_clear_property:
+ * @object: A #ConnmanProxyService.
+ * @invocation: (transfer full): A #GDBusMethodInvocation.
+ *
+ * Helper function used in service implementations to finish handling invocations of the <link linkend="gdbus-method-net-connman-Service.ClearProperty">ClearProperty()</link> D-Bus method. If you instead want to finish handling an invocation by returning an error, use g_dbus_method_invocation_return_error() or similar.
+ *
+ * This method will free @invocation, you cannot use it afterwards.
+ */
+void
+connman_proxy_service_complete_clear_property (
+    ConnmanProxyService *object,
+    GDBusMethodInvocation *invocation)
+{
+  g_dbus_method_invocation_return_value (invocation,
+    g_variant_new ("()"));
+}
+
+/**
+ * connman_proxy_service_complete_connect:
+ * @object: A #ConnmanProxyService.
+ * @invocation: (transfer full): A #GDBusMethodInvocation.
+ *
+ * Helper function used in service implementations to finish handling invocations of the <link linkend="gdbus-method-net-connman-Service.Connect">Connect()</link> D-Bus method. If you instead want to finish handling an invocation by returning an error, use g_dbus_method_invocation_return_error() or similar.
+ *
+ * This method will free @invocation, you cannot use it afterwards.
+ */
+void
+connman_proxy_service_complete_connect (
+    ConnmanProxyService *object,
+    GDBusMethodInvocation *invocation)
+{
+  g_dbus_method_invocation_return_value (invocation,
+    g_variant_new ("()"));
+}
+
+/**
+ * connman_proxy_service_complete_disconnect:
+ * @object: A #ConnmanProxyService.
+ * @invocation: (transfer full): A #GDBusMethodInvocation.
+ *
+ * Helper function used in service implementations to finish handling invocations of the <link linkend="gdbus-method-net-connman-Service.Disconnect">Disconnect()</link> D-Bus method. If you instead want to finish handling an invocation by returning an error, use g_dbus_method_invocation_return_error() or similar.
+ *
+ * This method will free @invocation, you cannot use it afterwards.
+ */
+void
+connman_proxy_service_complete_disconnect (
+    ConnmanProxyService *object,
+    GDBusMethodInvocation *invocation)
+{
+  g_dbus_method_invocation_return_value (invocation,
+    g_variant_new ("()"));
+}
+
+/**
+ * connman_proxy_service_complete_remove:
+ * @object: A #ConnmanProxyService.
+ * @invocation: (transfer full): A #GDBusMethodInvocation.
+ *
+ * Helper function used in service implementations to finish handling invocations of the <link linkend="gdbus-method-net-connman-Service.Remove">Remove()</link> D-Bus method. If you instead want to finish handling an invocation by returning an error, use g_dbus_method_invocation_return_error() or similar.
+ *
+ * This method will free @invocation, you cannot use it afterwards.
+ */
+void
+connman_proxy_service_complete_remove (
+    ConnmanProxyService *object,
+    GDBusMethodInvocation *invocation)
+{
+  g_dbus_method_invocation_return_value (invocation,
+    g_variant_new ("()"));
+}
+
+/**
+ * connman_proxy_service_complete_move_before:
+ * @object: A #ConnmanProxyService.
+ * @invocation: (transfer full): A #GDBusMethodInvocation.
+ *
+ * Helper function used in service implementations to finish handling invocations of the <link linkend="gdbus-method-net-connman-Service.MoveBefore">MoveBefore()</link> D-Bus method. If you instead want to finish handling an invocation by returning an error, use g_dbus_method_invocation_return_error() or similar.
+ *
+ * This method will free @invocation, you cannot use it afterwards.
+ */
+void
+connman_proxy_service_complete_move_before (
+    ConnmanProxyService *object,
+    GDBusMethodInvocation *invocation)
+{
+  g_dbus_method_invocation_return_value (invocation,
+    g_variant_new ("()"));
+}
+
+/**
+ * connman_proxy_service_complete_move_after:
+ * @object: A #ConnmanProxyService.
+ * @invocation: (transfer full): A #GDBusMethodInvocation.
+ *
+ * Helper function used in service implementations to finish handling invocations of the <link linkend="gdbus-method-net-connman-Service.MoveAfter">MoveAfter()</link> D-Bus method. If you instead want to finish handling an invocation by returning an error, use g_dbus_method_invocation_return_error() or similar.
+ *
+ * This method will free @invocation, you cannot use it afterwards.
+ */
+void
+connman_proxy_service_complete_move_after (
+    ConnmanProxyService *object,
+    GDBusMethodInvocation *invocation)
+{
+  g_dbus_method_invocation_return_value (invocation,
+    g_variant_new ("()"));
+}
+
+/**
+ * connman_proxy_service_complete_reset_counters:
+ * @object: A #ConnmanProxyService.
+ * @invocation: (transfer full): A #GDBusMethodInvocation.
+ *
+ * Helper function used in service implementations to finish handling invocations of the <link linkend="gdbus-method-net-connman-Service.ResetCounters">ResetCounters()</link> D-Bus method. If you instead want to finish handling an invocation by returning an error, use g_dbus_method_invocation_return_error() or similar.
+ *
+ * This method will free @invocation, you cannot use it afterwards.
+ */
+void
+connman_proxy_service_complete_reset_counters (
+    ConnmanProxyService *object,
+    GDBusMethodInvocation *invocation)
+{
+  g_dbus_method_invocation_return_value (invocation,
+    g_variant_new ("()"));
+}
+
+/* ------------------------------------------------------------------------ */
+
+/**
+ * ConnmanProxyServiceProxy:
+ *
+ * The #ConnmanProxyServiceProxy structure contains only private data and should only be accessed using the provided API.
+ */
+
+/**
+ * ConnmanProxyServiceProxyClass:
+ * @parent_class: The parent class.
+ *
+ * Class structure for #ConnmanProxyServiceProxy.
+ */
+
+struct _ConnmanProxyServiceProxyPrivate
+{
+  GData *qdata;
+};
+
+static void connman_proxy_service_proxy_iface_init (ConnmanProxyServiceIface *iface);
+
+G_DEFINE_TYPE_WITH_CODE (ConnmanProxyServiceProxy, connman_proxy_service_proxy, G_TYPE_DBUS_PROXY,
+                         G_IMPLEMENT_INTERFACE (CONNMAN_PROXY_TYPE_SERVICE, connman_proxy_service_proxy_iface_init));
+
+static void
+connman_proxy_service_proxy_finalize (GObject *object)
+{
+  ConnmanProxyServiceProxy *proxy = CONNMAN_PROXY_SERVICE_PROXY (object);
+  g_datalist_clear (&proxy->priv->qdata);
+  G_OBJECT_CLASS (connman_proxy_service_proxy_parent_class)->finalize (object);
+}
+
+static void
+connman_proxy_service_proxy_get_property (GObject      *object,
+  guint         prop_id,
+  GValue       *value,
+  GParamSpec   *pspec)
+{
+}
+
+static void
+connman_proxy_service_proxy_set_property (GObject      *object,
+  guint         prop_id,
+  const GValue *value,
+  GParamSpec   *pspec)
+{
+}
+
+static void
+connman_proxy_service_proxy_g_signal (GDBusProxy *proxy,
+  const gchar *sender_name,
+  const gchar *signal_name,
+  GVariant *parameters)
+{
+  _ExtendedGDBusSignalInfo *info;
+  GVariantIter iter;
+  GVariant *child;
+  GValue *paramv;
+  guint num_params;
+  guint n;
+  guint signal_id;
+  info = (_ExtendedGDBusSignalInfo *) g_dbus_interface_info_lookup_signal ((GDBusInterfaceInfo *) &_connman_proxy_service_interface_info, signal_name);
+  if (info == NULL)
+    return;
+  num_params = g_variant_n_children (parameters);
+  paramv = g_new0 (GValue, num_params + 1);
+  g_value_init (&paramv[0], CONNMAN_PROXY_TYPE_SERVICE);
+  g_value_set_object (&paramv[0], proxy);
+  g_variant_iter_init (&iter, parameters);
+  n = 1;
+  while ((child = g_variant_iter_next_value (&iter)) != NULL)
+    {
+      _ExtendedGDBusArgInfo *arg_info = (_ExtendedGDBusArgInfo *) info->parent_struct.args[n - 1];
+      if (arg_info->use_gvariant)
+        {
+          g_value_init (&paramv[n], G_TYPE_VARIANT);
+          g_value_set_variant (&paramv[n], child);
+          n++;
+        }
+      else
+        g_dbus_gvariant_to_gvalue (child, &paramv[n++]);
+      g_variant_unref (child);
+    }
+  signal_id = g_signal_lookup (info->signal_name, CONNMAN_PROXY_TYPE_SERVICE);
+  g_signal_emitv (paramv, signal_id, 0, NULL);
+  for (n = 0; n < num_params + 1; n++)
+    g_value_unset (&paramv[n]);
+  g_free (paramv);
+}
+
+static void
+connman_proxy_service_proxy_g_properties_changed (GDBusProxy *_proxy,
+  GVariant *changed_properties,
+  const gchar *const *invalidated_properties)
+{
+  ConnmanProxyServiceProxy *proxy = CONNMAN_PROXY_SERVICE_PROXY (_proxy);
+  guint n;
+  const gchar *key;
+  GVariantIter *iter;
+  _ExtendedGDBusPropertyInfo *info;
+  g_variant_get (changed_properties, "a{sv}", &iter);
+  while (g_variant_iter_next (iter, "{&sv}", &key, NULL))
+    {
+      info = (_ExtendedGDBusPropertyInfo *) g_dbus_interface_info_lookup_property ((GDBusInterfaceInfo *) &_connman_proxy_service_interface_info, key);
+      g_datalist_remove_data (&proxy->priv->qdata, key);
+      if (info != NULL)
+        g_object_notify (G_OBJECT (proxy), info->hyphen_name);
+    }
+  g_variant_iter_free (iter);
+  for (n = 0; invalidated_properties[n] != NULL; n++)
+    {
+      info = (_ExtendedGDBusPropertyInfo *) g_dbus_interface_info_lookup_property ((GDBusInterfaceInfo *) &_connman_proxy_service_interface_info, invalidated_properties[n]);
+      g_datalist_remove_data (&proxy->priv->qdata, invalidated_properties[n]);
+      if (info != NULL)
+        g_object_notify (G_OBJECT (proxy), info->hyphen_name);
+    }
+}
+
+static void
+connman_proxy_service_proxy_init (ConnmanProxyServiceProxy *proxy)
+{
+  proxy->priv = G_TYPE_INSTANCE_GET_PRIVATE (proxy, CONNMAN_PROXY_TYPE_SERVICE_PROXY, ConnmanProxyServiceProxyPrivate);
+  g_dbus_proxy_set_interface_info (G_DBUS_PROXY (proxy), connman_proxy_service_interface_info ());
+}
+
+static void
+connman_proxy_service_proxy_class_init (ConnmanProxyServiceProxyClass *klass)
+{
+  GObjectClass *gobject_class;
+  GDBusProxyClass *proxy_class;
+
+  g_type_class_add_private (klass, sizeof (ConnmanProxyServiceProxyPrivate));
+
+  gobject_class = G_OBJECT_CLASS (klass);
+  gobject_class->finalize     = connman_proxy_service_proxy_finalize;
+  gobject_class->get_property = connman_proxy_service_proxy_get_property;
+  gobject_class->set_property = connman_proxy_service_proxy_set_property;
+
+  proxy_class = G_DBUS_PROXY_CLASS (klass);
+  proxy_class->g_signal = connman_proxy_service_proxy_g_signal;
+  proxy_class->g_properties_changed = connman_proxy_service_proxy_g_properties_changed;
+
+}
+
+static void
+connman_proxy_service_proxy_iface_init (ConnmanProxyServiceIface *iface)
+{
+}
+
+/**
+ * connman_proxy_service_proxy_new:
+ * @connection: A #GDBusConnection.
+ * @flags: Flags from the #GDBusProxyFlags enumeration.
+ * @name: (allow-none): A bus name (well-known or unique) or %NULL if @connection is not a message bus connection.
+ * @object_path: An object path.
+ * @cancellable: (allow-none): A #GCancellable or %NULL.
+ * @callback: A #GAsyncReadyCallback to call when the request is satisfied.
+ * @user_data: User data to pass to @callback.
+ *
+ * Asynchronously creates a proxy for the D-Bus interface <link linkend="gdbus-interface-net-connman-Service.top_of_page">net.connman.Service</link>. See g_dbus_proxy_new() for more details.
+ *
+ * When the operation is finished, @callback will be invoked in the <link linkend="g-main-context-push-thread-default">thread-default main loop</link> of the thread you are calling this method from.
+ * You can then call connman_proxy_service_proxy_new_finish() to get the result of the operation.
+ *
+ * See connman_proxy_service_proxy_new_sync() for the synchronous, blocking version of this constructor.
+ */
+void
+connman_proxy_service_proxy_new (
+    GDBusConnection     *connection,
+    GDBusProxyFlags      flags,
+    const gchar         *name,
+    const gchar         *object_path,
+    GCancellable        *cancellable,
+    GAsyncReadyCallback  callback,
+    gpointer             user_data)
+{
+  g_async_initable_new_async (CONNMAN_PROXY_TYPE_SERVICE_PROXY, G_PRIORITY_DEFAULT, cancellable, callback, user_data, "g-flags", flags, "g-name", name, "g-connection", connection, "g-object-path", object_path, "g-interface-name", "net.connman.Service", NULL);
+}
+
+/**
+ * connman_proxy_service_proxy_new_finish:
+ * @res: The #GAsyncResult obtained from the #GAsyncReadyCallback passed to connman_proxy_service_proxy_new().
+ * @error: Return location for error or %NULL
+ *
+ * Finishes an operation started with connman_proxy_service_proxy_new().
+ *
+ * Returns: (transfer full) (type ConnmanProxyServiceProxy): The constructed proxy object or %NULL if @error is set.
+ */
+ConnmanProxyService *
+connman_proxy_service_proxy_new_finish (
+    GAsyncResult        *res,
+    GError             **error)
+{
+  GObject *ret;
+  GObject *source_object;
+  source_object = g_async_result_get_source_object (res);
+  ret = g_async_initable_new_finish (G_ASYNC_INITABLE (source_object), res, error);
+  g_object_unref (source_object);
+  if (ret != NULL)
+    return CONNMAN_PROXY_SERVICE (ret);
+  else
+    return NULL;
+}
+
+/**
+ * connman_proxy_service_proxy_new_sync:
+ * @connection: A #GDBusConnection.
+ * @flags: Flags from the #GDBusProxyFlags enumeration.
+ * @name: (allow-none): A bus name (well-known or unique) or %NULL if @connection is not a message bus connection.
+ * @object_path: An object path.
+ * @cancellable: (allow-none): A #GCancellable or %NULL.
+ * @error: Return location for error or %NULL
+ *
+ * Synchronously creates a proxy for the D-Bus interface <link linkend="gdbus-interface-net-connman-Service.top_of_page">net.connman.Service</link>. See g_dbus_proxy_new_sync() for more details.
+ *
+ * The calling thread is blocked until a reply is received.
+ *
+ * See connman_proxy_service_proxy_new() for the asynchronous version of this constructor.
+ *
+ * Returns: (transfer full) (type ConnmanProxyServiceProxy): The constructed proxy object or %NULL if @error is set.
+ */
+ConnmanProxyService *
+connman_proxy_service_proxy_new_sync (
+    GDBusConnection     *connection,
+    GDBusProxyFlags      flags,
+    const gchar         *name,
+    const gchar         *object_path,
+    GCancellable        *cancellable,
+    GError             **error)
+{
+  GInitable *ret;
+  ret = g_initable_new (CONNMAN_PROXY_TYPE_SERVICE_PROXY, cancellable, error, "g-flags", flags, "g-name", name, "g-connection", connection, "g-object-path", object_path, "g-interface-name", "net.connman.Service", NULL);
+  if (ret != NULL)
+    return CONNMAN_PROXY_SERVICE (ret);
+  else
+    return NULL;
+}
+
+
+/**
+ * connman_proxy_service_proxy_new_for_bus:
+ * @bus_type: A #GBusType.
+ * @flags: Flags from the #GDBusProxyFlags enumeration.
+ * @name: A bus name (well-known or unique).
+ * @object_path: An object path.
+ * @cancellable: (allow-none): A #GCancellable or %NULL.
+ * @callback: A #GAsyncReadyCallback to call when the request is satisfied.
+ * @user_data: User data to pass to @callback.
+ *
+ * Like connman_proxy_service_proxy_new() but takes a #GBusType instead of a #GDBusConnection.
+ *
+ * When the operation is finished, @callback will be invoked in the <link linkend="g-main-context-push-thread-default">thread-default main loop</link> of the thread you are calling this method from.
+ * You can then call connman_proxy_service_proxy_new_for_bus_finish() to get the result of the operation.
+ *
+ * See connman_proxy_service_proxy_new_for_bus_sync() for the synchronous, blocking version of this constructor.
+ */
+void
+connman_proxy_service_proxy_new_for_bus (
+    GBusType             bus_type,
+    GDBusProxyFlags      flags,
+    const gchar         *name,
+    const gchar         *object_path,
+    GCancellable        *cancellable,
+    GAsyncReadyCallback  callback,
+    gpointer             user_data)
+{
+  g_async_initable_new_async (CONNMAN_PROXY_TYPE_SERVICE_PROXY, G_PRIORITY_DEFAULT, cancellable, callback, user_data, "g-flags", flags, "g-name", name, "g-bus-type", bus_type, "g-object-path", object_path, "g-interface-name", "net.connman.Service", NULL);
+}
+
+/**
+ * connman_proxy_service_proxy_new_for_bus_finish:
+ * @res: The #GAsyncResult obtained from the #GAsyncReadyCallback passed to connman_proxy_service_proxy_new_for_bus().
+ * @error: Return location for error or %NULL
+ *
+ * Finishes an operation started with connman_proxy_service_proxy_new_for_bus().
+ *
+ * Returns: (transfer full) (type ConnmanProxyServiceProxy): The constructed proxy object or %NULL if @error is set.
+ */
+ConnmanProxyService *
+connman_proxy_service_proxy_new_for_bus_finish (
+    GAsyncResult        *res,
+    GError             **error)
+{
+  GObject *ret;
+  GObject *source_object;
+  source_object = g_async_result_get_source_object (res);
+  ret = g_async_initable_new_finish (G_ASYNC_INITABLE (source_object), res, error);
+  g_object_unref (source_object);
+  if (ret != NULL)
+    return CONNMAN_PROXY_SERVICE (ret);
+  else
+    return NULL;
+}
+
+/**
+ * connman_proxy_service_proxy_new_for_bus_sync:
+ * @bus_type: A #GBusType.
+ * @flags: Flags from the #GDBusProxyFlags enumeration.
+ * @name: A bus name (well-known or unique).
+ * @object_path: An object path.
+ * @cancellable: (allow-none): A #GCancellable or %NULL.
+ * @error: Return location for error or %NULL
+ *
+ * Like connman_proxy_service_proxy_new_sync() but takes a #GBusType instead of a #GDBusConnection.
+ *
+ * The calling thread is blocked until a reply is received.
+ *
+ * See connman_proxy_service_proxy_new_for_bus() for the asynchronous version of this constructor.
+ *
+ * Returns: (transfer full) (type ConnmanProxyServiceProxy): The constructed proxy object or %NULL if @error is set.
+ */
+ConnmanProxyService *
+connman_proxy_service_proxy_new_for_bus_sync (
+    GBusType             bus_type,
+    GDBusProxyFlags      flags,
+    const gchar         *name,
+    const gchar         *object_path,
+    GCancellable        *cancellable,
+    GError             **error)
+{
+  GInitable *ret;
+  ret = g_initable_new (CONNMAN_PROXY_TYPE_SERVICE_PROXY, cancellable, error, "g-flags", flags, "g-name", name, "g-bus-type", bus_type, "g-object-path", object_path, "g-interface-name", "net.connman.Service", NULL);
+  if (ret != NULL)
+    return CONNMAN_PROXY_SERVICE (ret);
+  else
+    return NULL;
+}
+
+
+/* ------------------------------------------------------------------------ */
+
+/**
+ * ConnmanProxyServiceSkeleton:
+ *
+ * The #ConnmanProxyServiceSkeleton structure contains only private data and should only be accessed using the provided API.
+ */
+
+/**
+ * ConnmanProxyServiceSkeletonClass:
+ * @parent_class: The parent class.
+ *
+ * Class structure for #ConnmanProxyServiceSkeleton.
+ */
+
+struct _ConnmanProxyServiceSkeletonPrivate
+{
+  GValueArray *properties;
+  GList *changed_properties;
+  GSource *changed_properties_idle_source;
+  GMainContext *context;
+  GMutex *lock;
+};
+
+static void
+_connman_proxy_service_skeleton_handle_method_call (
+  GDBusConnection *connection,
+  const gchar *sender,
+  const gchar *object_path,
+  const gchar *interface_name,
+  const gchar *method_name,
+  GVariant *parameters,
+  GDBusMethodInvocation *invocation,
+  gpointer user_data)
+{
+  ConnmanProxyServiceSkeleton *skeleton = CONNMAN_PROXY_SERVICE_SKELETON (user_data);
+  _ExtendedGDBusMethodInfo *info;
+  GVariantIter iter;
+  GVariant *child;
+  GValue *paramv;
+  guint num_params;
+  guint num_extra;
+  guint n;
+  guint signal_id;
+  GValue return_value = {0};
+  info = (_ExtendedGDBusMethodInfo *) g_dbus_method_invocation_get_method_info (invocation);
+  g_assert (info != NULL);
+  num_params = g_variant_n_children (parameters);
+  num_extra = info->pass_fdlist ? 3 : 2;  paramv = g_new0 (GValue, num_params + num_extra);
+  n = 0;
+  g_value_init (&paramv[n], CONNMAN_PROXY_TYPE_SERVICE);
+  g_value_set_object (&paramv[n++], skeleton);
+  g_value_init (&paramv[n], G_TYPE_DBUS_METHOD_INVOCATION);
+  g_value_set_object (&paramv[n++], invocation);
+  if (info->pass_fdlist)
+    {
+#ifdef G_OS_UNIX
+      g_value_init (&paramv[n], G_TYPE_UNIX_FD_LIST);
+      g_value_set_object (&paramv[n++], g_dbus_message_get_unix_fd_list (g_dbus_method_invocation_get_message (invocation)));
+#else
+      g_assert_not_reached ();
+#endif
+    }
+  g_variant_iter_init (&iter, parameters);
+  while ((child = g_variant_iter_next_value (&iter)) != NULL)
+    {
+      _ExtendedGDBusArgInfo *arg_info = (_ExtendedGDBusArgInfo *) info->parent_struct.in_args[n - num_extra];
+      if (arg_info->use_gvariant)
+        {
+          g_value_init (&paramv[n], G_TYPE_VARIANT);
+          g_value_set_variant (&paramv[n], child);
+          n++;
+        }
+      else
+        g_dbus_gvariant_to_gvalue (child, &paramv[n++]);
+      g_variant_unref (child);
+    }
+  signal_id = g_signal_lookup (info->signal_name, CONNMAN_PROXY_TYPE_SERVICE);
+  g_value_init (&return_value, G_TYPE_BOOLEAN);
+  g_signal_emitv (paramv, signal_id, 0, &return_value);
+  if (!g_value_get_boolean (&return_value))
+    g_dbus_method_invocation_return_error (invocation, G_DBUS_ERROR, G_DBUS_ERROR_UNKNOWN_METHOD, "Method %s is not implemented on interface %s", method_name, interface_name);
+  g_value_unset (&return_value);
+  for (n = 0; n < num_params + num_extra; n++)
+    g_value_unset (&paramv[n]);
+  g_free (paramv);
+}
+
+static GVariant *
+_connman_proxy_service_skeleton_handle_get_property (
+  GDBusConnection *connection,
+  const gchar *sender,
+  const gchar *object_path,
+  const gchar *interface_name,
+  const gchar *property_name,
+  GError **error,
+  gpointer user_data)
+{
+  ConnmanProxyServiceSkeleton *skeleton = CONNMAN_PROXY_SERVICE_SKELETON (user_data);
+  GValue value = {0};
+  GParamSpec *pspec;
+  _ExtendedGDBusPropertyInfo *info;
+  GVariant *ret;
+  ret = NULL;
+  info = (_ExtendedGDBusPropertyInfo *) g_dbus_interface_info_lookup_property ((GDBusInterfaceInfo *) &_connman_proxy_service_interface_info, property_name);
+  g_assert (info != NULL);
+  pspec = g_object_class_find_property (G_OBJECT_GET_CLASS (skeleton), info->hyphen_name);
+  if (pspec == NULL)
+    {
+      g_set_error (error, G_DBUS_ERROR, G_DBUS_ERROR_INVALID_ARGS, "No property with name %s", property_name);
+    }
+  else
+    {
+      g_value_init (&value, pspec->value_type);
+      g_object_get_property (G_OBJECT (skeleton), info->hyphen_name, &value);
+      ret = g_dbus_gvalue_to_gvariant (&value, G_VARIANT_TYPE (info->parent_struct.signature));
+      g_value_unset (&value);
+    }
+  return ret;
+}
+
+static gboolean
+_connman_proxy_service_skeleton_handle_set_property (
+  GDBusConnection *connection,
+  const gchar *sender,
+  const gchar *object_path,
+  const gchar *interface_name,
+  const gchar *property_name,
+  GVariant *variant,
+  GError **error,
+  gpointer user_data)
+{
+  ConnmanProxyServiceSkeleton *skeleton = CONNMAN_PROXY_SERVICE_SKELETON (user_data);
+  GValue value = {0};
+  GParamSpec *pspec;
+  _ExtendedGDBusPropertyInfo *info;
+  gboolean ret;
+  ret = FALSE;
+  info = (_ExtendedGDBusPropertyInfo *) g_dbus_interface_info_lookup_property ((GDBusInterfaceInfo *) &_connman_proxy_service_interface_info, property_name);
+  g_assert (info != NULL);
+  pspec = g_object_class_find_property (G_OBJECT_GET_CLASS (skeleton), info->hyphen_name);
+  if (pspec == NULL)
+    {
+      g_set_error (error, G_DBUS_ERROR, G_DBUS_ERROR_INVALID_ARGS, "No property with name %s", property_name);
+    }
+  else
+    {
+      if (info->use_gvariant)
+        g_value_set_variant (&value, variant);
+      else
+        g_dbus_gvariant_to_gvalue (variant, &value);
+      g_object_set_property (G_OBJECT (skeleton), info->hyphen_name, &value);
+      g_value_unset (&value);
+      ret = TRUE;
+    }
+  return ret;
+}
+
+static const GDBusInterfaceVTable _connman_proxy_service_skeleton_vtable =
+{
+  _connman_proxy_service_skeleton_handle_method_call,
+  _connman_proxy_service_skeleton_handle_get_property,
+  _connman_proxy_service_skeleton_handle_set_property
+};
+
+static GDBusInterfaceInfo *
+connman_proxy_service_skeleton_dbus_interface_get_info (GDBusInterfaceSkeleton *skeleton)
+{
+  return connman_proxy_service_interface_info ();
+}
+
+static GDBusInterfaceVTable *
+connman_proxy_service_skeleton_dbus_interface_get_vtable (GDBusInterfaceSkeleton *skeleton)
+{
+  return (GDBusInterfaceVTable *) &_connman_proxy_service_skeleton_vtable;
+}
+
+static GVariant *
+connman_proxy_service_skeleton_dbus_interface_get_properties (GDBusInterfaceSkeleton *_skeleton)
+{
+  ConnmanProxyServiceSkeleton *skeleton = CONNMAN_PROXY_SERVICE_SKELETON (_skeleton);
+
+  GVariantBuilder builder;
+  guint n;
+  g_variant_builder_init (&builder, G_VARIANT_TYPE ("a{sv}"));
+  if (_connman_proxy_service_interface_info.parent_struct.properties == NULL)
+    goto out;
+  for (n = 0; _connman_proxy_service_interface_info.parent_struct.properties[n] != NULL; n++)
+    {
+      GDBusPropertyInfo *info = _connman_proxy_service_interface_info.parent_struct.properties[n];
+      if (info->flags & G_DBUS_PROPERTY_INFO_FLAGS_READABLE)
+        {
+          GVariant *value;
+          value = _connman_proxy_service_skeleton_handle_get_property (g_dbus_interface_skeleton_get_connection (G_DBUS_INTERFACE_SKELETON (skeleton)), NULL, g_dbus_interface_skeleton_get_object_path (G_DBUS_INTERFACE_SKELETON (skeleton)), "net.connman.Service", info->name, NULL, skeleton);
+          if (value != NULL)
+            {
+              g_variant_take_ref (value);
+              g_variant_builder_add (&builder, "{sv}", info->name, value);
+              g_variant_unref (value);
+            }
+        }
+    }
+out:
+  return g_variant_builder_end (&builder);
+}
+
+static void
+connman_proxy_service_skeleton_dbus_interface_flush (GDBusInterfaceSkeleton *_skeleton)
+{
+}
+
+static void
+_connman_proxy_service_on_signal_property_changed (
+    ConnmanProxyService *object,
+    const gchar *arg_unnamed_arg0,
+    GVariant *arg_unnamed_arg1)
+{
+  ConnmanProxyServiceSkeleton *skeleton = CONNMAN_PROXY_SERVICE_SKELETON (object);
+  GDBusConnection *connection = g_dbus_interface_skeleton_get_connection (G_DBUS_INTERFACE_SKELETON (skeleton));
+  if (connection == NULL)
+    return;
+  g_dbus_connection_emit_signal (connection,
+    NULL, g_dbus_interface_skeleton_get_object_path (G_DBUS_INTERFACE_SKELETON (skeleton)), "net.connman.Service", "PropertyChanged",
+    g_variant_new ("(s@v)",
+                   arg_unnamed_arg0,
+                   arg_unnamed_arg1), NULL);
+}
+
+static void connman_proxy_service_skeleton_iface_init (ConnmanProxyServiceIface *iface);
+G_DEFINE_TYPE_WITH_CODE (ConnmanProxyServiceSkeleton, connman_proxy_service_skeleton, G_TYPE_DBUS_INTERFACE_SKELETON,
+                         G_IMPLEMENT_INTERFACE (CONNMAN_PROXY_TYPE_SERVICE, connman_proxy_service_skeleton_iface_init));
+
+static void
+connman_proxy_service_skeleton_finalize (GObject *object)
+{
+  ConnmanProxyServiceSkeleton *skeleton = CONNMAN_PROXY_SERVICE_SKELETON (object);
+  g_list_foreach (skeleton->priv->changed_properties, (GFunc) _changed_property_free, NULL);
+  g_list_free (skeleton->priv->changed_properties);
+  if (skeleton->priv->changed_properties_idle_source != NULL)
+    g_source_destroy (skeleton->priv->changed_properties_idle_source);
+  if (skeleton->priv->context != NULL)
+    g_main_context_unref (skeleton->priv->context);
+  g_mutex_free (skeleton->priv->lock);
+  G_OBJECT_CLASS (connman_proxy_service_skeleton_parent_class)->finalize (object);
+}
+
+static void
+connman_proxy_service_skeleton_init (ConnmanProxyServiceSkeleton *skeleton)
+{
+  skeleton->priv = G_TYPE_INSTANCE_GET_PRIVATE (skeleton, CONNMAN_PROXY_TYPE_SERVICE_SKELETON, ConnmanProxyServiceSkeletonPrivate);
+  skeleton->priv->lock = g_mutex_new ();
+  skeleton->priv->context = g_main_context_get_thread_default ();
+  if (skeleton->priv->context != NULL)
+    g_main_context_ref (skeleton->priv->context);
+}
+
+static void
+connman_proxy_service_skeleton_class_init (ConnmanProxyServiceSkeletonClass *klass)
+{
+  GObjectClass *gobject_class;
+  GDBusInterfaceSkeletonClass *skeleton_class;
+
+  g_type_class_add_private (klass, sizeof (ConnmanProxyServiceSkeletonPrivate));
+
+  gobject_class = G_OBJECT_CLASS (klass);
+  gobject_class->finalize = connman_proxy_service_skeleton_finalize;
+
+  skeleton_class = G_DBUS_INTERFACE_SKELETON_CLASS (klass);
+  skeleton_class->get_info = connman_proxy_service_skeleton_dbus_interface_get_info;
+  skeleton_class->get_properties = connman_proxy_service_skeleton_dbus_interface_get_properties;
+  skeleton_class->flush = connman_proxy_service_skeleton_dbus_interface_flush;
+  skeleton_class->get_vtable = connman_proxy_service_skeleton_dbus_interface_get_vtable;
+}
+
+static void
+connman_proxy_service_skeleton_iface_init (ConnmanProxyServiceIface *iface)
+{
+  iface->property_changed = _connman_proxy_service_on_signal_property_changed;
+}
+
+/**
+ * connman_proxy_service_skeleton_new:
+ *
+ * Creates a skeleton object for the D-Bus interface <link linkend="gdbus-interface-net-connman-Service.top_of_page">net.connman.Service</link>.
+ *
+ * Returns: (transfer full) (type ConnmanProxyServiceSkeleton): The skeleton object.
+ */
+ConnmanProxyService *
+connman_proxy_service_skeleton_new (void)
+{
+  return CONNMAN_PROXY_SERVICE (g_object_new (CONNMAN_PROXY_TYPE_SERVICE_SKELETON, NULL));
+}
+
@@ -1277,6 +1277,1235 @@ GType connman_proxy_technology_skeleton_get_type (void) G_GNUC_CONST;
 ConnmanProxyTechnology *connman_proxy_technology_skeleton_new (void);
 
 
+/* ------------------------------------------------------------------------ */
+/* Declarations for net.connman.Agent */
+
+#define CONNMAN_PROXY_TYPE_AGENT (connman_proxy_agent_get_type ())
+#define CONNMAN_PROXY_AGENT(o) (G_TYPE_CHECK_INSTANCE_CAST ((o), CONNMAN_PROXY_TYPE_AGENT, ConnmanProxyAgent))
+#define CONNMAN_PROXY_IS_AGENT(o) (G_TYPE_CHECK_INSTANCE_TYPE ((o), CONNMAN_PROXY_TYPE_AGENT))
+#define CONNMAN_PROXY_AGENT_GET_IFACE(o) (G_TYPE_INSTANCE_GET_INTERFACE ((o), CONNMAN_PROXY_TYPE_AGENT, ConnmanProxyAgentIface))
+
+struct _ConnmanProxyAgent;
+typedef struct _ConnmanProxyAgent ConnmanProxyAgent;
+typedef struct _ConnmanProxyAgentIface ConnmanProxyAgentIface;
+
+struct _ConnmanProxyAgentIface
+{
+  GTypeInterface parent_iface;
+
+  gboolean (*handle_cancel) (
+    ConnmanProxyAgent *object,
+    GDBusMethodInvocation *invocation);
+
+  gboolean (*handle_release) (
+    ConnmanProxyAgent *object,
+    GDBusMethodInvocation *invocation);
+
+  gboolean (*handle_report_error) (
+    ConnmanProxyAgent *object,
+    GDBusMethodInvocation *invocation,
+    const gchar *arg_unnamed_arg0,
+    const gchar *arg_unnamed_arg1);
+
+  gboolean (*handle_request_browser) (
+    ConnmanProxyAgent *object,
+    GDBusMethodInvocation *invocation,
+    const gchar *arg_unnamed_arg0,
+    const gchar *arg_unnamed_arg1);
+
+  gboolean (*handle_request_input) (
+    ConnmanProxyAgent *object,
+    GDBusMethodInvocation *invocation,
+    const gchar *arg_unnamed_arg0,
+    GVariant *arg_unnamed_arg1);
+
+};
+
+GType connman_proxy_agent_get_type (void) G_GNUC_CONST;
+
+GDBusInterfaceInfo *connman_proxy_agent_interface_info (void);
+guint connman_proxy_agent_override_properties (GObjectClass *klass, guint property_id_begin);
+
+
+/* D-Bus method call completion functions: */
+void connman_proxy_agent_complete_release (
+    ConnmanProxyAgent *object,
+    GDBusMethodInvocation *invocation);
+
+void connman_proxy_agent_complete_report_error (
+    ConnmanProxyAgent *object,
+    GDBusMethodInvocation *invocation);
+
+void connman_proxy_agent_complete_request_browser (
+    ConnmanProxyAgent *object,
+    GDBusMethodInvocation *invocation);
+
+void connman_proxy_agent_complete_request_input (
+    ConnmanProxyAgent *object,
+    GDBusMethodInvocation *invocation,
+    GVariant *unnamed_arg2);
+
+void connman_proxy_agent_complete_cancel (
+    ConnmanProxyAgent *object,
+    GDBusMethodInvocation *invocation);
+
+
+
+/* D-Bus method calls: */
+void connman_proxy_agent_call_release (
+    ConnmanProxyAgent *proxy,
+    GCancellable *cancellable,
+    GAsyncReadyCallback callback,
+    gpointer user_data);
+
+gboolean connman_proxy_agent_call_release_finish (
+    ConnmanProxyAgent *proxy,
+    GAsyncResult *res,
+    GError **error);
+
+gboolean connman_proxy_agent_call_release_sync (
+    ConnmanProxyAgent *proxy,
+    GCancellable *cancellable,
+    GError **error);
+
+void connman_proxy_agent_call_report_error (
+    ConnmanProxyAgent *proxy,
+    const gchar *arg_unnamed_arg0,
+    const gchar *arg_unnamed_arg1,
+    GCancellable *cancellable,
+    GAsyncReadyCallback callback,
+    gpointer user_data);
+
+gboolean connman_proxy_agent_call_report_error_finish (
+    ConnmanProxyAgent *proxy,
+    GAsyncResult *res,
+    GError **error);
+
+gboolean connman_proxy_agent_call_report_error_sync (
+    ConnmanProxyAgent *proxy,
+    const gchar *arg_unnamed_arg0,
+    const gchar *arg_unnamed_arg1,
+    GCancellable *cancellable,
+    GError **error);
+
+void connman_proxy_agent_call_request_browser (
+    ConnmanProxyAgent *proxy,
+    const gchar *arg_unnamed_arg0,
+    const gchar *arg_unnamed_arg1,
+    GCancellable *cancellable,
+    GAsyncReadyCallback callback,
+    gpointer user_data);
+
+gboolean connman_proxy_agent_call_request_browser_finish (
+    ConnmanProxyAgent *proxy,
+    GAsyncResult *res,
+    GError **error);
+
+gboolean connman_proxy_agent_call_request_browser_sync (
+    ConnmanProxyAgent *proxy,
+    const gchar *arg_unnamed_arg0,
+    const gchar *arg_unnamed_arg1,
+    GCancellable *cancellable,
+    GError **error);
+
+void connman_proxy_agent_call_request_input (
+    ConnmanProxyAgent *proxy,
+    const gchar *arg_unnamed_arg0,
+    GVariant *arg_unnamed_arg1,
+    GCancellable *cancellable,
+    GAsyncReadyCallback callback,
+    gpointer user_data);
+
+gboolean connman_proxy_agent_call_request_input_finish (
+    ConnmanProxyAgent *proxy,
+    GVariant **out_unnamed_arg2,
+    GAsyncResult *res,
+    GError **error);
+
+gboolean connman_proxy_agent_call_request_input_sync (
+    ConnmanProxyAgent *proxy,
+    const gchar *arg_unnamed_arg0,
+    GVariant *arg_unnamed_arg1,
+    GVariant **out_unnamed_arg2,
+    GCancellable *cancellable,
+    GError **error);
+
+void connman_proxy_agent_call_cancel (
+    ConnmanProxyAgent *proxy,
+    GCancellable *cancellable,
+    GAsyncReadyCallback callback,
+    gpointer user_data);
+
+gboolean connman_proxy_agent_call_cancel_finish (
+    ConnmanProxyAgent *proxy,
+    GAsyncResult *res,
+    GError **error);
+
+gboolean connman_proxy_agent_call_cancel_sync (
+    ConnmanProxyAgent *proxy,
+    GCancellable *cancellable,
+    GError **error);
+
+
+
+/* ---- */
+
+#define CONNMAN_PROXY_TYPE_AGENT_PROXY (connman_proxy_agent_proxy_get_type ())
+#define CONNMAN_PROXY_AGENT_PROXY(o) (G_TYPE_CHECK_INSTANCE_CAST ((o), CONNMAN_PROXY_TYPE_AGENT_PROXY, ConnmanProxyAgentProxy))
+#define CONNMAN_PROXY_AGENT_PROXY_CLASS(k) (G_TYPE_CHECK_CLASS_CAST ((k), CONNMAN_PROXY_TYPE_AGENT_PROXY, ConnmanProxyAgentProxyClass))
+#define CONNMAN_PROXY_AGENT_PROXY_GET_CLASS(o) (G_TYPE_INSTANCE_GET_CLASS ((o), CONNMAN_PROXY_TYPE_AGENT_PROXY, ConnmanProxyAgentProxyClass))
+#define CONNMAN_PROXY_IS_AGENT_PROXY(o) (G_TYPE_CHECK_INSTANCE_TYPE ((o), CONNMAN_PROXY_TYPE_AGENT_PROXY))
+#define CONNMAN_PROXY_IS_AGENT_PROXY_CLASS(k) (G_TYPE_CHECK_CLASS_TYPE ((k), CONNMAN_PROXY_TYPE_AGENT_PROXY))
+
+typedef struct _ConnmanProxyAgentProxy ConnmanProxyAgentProxy;
+typedef struct _ConnmanProxyAgentProxyClass ConnmanProxyAgentProxyClass;
+typedef struct _ConnmanProxyAgentProxyPrivate ConnmanProxyAgentProxyPrivate;
+
+struct _ConnmanProxyAgentProxy
+{
+  /*< private >*/
+  GDBusProxy parent_instance;
+  ConnmanProxyAgentProxyPrivate *priv;
+};
+
+struct _ConnmanProxyAgentProxyClass
+{
+  GDBusProxyClass parent_class;
+};
+
+GType connman_proxy_agent_proxy_get_type (void) G_GNUC_CONST;
+
+void connman_proxy_agent_proxy_new (
+    GDBusConnection     *connection,
+    GDBusProxyFlags      flags,
+    const gchar         *name,
+    const gchar         *object_path,
+    GCancellable        *cancellable,
+    GAsyncReadyCallback  callback,
+    gpointer             user_data);
+ConnmanProxyAgent *connman_proxy_agent_proxy_new_finish (
+    GAsyncResult        *res,
+    GError             **error);
+ConnmanProxyAgent *connman_proxy_agent_proxy_new_sync (
+    GDBusConnection     *connection,
+    GDBusProxyFlags      flags,
+    const gchar         *name,
+    const gchar         *object_path,
+    GCancellable        *cancellable,
+    GError             **error);
+
+void connman_proxy_agent_proxy_new_for_bus (
+    GBusType             bus_type,
+    GDBusProxyFlags      flags,
+    const gchar         *name,
+    const gchar         *object_path,
+    GCancellable        *cancellable,
+    GAsyncReadyCallback  callback,
+    gpointer             user_data);
+ConnmanProxyAgent *connman_proxy_agent_proxy_new_for_bus_finish (
+    GAsyncResult        *res,
+    GError             **error);
+ConnmanProxyAgent *connman_proxy_agent_proxy_new_for_bus_sync (
+    GBusType             bus_type,
+    GDBusProxyFlags      flags,
+    const gchar         *name,
+    const gchar         *object_path,
+    GCancellable        *cancellable,
+    GError             **error);
+
+
+/* ---- */
+
+#define CONNMAN_PROXY_TYPE_AGENT_SKELETON (connman_proxy_agent_skeleton_get_type ())
+#define CONNMAN_PROXY_AGENT_SKELETON(o) (G_TYPE_CHECK_INSTANCE_CAST ((o), CONNMAN_PROXY_TYPE_AGENT_SKELETON, ConnmanProxyAgentSkeleton))
+#define CONNMAN_PROXY_AGENT_SKELETON_CLASS(k) (G_TYPE_CHECK_CLASS_CAST ((k), CONNMAN_PROXY_TYPE_AGENT_SKELETON, ConnmanProxyAgentSkeletonClass))
+#define CONNMAN_PROXY_AGENT_SKELETON_GET_CLASS(o) (G_TYPE_INSTANCE_GET_CLASS ((o), CONNMAN_PROXY_TYPE_AGENT_SKELETON, ConnmanProxyAgentSkeletonClass))
+#define CONNMAN_PROXY_IS_AGENT_SKELETON(o) (G_TYPE_CHECK_INSTANCE_TYPE ((o), CONNMAN_PROXY_TYPE_AGENT_SKELETON))
+#define CONNMAN_PROXY_IS_AGENT_SKELETON_CLASS(k) (G_TYPE_CHECK_CLASS_TYPE ((k), CONNMAN_PROXY_TYPE_AGENT_SKELETON))
+
+typedef struct _ConnmanProxyAgentSkeleton ConnmanProxyAgentSkeleton;
+typedef struct _ConnmanProxyAgentSkeletonClass ConnmanProxyAgentSkeletonClass;
+typedef struct _ConnmanProxyAgentSkeletonPrivate ConnmanProxyAgentSkeletonPrivate;
+
+struct _ConnmanProxyAgentSkeleton
+{
+  /*< private >*/
+  GDBusInterfaceSkeleton parent_instance;
+  ConnmanProxyAgentSkeletonPrivate *priv;
+};
+
+struct _ConnmanProxyAgentSkeletonClass
+{
+  GDBusInterfaceSkeletonClass parent_class;
+};
+
+GType connman_proxy_agent_skeleton_get_type (void) G_GNUC_CONST;
+
+ConnmanProxyAgent *connman_proxy_agent_skeleton_new (void);
+
+
+/* ------------------------------------------------------------------------ */
+/* Declarations for net.connman.Counter */
+
+#define CONNMAN_PROXY_TYPE_COUNTER (connman_proxy_counter_get_type ())
+#define CONNMAN_PROXY_COUNTER(o) (G_TYPE_CHECK_INSTANCE_CAST ((o), CONNMAN_PROXY_TYPE_COUNTER, ConnmanProxyCounter))
+#define CONNMAN_PROXY_IS_COUNTER(o) (G_TYPE_CHECK_INSTANCE_TYPE ((o), CONNMAN_PROXY_TYPE_COUNTER))
+#define CONNMAN_PROXY_COUNTER_GET_IFACE(o) (G_TYPE_INSTANCE_GET_INTERFACE ((o), CONNMAN_PROXY_TYPE_COUNTER, ConnmanProxyCounterIface))
+
+struct _ConnmanProxyCounter;
+typedef struct _ConnmanProxyCounter ConnmanProxyCounter;
+typedef struct _ConnmanProxyCounterIface ConnmanProxyCounterIface;
+
+struct _ConnmanProxyCounterIface
+{
+  GTypeInterface parent_iface;
+
+  gboolean (*handle_release) (
+    ConnmanProxyCounter *object,
+    GDBusMethodInvocation *invocation);
+
+  gboolean (*handle_usage) (
+    ConnmanProxyCounter *object,
+    GDBusMethodInvocation *invocation,
+    const gchar *arg_unnamed_arg0,
+    GVariant *arg_unnamed_arg1,
+    GVariant *arg_unnamed_arg2);
+
+};
+
+GType connman_proxy_counter_get_type (void) G_GNUC_CONST;
+
+GDBusInterfaceInfo *connman_proxy_counter_interface_info (void);
+guint connman_proxy_counter_override_properties (GObjectClass *klass, guint property_id_begin);
+
+
+/* D-Bus method call completion functions: */
+void connman_proxy_counter_complete_release (
+    ConnmanProxyCounter *object,
+    GDBusMethodInvocation *invocation);
+
+void connman_proxy_counter_complete_usage (
+    ConnmanProxyCounter *object,
+    GDBusMethodInvocation *invocation);
+
+
+
+/* D-Bus method calls: */
+void connman_proxy_counter_call_release (
+    ConnmanProxyCounter *proxy,
+    GCancellable *cancellable,
+    GAsyncReadyCallback callback,
+    gpointer user_data);
+
+gboolean connman_proxy_counter_call_release_finish (
+    ConnmanProxyCounter *proxy,
+    GAsyncResult *res,
+    GError **error);
+
+gboolean connman_proxy_counter_call_release_sync (
+    ConnmanProxyCounter *proxy,
+    GCancellable *cancellable,
+    GError **error);
+
+void connman_proxy_counter_call_usage (
+    ConnmanProxyCounter *proxy,
+    const gchar *arg_unnamed_arg0,
+    GVariant *arg_unnamed_arg1,
+    GVariant *arg_unnamed_arg2,
+    GCancellable *cancellable,
+    GAsyncReadyCallback callback,
+    gpointer user_data);
+
+gboolean connman_proxy_counter_call_usage_finish (
+    ConnmanProxyCounter *proxy,
+    GAsyncResult *res,
+    GError **error);
+
+gboolean connman_proxy_counter_call_usage_sync (
+    ConnmanProxyCounter *proxy,
+    const gchar *arg_unnamed_arg0,
+    GVariant *arg_unnamed_arg1,
+    GVariant *arg_unnamed_arg2,
+    GCancellable *cancellable,
+    GError **error);
+
+
+
+/* ---- */
+
+#define CONNMAN_PROXY_TYPE_COUNTER_PROXY (connman_proxy_counter_proxy_get_type ())
+#define CONNMAN_PROXY_COUNTER_PROXY(o) (G_TYPE_CHECK_INSTANCE_CAST ((o), CONNMAN_PROXY_TYPE_COUNTER_PROXY, ConnmanProxyCounterProxy))
+#define CONNMAN_PROXY_COUNTER_PROXY_CLASS(k) (G_TYPE_CHECK_CLASS_CAST ((k), CONNMAN_PROXY_TYPE_COUNTER_PROXY, ConnmanProxyCounterProxyClass))
+#define CONNMAN_PROXY_COUNTER_PROXY_GET_CLASS(o) (G_TYPE_INSTANCE_GET_CLASS ((o), CONNMAN_PROXY_TYPE_COUNTER_PROXY, ConnmanProxyCounterProxyClass))
+#define CONNMAN_PROXY_IS_COUNTER_PROXY(o) (G_TYPE_CHECK_INSTANCE_TYPE ((o), CONNMAN_PROXY_TYPE_COUNTER_PROXY))
+#define CONNMAN_PROXY_IS_COUNTER_PROXY_CLASS(k) (G_TYPE_CHECK_CLASS_TYPE ((k), CONNMAN_PROXY_TYPE_COUNTER_PROXY))
+
+typedef struct _ConnmanProxyCounterProxy ConnmanProxyCounterProxy;
+typedef struct _ConnmanProxyCounterProxyClass ConnmanProxyCounterProxyClass;
+typedef struct _ConnmanProxyCounterProxyPrivate ConnmanProxyCounterProxyPrivate;
+
+struct _ConnmanProxyCounterProxy
+{
+  /*< private >*/
+  GDBusProxy parent_instance;
+  ConnmanProxyCounterProxyPrivate *priv;
+};
+
+struct _ConnmanProxyCounterProxyClass
+{
+  GDBusProxyClass parent_class;
+};
+
+GType connman_proxy_counter_proxy_get_type (void) G_GNUC_CONST;
+
+void connman_proxy_counter_proxy_new (
+    GDBusConnection     *connection,
+    GDBusProxyFlags      flags,
+    const gchar         *name,
+    const gchar         *object_path,
+    GCancellable        *cancellable,
+    GAsyncReadyCallback  callback,
+    gpointer             user_data);
+ConnmanProxyCounter *connman_proxy_counter_proxy_new_finish (
+    GAsyncResult        *res,
+    GError             **error);
+ConnmanProxyCounter *connman_proxy_counter_proxy_new_sync (
+    GDBusConnection     *connection,
+    GDBusProxyFlags      flags,
+    const gchar         *name,
+    const gchar         *object_path,
+    GCancellable        *cancellable,
+    GError             **error);
+
+void connman_proxy_counter_proxy_new_for_bus (
+    GBusType             bus_type,
+    GDBusProxyFlags      flags,
+    const gchar         *name,
+    const gchar         *object_path,
+    GCancellable        *cancellable,
+    GAsyncReadyCallback  callback,
+    gpointer             user_data);
+ConnmanProxyCounter *connman_proxy_counter_proxy_new_for_bus_finish (
+    GAsyncResult        *res,
+    GError             **error);
+ConnmanProxyCounter *connman_proxy_counter_proxy_new_for_bus_sync (
+    GBusType             bus_type,
+    GDBusProxyFlags      flags,
+    const gchar         *name,
+    const gchar         *object_path,
+    GCancellable        *cancellable,
+    GError             **error);
+
+
+/* ---- */
+
+#define CONNMAN_PROXY_TYPE_COUNTER_SKELETON (connman_proxy_counter_skeleton_get_type ())
+#define CONNMAN_PROXY_COUNTER_SKELETON(o) (G_TYPE_CHECK_INSTANCE_CAST ((o), CONNMAN_PROXY_TYPE_COUNTER_SKELETON, ConnmanProxyCounterSkeleton))
+#define CONNMAN_PROXY_COUNTER_SKELETON_CLASS(k) (G_TYPE_CHECK_CLASS_CAST ((k), CONNMAN_PROXY_TYPE_COUNTER_SKELETON, ConnmanProxyCounterSkeletonClass))
+#define CONNMAN_PROXY_COUNTER_SKELETON_GET_CLASS(o) (G_TYPE_INSTANCE_GET_CLASS ((o), CONNMAN_PROXY_TYPE_COUNTER_SKELETON, ConnmanProxyCounterSkeletonClass))
+#define CONNMAN_PROXY_IS_COUNTER_SKELETON(o) (G_TYPE_CHECK_INSTANCE_TYPE ((o), CONNMAN_PROXY_TYPE_COUNTER_SKELETON))
+#define CONNMAN_PROXY_IS_COUNTER_SKELETON_CLASS(k) (G_TYPE_CHECK_CLASS_TYPE ((k), CONNMAN_PROXY_TYPE_COUNTER_SKELETON))
+
+typedef struct _ConnmanProxyCounterSkeleton ConnmanProxyCounterSkeleton;
+typedef struct _ConnmanProxyCounterSkeletonClass ConnmanProxyCounterSkeletonClass;
+typedef struct _ConnmanProxyCounterSkeletonPrivate ConnmanProxyCounterSkeletonPrivate;
+
+struct _ConnmanProxyCounterSkeleton
+{
+  /*< private >*/
+  GDBusInterfaceSkeleton parent_instance;
+  ConnmanProxyCounterSkeletonPrivate *priv;
+};
+
+struct _ConnmanProxyCounterSkeletonClass
+{
+  GDBusInterfaceSkeletonClass parent_class;
+};
+
+GType connman_proxy_counter_skeleton_get_type (void) G_GNUC_CONST;
+
+ConnmanProxyCounter *connman_proxy_counter_skeleton_new (void);
+
+
+/* ------------------------------------------------------------------------ */
+/* Declarations for net.connman.Session */
+
+#define CONNMAN_PROXY_TYPE_SESSION (connman_proxy_session_get_type ())
+#define CONNMAN_PROXY_SESSION(o) (G_TYPE_CHECK_INSTANCE_CAST ((o), CONNMAN_PROXY_TYPE_SESSION, ConnmanProxySession))
+#define CONNMAN_PROXY_IS_SESSION(o) (G_TYPE_CHECK_INSTANCE_TYPE ((o), CONNMAN_PROXY_TYPE_SESSION))
+#define CONNMAN_PROXY_SESSION_GET_IFACE(o) (G_TYPE_INSTANCE_GET_INTERFACE ((o), CONNMAN_PROXY_TYPE_SESSION, ConnmanProxySessionIface))
+
+struct _ConnmanProxySession;
+typedef struct _ConnmanProxySession ConnmanProxySession;
+typedef struct _ConnmanProxySessionIface ConnmanProxySessionIface;
+
+struct _ConnmanProxySessionIface
+{
+  GTypeInterface parent_iface;
+
+  gboolean (*handle_change) (
+    ConnmanProxySession *object,
+    GDBusMethodInvocation *invocation,
+    const gchar *arg_unnamed_arg0,
+    GVariant *arg_unnamed_arg1);
+
+  gboolean (*handle_connect) (
+    ConnmanProxySession *object,
+    GDBusMethodInvocation *invocation);
+
+  gboolean (*handle_destroy) (
+    ConnmanProxySession *object,
+    GDBusMethodInvocation *invocation);
+
+  gboolean (*handle_disconnect) (
+    ConnmanProxySession *object,
+    GDBusMethodInvocation *invocation);
+
+};
+
+GType connman_proxy_session_get_type (void) G_GNUC_CONST;
+
+GDBusInterfaceInfo *connman_proxy_session_interface_info (void);
+guint connman_proxy_session_override_properties (GObjectClass *klass, guint property_id_begin);
+
+
+/* D-Bus method call completion functions: */
+void connman_proxy_session_complete_destroy (
+    ConnmanProxySession *object,
+    GDBusMethodInvocation *invocation);
+
+void connman_proxy_session_complete_connect (
+    ConnmanProxySession *object,
+    GDBusMethodInvocation *invocation);
+
+void connman_proxy_session_complete_disconnect (
+    ConnmanProxySession *object,
+    GDBusMethodInvocation *invocation);
+
+void connman_proxy_session_complete_change (
+    ConnmanProxySession *object,
+    GDBusMethodInvocation *invocation);
+
+
+
+/* D-Bus method calls: */
+void connman_proxy_session_call_destroy (
+    ConnmanProxySession *proxy,
+    GCancellable *cancellable,
+    GAsyncReadyCallback callback,
+    gpointer user_data);
+
+gboolean connman_proxy_session_call_destroy_finish (
+    ConnmanProxySession *proxy,
+    GAsyncResult *res,
+    GError **error);
+
+gboolean connman_proxy_session_call_destroy_sync (
+    ConnmanProxySession *proxy,
+    GCancellable *cancellable,
+    GError **error);
+
+void connman_proxy_session_call_connect (
+    ConnmanProxySession *proxy,
+    GCancellable *cancellable,
+    GAsyncReadyCallback callback,
+    gpointer user_data);
+
+gboolean connman_proxy_session_call_connect_finish (
+    ConnmanProxySession *proxy,
+    GAsyncResult *res,
+    GError **error);
+
+gboolean connman_proxy_session_call_connect_sync (
+    ConnmanProxySession *proxy,
+    GCancellable *cancellable,
+    GError **error);
+
+void connman_proxy_session_call_disconnect (
+    ConnmanProxySession *proxy,
+    GCancellable *cancellable,
+    GAsyncReadyCallback callback,
+    gpointer user_data);
+
+gboolean connman_proxy_session_call_disconnect_finish (
+    ConnmanProxySession *proxy,
+    GAsyncResult *res,
+    GError **error);
+
+gboolean connman_proxy_session_call_disconnect_sync (
+    ConnmanProxySession *proxy,
+    GCancellable *cancellable,
+    GError **error);
+
+void connman_proxy_session_call_change (
+    ConnmanProxySession *proxy,
+    const gchar *arg_unnamed_arg0,
+    GVariant *arg_unnamed_arg1,
+    GCancellable *cancellable,
+    GAsyncReadyCallback callback,
+    gpointer user_data);
+
+gboolean connman_proxy_session_call_change_finish (
+    ConnmanProxySession *proxy,
+    GAsyncResult *res,
+    GError **error);
+
+gboolean connman_proxy_session_call_change_sync (
+    ConnmanProxySession *proxy,
+    const gchar *arg_unnamed_arg0,
+    GVariant *arg_unnamed_arg1,
+    GCancellable *cancellable,
+    GError **error);
+
+
+
+/* ---- */
+
+#define CONNMAN_PROXY_TYPE_SESSION_PROXY (connman_proxy_session_proxy_get_type ())
+#define CONNMAN_PROXY_SESSION_PROXY(o) (G_TYPE_CHECK_INSTANCE_CAST ((o), CONNMAN_PROXY_TYPE_SESSION_PROXY, ConnmanProxySessionProxy))
+#define CONNMAN_PROXY_SESSION_PROXY_CLASS(k) (G_TYPE_CHECK_CLASS_CAST ((k), CONNMAN_PROXY_TYPE_SESSION_PROXY, ConnmanProxySessionProxyClass))
+#define CONNMAN_PROXY_SESSION_PROXY_GET_CLASS(o) (G_TYPE_INSTANCE_GET_CLASS ((o), CONNMAN_PROXY_TYPE_SESSION_PROXY, ConnmanProxySessionProxyClass))
+#define CONNMAN_PROXY_IS_SESSION_PROXY(o) (G_TYPE_CHECK_INSTANCE_TYPE ((o), CONNMAN_PROXY_TYPE_SESSION_PROXY))
+#define CONNMAN_PROXY_IS_SESSION_PROXY_CLASS(k) (G_TYPE_CHECK_CLASS_TYPE ((k), CONNMAN_PROXY_TYPE_SESSION_PROXY))
+
+typedef struct _ConnmanProxySessionProxy ConnmanProxySessionProxy;
+typedef struct _ConnmanProxySessionProxyClass ConnmanProxySessionProxyClass;
+typedef struct _ConnmanProxySessionProxyPrivate ConnmanProxySessionProxyPrivate;
+
+struct _ConnmanProxySessionProxy
+{
+  /*< private >*/
+  GDBusProxy parent_instance;
+  ConnmanProxySessionProxyPrivate *priv;
+};
+
+struct _ConnmanProxySessionProxyClass
+{
+  GDBusProxyClass parent_class;
+};
+
+GType connman_proxy_session_proxy_get_type (void) G_GNUC_CONST;
+
+void connman_proxy_session_proxy_new (
+    GDBusConnection     *connection,
+    GDBusProxyFlags      flags,
+    const gchar         *name,
+    const gchar         *object_path,
+    GCancellable        *cancellable,
+    GAsyncReadyCallback  callback,
+    gpointer             user_data);
+ConnmanProxySession *connman_proxy_session_proxy_new_finish (
+    GAsyncResult        *res,
+    GError             **error);
+ConnmanProxySession *connman_proxy_session_proxy_new_sync (
+    GDBusConnection     *connection,
+    GDBusProxyFlags      flags,
+    const gchar         *name,
+    const gchar         *object_path,
+    GCancellable        *cancellable,
+    GError             **error);
+
+void connman_proxy_session_proxy_new_for_bus (
+    GBusType             bus_type,
+    GDBusProxyFlags      flags,
+    const gchar         *name,
+    const gchar         *object_path,
+    GCancellable        *cancellable,
+    GAsyncReadyCallback  callback,
+    gpointer             user_data);
+ConnmanProxySession *connman_proxy_session_proxy_new_for_bus_finish (
+    GAsyncResult        *res,
+    GError             **error);
+ConnmanProxySession *connman_proxy_session_proxy_new_for_bus_sync (
+    GBusType             bus_type,
+    GDBusProxyFlags      flags,
+    const gchar         *name,
+    const gchar         *object_path,
+    GCancellable        *cancellable,
+    GError             **error);
+
+
+/* ---- */
+
+#define CONNMAN_PROXY_TYPE_SESSION_SKELETON (connman_proxy_session_skeleton_get_type ())
+#define CONNMAN_PROXY_SESSION_SKELETON(o) (G_TYPE_CHECK_INSTANCE_CAST ((o), CONNMAN_PROXY_TYPE_SESSION_SKELETON, ConnmanProxySessionSkeleton))
+#define CONNMAN_PROXY_SESSION_SKELETON_CLASS(k) (G_TYPE_CHECK_CLASS_CAST ((k), CONNMAN_PROXY_TYPE_SESSION_SKELETON, ConnmanProxySessionSkeletonClass))
+#define CONNMAN_PROXY_SESSION_SKELETON_GET_CLASS(o) (G_TYPE_INSTANCE_GET_CLASS ((o), CONNMAN_PROXY_TYPE_SESSION_SKELETON, ConnmanProxySessionSkeletonClass))
+#define CONNMAN_PROXY_IS_SESSION_SKELETON(o) (G_TYPE_CHECK_INSTANCE_TYPE ((o), CONNMAN_PROXY_TYPE_SESSION_SKELETON))
+#define CONNMAN_PROXY_IS_SESSION_SKELETON_CLASS(k) (G_TYPE_CHECK_CLASS_TYPE ((k), CONNMAN_PROXY_TYPE_SESSION_SKELETON))
+
+typedef struct _ConnmanProxySessionSkeleton ConnmanProxySessionSkeleton;
+typedef struct _ConnmanProxySessionSkeletonClass ConnmanProxySessionSkeletonClass;
+typedef struct _ConnmanProxySessionSkeletonPrivate ConnmanProxySessionSkeletonPrivate;
+
+struct _ConnmanProxySessionSkeleton
+{
+  /*< private >*/
+  GDBusInterfaceSkeleton parent_instance;
+  ConnmanProxySessionSkeletonPrivate *priv;
+};
+
+struct _ConnmanProxySessionSkeletonClass
+{
+  GDBusInterfaceSkeletonClass parent_class;
+};
+
+GType connman_proxy_session_skeleton_get_type (void) G_GNUC_CONST;
+
+ConnmanProxySession *connman_proxy_session_skeleton_new (void);
+
+
+/* ------------------------------------------------------------------------ */
+/* Declarations for net.connman.Notification */
+
+#define CONNMAN_PROXY_TYPE_NOTIFICATION (connman_proxy_notification_get_type ())
+#define CONNMAN_PROXY_NOTIFICATION(o) (G_TYPE_CHECK_INSTANCE_CAST ((o), CONNMAN_PROXY_TYPE_NOTIFICATION, ConnmanProxyNotification))
+#define CONNMAN_PROXY_IS_NOTIFICATION(o) (G_TYPE_CHECK_INSTANCE_TYPE ((o), CONNMAN_PROXY_TYPE_NOTIFICATION))
+#define CONNMAN_PROXY_NOTIFICATION_GET_IFACE(o) (G_TYPE_INSTANCE_GET_INTERFACE ((o), CONNMAN_PROXY_TYPE_NOTIFICATION, ConnmanProxyNotificationIface))
+
+struct _ConnmanProxyNotification;
+typedef struct _ConnmanProxyNotification ConnmanProxyNotification;
+typedef struct _ConnmanProxyNotificationIface ConnmanProxyNotificationIface;
+
+struct _ConnmanProxyNotificationIface
+{
+  GTypeInterface parent_iface;
+
+  gboolean (*handle_release) (
+    ConnmanProxyNotification *object,
+    GDBusMethodInvocation *invocation);
+
+  gboolean (*handle_update) (
+    ConnmanProxyNotification *object,
+    GDBusMethodInvocation *invocation,
+    GVariant *arg_unnamed_arg0);
+
+};
+
+GType connman_proxy_notification_get_type (void) G_GNUC_CONST;
+
+GDBusInterfaceInfo *connman_proxy_notification_interface_info (void);
+guint connman_proxy_notification_override_properties (GObjectClass *klass, guint property_id_begin);
+
+
+/* D-Bus method call completion functions: */
+void connman_proxy_notification_complete_release (
+    ConnmanProxyNotification *object,
+    GDBusMethodInvocation *invocation);
+
+void connman_proxy_notification_complete_update (
+    ConnmanProxyNotification *object,
+    GDBusMethodInvocation *invocation);
+
+
+
+/* D-Bus method calls: */
+void connman_proxy_notification_call_release (
+    ConnmanProxyNotification *proxy,
+    GCancellable *cancellable,
+    GAsyncReadyCallback callback,
+    gpointer user_data);
+
+gboolean connman_proxy_notification_call_release_finish (
+    ConnmanProxyNotification *proxy,
+    GAsyncResult *res,
+    GError **error);
+
+gboolean connman_proxy_notification_call_release_sync (
+    ConnmanProxyNotification *proxy,
+    GCancellable *cancellable,
+    GError **error);
+
+void connman_proxy_notification_call_update (
+    ConnmanProxyNotification *proxy,
+    GVariant *arg_unnamed_arg0,
+    GCancellable *cancellable,
+    GAsyncReadyCallback callback,
+    gpointer user_data);
+
+gboolean connman_proxy_notification_call_update_finish (
+    ConnmanProxyNotification *proxy,
+    GAsyncResult *res,
+    GError **error);
+
+gboolean connman_proxy_notification_call_update_sync (
+    ConnmanProxyNotification *proxy,
+    GVariant *arg_unnamed_arg0,
+    GCancellable *cancellable,
+    GError **error);
+
+
+
+/* ---- */
+
+#define CONNMAN_PROXY_TYPE_NOTIFICATION_PROXY (connman_proxy_notification_proxy_get_type ())
+#define CONNMAN_PROXY_NOTIFICATION_PROXY(o) (G_TYPE_CHECK_INSTANCE_CAST ((o), CONNMAN_PROXY_TYPE_NOTIFICATION_PROXY, ConnmanProxyNotificationProxy))
+#define CONNMAN_PROXY_NOTIFICATION_PROXY_CLASS(k) (G_TYPE_CHECK_CLASS_CAST ((k), CONNMAN_PROXY_TYPE_NOTIFICATION_PROXY, ConnmanProxyNotificationProxyClass))
+#define CONNMAN_PROXY_NOTIFICATION_PROXY_GET_CLASS(o) (G_TYPE_INSTANCE_GET_CLASS ((o), CONNMAN_PROXY_TYPE_NOTIFICATION_PROXY, ConnmanProxyNotificationProxyClass))
+#define CONNMAN_PROXY_IS_NOTIFICATION_PROXY(o) (G_TYPE_CHECK_INSTANCE_TYPE ((o), CONNMAN_PROXY_TYPE_NOTIFICATION_PROXY))
+#define CONNMAN_PROXY_IS_NOTIFICATION_PROXY_CLASS(k) (G_TYPE_CHECK_CLASS_TYPE ((k), CONNMAN_PROXY_TYPE_NOTIFICATION_PROXY))
+
+typedef struct _ConnmanProxyNotificationProxy ConnmanProxyNotificationProxy;
+typedef struct _ConnmanProxyNotificationProxyClass ConnmanProxyNotificationProxyClass;
+typedef struct _ConnmanProxyNotificationProxyPrivate ConnmanProxyNotificationProxyPrivate;
+
+struct _ConnmanProxyNotificationProxy
+{
+  /*< private >*/
+  GDBusProxy parent_instance;
+  ConnmanProxyNotificationProxyPrivate *priv;
+};
+
+struct _ConnmanProxyNotificationProxyClass
+{
+  GDBusProxyClass parent_class;
+};
+
+GType connman_proxy_notification_proxy_get_type (void) G_GNUC_CONST;
+
+void connman_proxy_notification_proxy_new (
+    GDBusConnection     *connection,
+    GDBusProxyFlags      flags,
+    const gchar         *name,
+    const gchar         *object_path,
+    GCancellable        *cancellable,
+    GAsyncReadyCallback  callback,
+    gpointer             user_data);
+ConnmanProxyNotification *connman_proxy_notification_proxy_new_finish (
+    GAsyncResult        *res,
+    GError             **error);
+ConnmanProxyNotification *connman_proxy_notification_proxy_new_sync (
+    GDBusConnection     *connection,
+    GDBusProxyFlags      flags,
+    const gchar         *name,
+    const gchar         *object_path,
+    GCancellable        *cancellable,
+    GError             **error);
+
+void connman_proxy_notification_proxy_new_for_bus (
+    GBusType             bus_type,
+    GDBusProxyFlags      flags,
+    const gchar         *name,
+    const gchar         *object_path,
+    GCancellable        *cancellable,
+    GAsyncReadyCallback  callback,
+    gpointer             user_data);
+ConnmanProxyNotification *connman_proxy_notification_proxy_new_for_bus_finish (
+    GAsyncResult        *res,
+    GError             **error);
+ConnmanProxyNotification *connman_proxy_notification_proxy_new_for_bus_sync (
+    GBusType             bus_type,
+    GDBusProxyFlags      flags,
+    const gchar         *name,
+    const gchar         *object_path,
+    GCancellable        *cancellable,
+    GError             **error);
+
+
+/* ---- */
+
+#define CONNMAN_PROXY_TYPE_NOTIFICATION_SKELETON (connman_proxy_notification_skeleton_get_type ())
+#define CONNMAN_PROXY_NOTIFICATION_SKELETON(o) (G_TYPE_CHECK_INSTANCE_CAST ((o), CONNMAN_PROXY_TYPE_NOTIFICATION_SKELETON, ConnmanProxyNotificationSkeleton))
+#define CONNMAN_PROXY_NOTIFICATION_SKELETON_CLASS(k) (G_TYPE_CHECK_CLASS_CAST ((k), CONNMAN_PROXY_TYPE_NOTIFICATION_SKELETON, ConnmanProxyNotificationSkeletonClass))
+#define CONNMAN_PROXY_NOTIFICATION_SKELETON_GET_CLASS(o) (G_TYPE_INSTANCE_GET_CLASS ((o), CONNMAN_PROXY_TYPE_NOTIFICATION_SKELETON, ConnmanProxyNotificationSkeletonClass))
+#define CONNMAN_PROXY_IS_NOTIFICATION_SKELETON(o) (G_TYPE_CHECK_INSTANCE_TYPE ((o), CONNMAN_PROXY_TYPE_NOTIFICATION_SKELETON))
+#define CONNMAN_PROXY_IS_NOTIFICATION_SKELETON_CLASS(k) (G_TYPE_CHECK_CLASS_TYPE ((k), CONNMAN_PROXY_TYPE_NOTIFICATION_SKELETON))
+
+typedef struct _ConnmanProxyNotificationSkeleton ConnmanProxyNotificationSkeleton;
+typedef struct _ConnmanProxyNotificationSkeletonClass ConnmanProxyNotificationSkeletonClass;
+typedef struct _ConnmanProxyNotificationSkeletonPrivate ConnmanProxyNotificationSkeletonPrivate;
+
+struct _ConnmanProxyNotificationSkeleton
+{
+  /*< private >*/
+  GDBusInterfaceSkeleton parent_instance;
+  ConnmanProxyNotificationSkeletonPrivate *priv;
+};
+
+struct _ConnmanProxyNotificationSkeletonClass
+{
+  GDBusInterfaceSkeletonClass parent_class;
+};
+
+GType connman_proxy_notification_skeleton_get_type (void) G_GNUC_CONST;
+
+ConnmanProxyNotification *connman_proxy_notification_skeleton_new (void);
+
+
+/* ------------------------------------------------------------------------ */
+/* Declarations for net.connman.Service */
+
+#define CONNMAN_PROXY_TYPE_SERVICE (connman_proxy_service_get_type ())
+#define CONNMAN_PROXY_SERVICE(o) (G_TYPE_CHECK_INSTANCE_CAST ((o), CONNMAN_PROXY_TYPE_SERVICE, ConnmanProxyService))
+#define CONNMAN_PROXY_IS_SERVICE(o) (G_TYPE_CHECK_INSTANCE_TYPE ((o), CONNMAN_PROXY_TYPE_SERVICE))
+#define CONNMAN_PROXY_SERVICE_GET_IFACE(o) (G_TYPE_INSTANCE_GET_INTERFACE ((o), CONNMAN_PROXY_TYPE_SERVICE, ConnmanProxyServiceIface))
+
+struct _ConnmanProxyService;
+typedef struct _ConnmanProxyService ConnmanProxyService;
+typedef struct _ConnmanProxyServiceIface ConnmanProxyServiceIface;
+
+struct _ConnmanProxyServiceIface
+{
+  GTypeInterface parent_iface;
+
+
+  gboolean (*handle_clear_property) (
+    ConnmanProxyService *object,
+    GDBusMethodInvocation *invocation,
+    const gchar *arg_unnamed_arg0);
+
+  gboolean (*handle_connect) (
+    ConnmanProxyService *object,
+    GDBusMethodInvocation *invocation);
+
+  gboolean (*handle_disconnect) (
+    ConnmanProxyService *object,
+    GDBusMethodInvocation *invocation);
+
+  gboolean (*handle_get_properties) (
+    ConnmanProxyService *object,
+    GDBusMethodInvocation *invocation);
+
+  gboolean (*handle_move_after) (
+    ConnmanProxyService *object,
+    GDBusMethodInvocation *invocation,
+    const gchar *arg_unnamed_arg0);
+
+  gboolean (*handle_move_before) (
+    ConnmanProxyService *object,
+    GDBusMethodInvocation *invocation,
+    const gchar *arg_unnamed_arg0);
+
+  gboolean (*handle_remove) (
+    ConnmanProxyService *object,
+    GDBusMethodInvocation *invocation);
+
+  gboolean (*handle_reset_counters) (
+    ConnmanProxyService *object,
+    GDBusMethodInvocation *invocation);
+
+  gboolean (*handle_set_property) (
+    ConnmanProxyService *object,
+    GDBusMethodInvocation *invocation,
+    const gchar *arg_unnamed_arg0,
+    GVariant *arg_unnamed_arg1);
+
+  void (*property_changed) (
+    ConnmanProxyService *object,
+    const gchar *arg_unnamed_arg0,
+    GVariant *arg_unnamed_arg1);
+
+};
+
+GType connman_proxy_service_get_type (void) G_GNUC_CONST;
+
+GDBusInterfaceInfo *connman_proxy_service_interface_info (void);
+guint connman_proxy_service_override_properties (GObjectClass *klass, guint property_id_begin);
+
+
+/* D-Bus method call completion functions: */
+void connman_proxy_service_complete_get_properties (
+    ConnmanProxyService *object,
+    GDBusMethodInvocation *invocation,
+    GVariant *unnamed_arg0);
+
+void connman_proxy_service_complete_set_property (
+    ConnmanProxyService *object,
+    GDBusMethodInvocation *invocation);
+
+void connman_proxy_service_complete_clear_property (
+    ConnmanProxyService *object,
+    GDBusMethodInvocation *invocation);
+
+void connman_proxy_service_complete_connect (
+    ConnmanProxyService *object,
+    GDBusMethodInvocation *invocation);
+
+void connman_proxy_service_complete_disconnect (
+    ConnmanProxyService *object,
+    GDBusMethodInvocation *invocation);
+
+void connman_proxy_service_complete_remove (
+    ConnmanProxyService *object,
+    GDBusMethodInvocation *invocation);
+
+void connman_proxy_service_complete_move_before (
+    ConnmanProxyService *object,
+    GDBusMethodInvocation *invocation);
+
+void connman_proxy_service_complete_move_after (
+    ConnmanProxyService *object,
+    GDBusMethodInvocation *invocation);
+
+void connman_proxy_service_complete_reset_counters (
+    ConnmanProxyService *object,
+    GDBusMethodInvocation *invocation);
+
+
+
+/* D-Bus signal emissions functions: */
+void connman_proxy_service_emit_property_changed (
+    ConnmanProxyService *object,
+    const gchar *arg_unnamed_arg0,
+    GVariant *arg_unnamed_arg1);
+
+
+
+/* D-Bus method calls: */
+void connman_proxy_service_call_get_properties (
+    ConnmanProxyService *proxy,
+    GCancellable *cancellable,
+    GAsyncReadyCallback callback,
+    gpointer user_data);
+
+gboolean connman_proxy_service_call_get_properties_finish (
+    ConnmanProxyService *proxy,
+    GVariant **out_unnamed_arg0,
+    GAsyncResult *res,
+    GError **error);
+
+gboolean connman_proxy_service_call_get_properties_sync (
+    ConnmanProxyService *proxy,
+    GVariant **out_unnamed_arg0,
+    GCancellable *cancellable,
+    GError **error);
+
+void connman_proxy_service_call_set_property (
+    ConnmanProxyService *proxy,
+    const gchar *arg_unnamed_arg0,
+    GVariant *arg_unnamed_arg1,
+    GCancellable *cancellable,
+    GAsyncReadyCallback callback,
+    gpointer user_data);
+
+gboolean connman_proxy_service_call_set_property_finish (
+    ConnmanProxyService *proxy,
+    GAsyncResult *res,
+    GError **error);
+
+gboolean connman_proxy_service_call_set_property_sync (
+    ConnmanProxyService *proxy,
+    const gchar *arg_unnamed_arg0,
+    GVariant *arg_unnamed_arg1,
+    GCancellable *cancellable,
+    GError **error);
+
+void connman_proxy_service_call_clear_property (
+    ConnmanProxyService *proxy,
+    const gchar *arg_unnamed_arg0,
+    GCancellable *cancellable,
+    GAsyncReadyCallback callback,
+    gpointer user_data);
+
+gboolean connman_proxy_service_call_clear_property_finish (
+    ConnmanProxyService *proxy,
+    GAsyncResult *res,
+    GError **error);
+
+gboolean connman_proxy_service_call_clear_property_sync (
+    ConnmanProxyService *proxy,
+    const gchar *arg_unnamed_arg0,
+    GCancellable *cancellable,
+    GError **error);
+
+void connman_proxy_service_call_connect (
+    ConnmanProxyService *proxy,
+    GCancellable *cancellable,
+    GAsyncReadyCallback callback,
+    gpointer user_data);
+
+gboolean connman_proxy_service_call_connect_finish (
+    ConnmanProxyService *proxy,
+    GAsyncResult *res,
+    GError **error);
+
+gboolean connman_proxy_service_call_connect_sync (
+    ConnmanProxyService *proxy,
+    GCancellable *cancellable,
+    GError **error);
+
+void connman_proxy_service_call_disconnect (
+    ConnmanProxyService *proxy,
+    GCancellable *cancellable,
+    GAsyncReadyCallback callback,
+    gpointer user_data);
+
+gboolean connman_proxy_service_call_disconnect_finish (
+    ConnmanProxyService *proxy,
+    GAsyncResult *res,
+    GError **error);
+
+gboolean connman_proxy_service_call_disconnect_sync (
+    ConnmanProxyService *proxy,
+    GCancellable *cancellable,
+    GError **error);
+
+void connman_proxy_service_call_remove (
+    ConnmanProxyService *proxy,
+    GCancellable *cancellable,
+    GAsyncReadyCallback callback,
+    gpointer user_data);
+
+gboolean connman_proxy_service_call_remove_finish (
+    ConnmanProxyService *proxy,
+    GAsyncResult *res,
+    GError **error);
+
+gboolean connman_proxy_service_call_remove_sync (
+    ConnmanProxyService *proxy,
+    GCancellable *cancellable,
+    GError **error);
+
+void connman_proxy_service_call_move_before (
+    ConnmanProxyService *proxy,
+    const gchar *arg_unnamed_arg0,
+    GCancellable *cancellable,
+    GAsyncReadyCallback callback,
+    gpointer user_data);
+
+gboolean connman_proxy_service_call_move_before_finish (
+    ConnmanProxyService *proxy,
+    GAsyncResult *res,
+    GError **error);
+
+gboolean connman_proxy_service_call_move_before_sync (
+    ConnmanProxyService *proxy,
+    const gchar *arg_unnamed_arg0,
+    GCancellable *cancellable,
+    GError **error);
+
+void connman_proxy_service_call_move_after (
+    ConnmanProxyService *proxy,
+    const gchar *arg_unnamed_arg0,
+    GCancellable *cancellable,
+    GAsyncReadyCallback callback,
+    gpointer user_data);
+
+gboolean connman_proxy_service_call_move_after_finish (
+    ConnmanProxyService *proxy,
+    GAsyncResult *res,
+    GError **error);
+
+gboolean connman_proxy_service_call_move_after_sync (
+    ConnmanProxyService *proxy,
+    const gchar *arg_unnamed_arg0,
+    GCancellable *cancellable,
+    GError **error);
+
+void connman_proxy_service_call_reset_counters (
+    ConnmanProxyService *proxy,
+    GCancellable *cancellable,
+    GAsyncReadyCallback callback,
+    gpointer user_data);
+
+gboolean connman_proxy_service_call_reset_counters_finish (
+    ConnmanProxyService *proxy,
+    GAsyncResult *res,
+    GError **error);
+
+gboolean connman_proxy_service_call_reset_counters_sync (
+    ConnmanProxyService *proxy,
+    GCancellable *cancellable,
+    GError **error);
+
+
+
+/* ---- */
+
+#define CONNMAN_PROXY_TYPE_SERVICE_PROXY (connman_proxy_service_proxy_get_type ())
+#define CONNMAN_PROXY_SERVICE_PROXY(o) (G_TYPE_CHECK_INSTANCE_CAST ((o), CONNMAN_PROXY_TYPE_SERVICE_PROXY, ConnmanProxyServiceProxy))
+#define CONNMAN_PROXY_SERVICE_PROXY_CLASS(k) (G_TYPE_CHECK_CLASS_CAST ((k), CONNMAN_PROXY_TYPE_SERVICE_PROXY, ConnmanProxyServiceProxyClass))
+#define CONNMAN_PROXY_SERVICE_PROXY_GET_CLASS(o) (G_TYPE_INSTANCE_GET_CLASS ((o), CONNMAN_PROXY_TYPE_SERVICE_PROXY, ConnmanProxyServiceProxyClass))
+#define CONNMAN_PROXY_IS_SERVICE_PROXY(o) (G_TYPE_CHECK_INSTANCE_TYPE ((o), CONNMAN_PROXY_TYPE_SERVICE_PROXY))
+#define CONNMAN_PROXY_IS_SERVICE_PROXY_CLASS(k) (G_TYPE_CHECK_CLASS_TYPE ((k), CONNMAN_PROXY_TYPE_SERVICE_PROXY))
+
+typedef struct _ConnmanProxyServiceProxy ConnmanProxyServiceProxy;
+typedef struct _ConnmanProxyServiceProxyClass ConnmanProxyServiceProxyClass;
+typedef struct _ConnmanProxyServiceProxyPrivate ConnmanProxyServiceProxyPrivate;
+
+struct _ConnmanProxyServiceProxy
+{
+  /*< private >*/
+  GDBusProxy parent_instance;
+  ConnmanProxyServiceProxyPrivate *priv;
+};
+
+struct _ConnmanProxyServiceProxyClass
+{
+  GDBusProxyClass parent_class;
+};
+
+GType connman_proxy_service_proxy_get_type (void) G_GNUC_CONST;
+
+void connman_proxy_service_proxy_new (
+    GDBusConnection     *connection,
+    GDBusProxyFlags      flags,
+    const gchar         *name,
+    const gchar         *object_path,
+    GCancellable        *cancellable,
+    GAsyncReadyCallback  callback,
+    gpointer             user_data);
+ConnmanProxyService *connman_proxy_service_proxy_new_finish (
+    GAsyncResult        *res,
+    GError             **error);
+ConnmanProxyService *connman_proxy_service_proxy_new_sync (
+    GDBusConnection     *connection,
+    GDBusProxyFlags      flags,
+    const gchar         *name,
+    const gchar         *object_path,
+    GCancellable        *cancellable,
+    GError             **error);
+
+void connman_proxy_service_proxy_new_for_bus (
+    GBusType             bus_type,
+    GDBusProxyFlags      flags,
+    const gchar         *name,
+    const gchar         *object_path,
+    GCancellable        *cancellable,
+    GAsyncReadyCallback  callback,
+    gpointer             user_data);
+ConnmanProxyService *connman_proxy_service_proxy_new_for_bus_finish (
+    GAsyncResult        *res,
+    GError             **error);
+ConnmanProxyService *connman_proxy_service_proxy_new_for_bus_sync (
+    GBusType             bus_type,
+    GDBusProxyFlags      flags,
+    const gchar         *name,
+    const gchar         *object_path,
+    GCancellable        *cancellable,
+    GError             **error);
+
+
+/* ---- */
+
+#define CONNMAN_PROXY_TYPE_SERVICE_SKELETON (connman_proxy_service_skeleton_get_type ())
+#define CONNMAN_PROXY_SERVICE_SKELETON(o) (G_TYPE_CHECK_INSTANCE_CAST ((o), CONNMAN_PROXY_TYPE_SERVICE_SKELETON, ConnmanProxyServiceSkeleton))
+#define CONNMAN_PROXY_SERVICE_SKELETON_CLASS(k) (G_TYPE_CHECK_CLASS_CAST ((k), CONNMAN_PROXY_TYPE_SERVICE_SKELETON, ConnmanProxyServiceSkeletonClass))
+#define CONNMAN_PROXY_SERVICE_SKELETON_GET_CLASS(o) (G_TYPE_INSTANCE_GET_CLASS ((o), CONNMAN_PROXY_TYPE_SERVICE_SKELETON, ConnmanProxyServiceSkeletonClass))
+#define CONNMAN_PROXY_IS_SERVICE_SKELETON(o) (G_TYPE_CHECK_INSTANCE_TYPE ((o), CONNMAN_PROXY_TYPE_SERVICE_SKELETON))
+#define CONNMAN_PROXY_IS_SERVICE_SKELETON_CLASS(k) (G_TYPE_CHECK_CLASS_TYPE ((k), CONNMAN_PROXY_TYPE_SERVICE_SKELETON))
+
+typedef struct _ConnmanProxyServiceSkeleton ConnmanProxyServiceSkeleton;
+typedef struct _ConnmanProxyServiceSkeletonClass ConnmanProxyServiceSkeletonClass;
+typedef struct _ConnmanProxyServiceSkeletonPrivate ConnmanProxyServiceSkeletonPrivate;
+
+struct _ConnmanProxyServiceSkeleton
+{
+  /*< private >*/
+  GDBusInterfaceSkeleton parent_instance;
+  ConnmanProxyServiceSkeletonPrivate *priv;
+};
+
+struct _ConnmanProxyServiceSkeletonClass
+{
+  GDBusInterfaceSkeletonClass parent_class;
+};
+
+GType connman_proxy_service_skeleton_get_type (void) G_GNUC_CONST;
+
+ConnmanProxyService *connman_proxy_service_skeleton_new (void);
+
+
 G_END_DECLS
 
 #endif /* __SRC_CONNMAN_GENERATED_H__ */
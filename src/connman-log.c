@@ -0,0 +1,150 @@
+/*
+ *  Connection Manager example
+ *
+ *  Copyright (C) 2011  Daniel Mack <daniel@zonque.org>
+ *
+ *  This program is free software; you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License version 2 as
+ *  published by the Free Software Foundation.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program; if not, write to the Free Software
+ *  Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+
+#include <string.h>
+
+#include <glib.h>
+
+#include "connman-log.h"
+
+#define CONNMAN_LOG_DOMAIN "connman"
+
+gint connman_log_level = CONNMAN_LOG_MESSAGE;
+
+static const gchar *level_names[] = {
+  "critical",
+  "warning",
+  "message",
+  "info",
+  "debug",
+};
+
+static const GLogLevelFlags level_flags[] = {
+  G_LOG_LEVEL_CRITICAL,
+  G_LOG_LEVEL_WARNING,
+  G_LOG_LEVEL_MESSAGE,
+  G_LOG_LEVEL_INFO,
+  G_LOG_LEVEL_DEBUG,
+};
+
+/*
+ * Pick up the runtime level from CONNMAN_LOG_LEVEL, which takes one of
+ * the level names ("critical" ... "debug").
+ */
+void connman_log_init(void)
+{
+  const gchar *env = g_getenv("CONNMAN_LOG_LEVEL");
+  guint i;
+
+  if (!env)
+    return;
+
+  for (i = 0; i < G_N_ELEMENTS(level_names); i++)
+    if (g_ascii_strcasecmp(env, level_names[i]) == 0)
+      {
+        connman_log_set_level(i);
+        return;
+      }
+
+  g_warning("Unknown CONNMAN_LOG_LEVEL '%s'", env);
+}
+
+/*
+ * GLib's default handler and writer drop info and debug messages of
+ * domains not listed in G_MESSAGES_DEBUG, so ours are added there once
+ * the gate lets them through.
+ */
+static void enable_glib_debug_domain(void)
+{
+  const gchar *domains = g_getenv("G_MESSAGES_DEBUG");
+  gchar **list;
+  gchar *value;
+  gboolean listed = FALSE;
+  guint i;
+
+  if (!domains || !*domains)
+    {
+      g_setenv("G_MESSAGES_DEBUG", CONNMAN_LOG_DOMAIN, TRUE);
+      return;
+    }
+
+  list = g_strsplit(domains, " ", -1);
+  for (i = 0; list[i]; i++)
+    if (g_str_equal(list[i], "all") || g_str_equal(list[i], CONNMAN_LOG_DOMAIN))
+      listed = TRUE;
+  g_strfreev(list);
+
+  if (listed)
+    return;
+
+  value = g_strconcat(domains, " " CONNMAN_LOG_DOMAIN, NULL);
+  g_setenv("G_MESSAGES_DEBUG", value, TRUE);
+  g_free(value);
+}
+
+void connman_log_set_level(gint level)
+{
+  connman_log_level = CLAMP(level, CONNMAN_LOG_CRITICAL, CONNMAN_LOG_DEBUG);
+
+  if (connman_log_level >= CONNMAN_LOG_INFO)
+    enable_glib_debug_domain();
+}
+
+/*
+ * Only reached through the CONNMAN_LOG() macros once the level check
+ * passed, so the message is never formatted for nothing.
+ */
+void connman_log_real(gint level,
+                      const gchar *file,
+                      const gchar *line,
+                      const gchar *func,
+                      const gchar *object,
+                      const gchar *format,
+                      ...)
+{
+  va_list args;
+  gchar *message;
+
+  va_start(args, format);
+  message = g_strdup_vprintf(format, args);
+  va_end(args);
+
+#if GLIB_CHECK_VERSION(2,50,0)
+  {
+    GLogField fields[] = {
+      { "GLIB_DOMAIN", CONNMAN_LOG_DOMAIN, -1 },
+      { "MESSAGE", message, -1 },
+      { "CODE_FILE", file, -1 },
+      { "CODE_LINE", line, -1 },
+      { "CODE_FUNC", func, -1 },
+      { "CONNMAN_OBJECT", object, -1 },
+    };
+
+    g_log_structured_array(level_flags[level], fields,
+                           object ? G_N_ELEMENTS(fields) : G_N_ELEMENTS(fields) - 1);
+  }
+#else
+  if (object)
+    g_log(CONNMAN_LOG_DOMAIN, level_flags[level], "%s: %s", object, message);
+  else
+    g_log(CONNMAN_LOG_DOMAIN, level_flags[level], "%s", message);
+#endif
+
+  g_free(message);
+}
@@ -0,0 +1,54 @@
+#ifndef CONNMAN_LOG_H_
+#define CONNMAN_LOG_H_
+
+#include <glib.h>
+
+G_BEGIN_DECLS
+
+enum {
+  CONNMAN_LOG_CRITICAL = 0,
+  CONNMAN_LOG_WARNING,
+  CONNMAN_LOG_MESSAGE,
+  CONNMAN_LOG_INFO,
+  CONNMAN_LOG_DEBUG
+};
+
+/*
+ * Levels above CONNMAN_LOG_MAX_LEVEL are removed at compile time, e.g.
+ * with CFLAGS=-DCONNMAN_LOG_MAX_LEVEL=2 for message and below.
+ */
+#ifndef CONNMAN_LOG_MAX_LEVEL
+#define CONNMAN_LOG_MAX_LEVEL CONNMAN_LOG_DEBUG
+#endif
+
+extern gint connman_log_level;
+
+#define connman_log_enabled(level) \
+  ((level) <= CONNMAN_LOG_MAX_LEVEL && (level) <= connman_log_level)
+
+/* arguments are only evaluated when the level is enabled */
+#define CONNMAN_LOG(level, object, ...)                                 \
+  G_STMT_START {                                                        \
+    if (connman_log_enabled(level))                                     \
+      connman_log_real(level, __FILE__, G_STRINGIFY(__LINE__),          \
+                       G_STRFUNC, object, __VA_ARGS__);                 \
+  } G_STMT_END
+
+#define connman_debug(object, ...)   CONNMAN_LOG(CONNMAN_LOG_DEBUG, object, __VA_ARGS__)
+#define connman_info(object, ...)    CONNMAN_LOG(CONNMAN_LOG_INFO, object, __VA_ARGS__)
+#define connman_message(object, ...) CONNMAN_LOG(CONNMAN_LOG_MESSAGE, object, __VA_ARGS__)
+
+void connman_log_init(void);
+void connman_log_set_level(gint level);
+void connman_log_real(gint level,
+                      const gchar *file,
+                      const gchar *line,
+                      const gchar *func,
+                      const gchar *object,
+                      const gchar *format,
+                      ...) G_GNUC_PRINTF(6, 7);
+
+G_END_DECLS
+
+
+#endif /* CONNMAN_LOG_H_ */
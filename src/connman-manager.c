@@ -17,13 +17,86 @@
  *  Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
  */
 
+#include <string.h>
+
 #include <glib.h>
 #include <gio/gio.h>
 
+#include "connman-agent.h"
+#include "connman-changelog.h"
+#include "connman-counter.h"
+#include "connman-error.h"
 #include "connman-generated.h"
+#include "connman-log.h"
 #include "connman-manager.h"
 #include "connman-service.h"
+#include "connman-session.h"
+#include "connman-shm.h"
+#include "connman-snapshot.h"
+#include "connman-stats.h"
 #include "connman-technology.h"
+#include "connman-trace.h"
+
+/* default window in which bursts of PropertyChanged signals are folded */
+#define DEFAULT_COALESCE_INTERVAL 20 /* ms */
+
+/* strength margin a suppressed service needs over the weakest tracked one */
+#define READMIT_HYSTERESIS 5
+
+/* connect dictionaries kept for reuse before the cache starts over */
+#define MAX_CONNECT_PARAMS 16
+
+/* a scan finished this recently satisfies a new scan request */
+#define SCAN_COALESCE_WINDOW 2 /* s */
+
+/* connections weaker than this keep scanning at the fast interval */
+#define SCAN_WEAK_STRENGTH 40
+
+/* ProvisionService calls kept in flight by a batch unless told otherwise */
+#define DEFAULT_PROVISION_CONCURRENCY 8
+
+/* how often a changed service list is written to the snapshot file */
+#define SNAPSHOT_INTERVAL 60 /* s */
+
+typedef struct _ConnectOp ConnectOp;
+
+/* scan scheduling for one technology type */
+typedef struct {
+  ConnmanManager *manager;
+  gchar *type;
+  GSource *timer;               /* next periodic scan */
+  guint interval;               /* s, grows while the connection is good */
+  gboolean in_flight;
+  gboolean unsupported;         /* ConnMan can not scan this technology */
+  gint64 start;                 /* connman_stats_begin() of the D-Bus call */
+  gint64 last_scan;             /* monotonic time the last scan finished */
+} ScanState;
+
+/*
+ * Connect scheduling, one slot per service type: at most one
+ * ConnectService call in flight, the rest queued by priority.
+ */
+typedef struct {
+  ConnectOp *active;
+  GSList *queue;                /* ConnectOp, highest priority first */
+} ConnectSlot;
+
+typedef struct {
+  ConnmanConnectCallback callback;
+  gpointer user_data;
+} ConnectWaiter;
+
+struct _ConnectOp {
+  ConnmanManager *manager;      /* reffed while the call is in flight */
+  ConnectSlot *slot;
+  ConnmanService *service;
+  gchar *secret;
+  gint priority;
+  gint64 requested;             /* monotonic time of the first request */
+  gint64 start;                 /* connman_stats_begin() of the D-Bus call */
+  ConnmanProxyService *proxy;   /* set when connecting by object path */
+  GSList *waiters;              /* ConnectWaiter */
+};
 
 struct _ConnmanManager {
   GObject parent;
@@ -32,11 +105,75 @@ struct _ConnmanManager {
   ConnmanProxyManager *proxy;
   GSList *services;
   GSList *technologies;
+
+  /* change coalescing */
+  GMainContext *context;
+  GSource *coalesce_source;
+  guint coalesce_interval;
+  gboolean services_dirty;
+  gboolean properties_dirty;    /* technologies and online state */
+  guint retry_attempt;          /* failed refreshes in a row */
+  GHashTable *pending;          /* ConnmanService -> CONNMAN_SERVICE_FIELD_* mask */
+  guint service_signal_id;
+
+  GSList *filters;              /* ConnmanServiceFilter, attached to every service */
+
+  /* indexes over manager->services */
+  GHashTable *by_path;          /* object path -> ConnmanService */
+  GHashTable *by_identifier;    /* last path element -> ConnmanService */
+  GHashTable *by_name;          /* SSID -> GSList of ConnmanService, one per BSS */
+  GHashTable *indexed_names;    /* ConnmanService -> name it is filed under */
+
+  /* bounded-memory mode */
+  guint max_services;           /* 0 for no limit */
+  GHashTable *evicted;          /* object paths listed by ConnMan but not tracked */
+  guint evictions;
+
+  ConnectSlot connects[CONNMAN_SERVICE_TYPE_MAX + 1];
+  GHashTable *connect_params;   /* "path\nsecurity\nsecret hash" -> a{sv} */
+  GQueue connect_params_order;  /* keys of connect_params, oldest first */
+
+  /* warm start */
+  gchar *snapshot_path;
+  GSource *snapshot_source;
+  gboolean snapshot_dirty;
+  gboolean stale;               /* state comes from the snapshot, not the bus */
+  gboolean online;              /* last known OfflineMode, inverted */
+  GVariant *prefetched;         /* GetServices reply fetched asynchronously */
+
+  ConnmanShmWriter *shm;        /* state export for other processes, optional */
+  ConnmanChangelog *changelog;  /* replication stream, optional */
+
+  /* daemon restart detection */
+  guint name_watch_id;
+  gchar *name_owner;            /* unique name of the current net.connman */
+  gboolean owner_lost;
+
+  ConnmanAgent *agent;          /* registered with ConnMan, re-registered on restart */
+  ConnmanCounter *counter;      /* likewise */
+  guint counter_accuracy;
+  guint counter_period;
+  GSList *sessions;             /* ConnmanSession, recreated on restart */
+
+  /* scan scheduling */
+  GHashTable *scans;            /* technology type -> ScanState */
+  guint scan_fast;              /* s, 0 disables periodic scans */
+  guint scan_slow;
+  guint scans_issued;
+  guint scans_coalesced;
 };
 
+/* an asynchronous call in flight, for the latency histograms */
+typedef struct {
+  ConnmanManager *manager;
+  ConnmanSession *session;      /* session being recreated, or NULL */
+  gint64 start;
+} PendingCall;
+
 static GObjectClass *parent_class = NULL;
 
 enum {
+  SIGNAL_SERVICES_UPDATED,
   SIGNAL_LAST
 };
 
@@ -70,97 +207,315 @@ connman_manager_set_property (GObject      *object,
 
 static void
 manager_state_changed(ConnmanProxyManager *proxy,
+                      const gchar         *state,
                       ConnmanManager      *manager)
 {
+  if (manager->changelog)
+    {
+      connman_changelog_state_changed(manager->changelog, state);
+      connman_changelog_flush(manager->changelog);
+    }
 }
 
-static GVariant *connman_manager_get_properties(ConnmanManager *manager)
+static GVariant *connman_manager_get_properties(ConnmanManager *manager,
+                                                GError **error)
 {
-  GError *error = NULL;
-  GVariant *ret;
+  GError *local_error = NULL;
+  GVariant *ret = NULL;
+  guint attempt = 0;
+  gint64 start;
 
-  connman_proxy_manager_call_get_properties_sync(manager->proxy,
-                                                 &ret, NULL, &error);
-  if (error)
+  do
     {
-      g_error("%s", error->message);
-      g_error_free(error);
+      start = connman_stats_begin();
+      connman_proxy_manager_call_get_properties_sync(manager->proxy,
+                                                     &ret, NULL, &local_error);
+      connman_stats_end(CONNMAN_STATS_MANAGER_GET_PROPERTIES, start, local_error != NULL);
+    }
+  while (connman_error_retry(&local_error, &attempt));
+
+  if (local_error)
+    {
+      g_propagate_error(error, local_error);
       return NULL;
     }
 
   return ret;
 }
 
-static gboolean service_in_list(ConnmanManager *manager,
-                                GVariant       *child)
+static ConnmanService *find_service(ConnmanManager *manager,
+                                    const gchar *path)
+{
+  return g_hash_table_lookup(manager->by_path, path);
+}
+
+/* the service identifier ConnMan uses as the last path element */
+static const gchar *path_identifier(const gchar *path)
+{
+  const gchar *slash = strrchr(path, '/');
+
+  return slash ? slash + 1 : path;
+}
+
+static void index_remove_name(ConnmanManager *manager,
+                              ConnmanService *service)
+{
+  const gchar *name = g_hash_table_lookup(manager->indexed_names, service);
+  GSList *list;
+
+  if (!name)
+    return;
+
+  list = g_hash_table_lookup(manager->by_name, name);
+  list = g_slist_remove(list, service);
+
+  if (list)
+    g_hash_table_insert(manager->by_name, g_strdup(name), list);
+  else
+    g_hash_table_remove(manager->by_name, name);
+
+  g_hash_table_remove(manager->indexed_names, service);
+}
+
+static void index_add_name(ConnmanManager *manager,
+                           ConnmanService *service)
+{
+  const gchar *name = connman_service_get_name(service);
+  GSList *list;
+
+  /* hidden networks have no name to look up */
+  if (!name || !*name)
+    return;
+
+  list = g_hash_table_lookup(manager->by_name, name);
+  g_hash_table_insert(manager->by_name, g_strdup(name),
+                      g_slist_prepend(list, service));
+  g_hash_table_insert(manager->indexed_names, service, g_strdup(name));
+}
+
+static void index_add(ConnmanManager *manager,
+                      ConnmanService *service)
+{
+  const gchar *path = connman_service_get_object_path(service);
+
+  g_hash_table_insert(manager->by_path, g_strdup(path), service);
+  g_hash_table_insert(manager->by_identifier, g_strdup(path_identifier(path)), service);
+  index_add_name(manager, service);
+}
+
+static void index_remove(ConnmanManager *manager,
+                         ConnmanService *service)
+{
+  const gchar *path = connman_service_get_object_path(service);
+
+  g_hash_table_remove(manager->by_path, path);
+  g_hash_table_remove(manager->by_identifier, path_identifier(path));
+  index_remove_name(manager, service);
+}
+
+/* the service was renamed, file it under the new name */
+static void index_rename(ConnmanManager *manager,
+                         ConnmanService *service)
+{
+  index_remove_name(manager, service);
+  index_add_name(manager, service);
+}
+
+static void mark_pending(ConnmanManager *manager,
+                         ConnmanService *service,
+                         guint fields)
+{
+  guint old = GPOINTER_TO_UINT(g_hash_table_lookup(manager->pending, service));
+
+  g_hash_table_insert(manager->pending, service, GUINT_TO_POINTER(old | fields));
+}
+
+/* favorites and services on their way up are never evicted */
+static gboolean service_is_protected(ConnmanService *service)
+{
+  guint state = connman_service_get_state(service);
+
+  return connman_service_passphrase_is_favorite(service) ||
+         (state >= CONNMAN_SERVICE_STATE_ASSOCIATION &&
+          state <= CONNMAN_SERVICE_STATE_ONLINE);
+}
+
+static gboolean state_is_protected(const gchar *state)
+{
+  return g_strcmp0(state, "association") == 0 ||
+         g_strcmp0(state, "configuration") == 0 ||
+         g_strcmp0(state, "ready") == 0 ||
+         g_strcmp0(state, "online") == 0;
+}
+
+/*
+ * Strength a suppressed service must exceed to be tracked again, or
+ * -1 if there is room for everything.
+ */
+static gint readmit_threshold(ConnmanManager *manager)
 {
   GSList *iter;
-  GVariant *o = g_variant_get_child_value(child, 0);
-  const gchar *path = g_variant_get_string(o, NULL);
+  gint weakest = -1;
+
+  if (g_slist_length(manager->services) < manager->max_services)
+    return -1;
 
   for (iter = manager->services; iter; iter = iter->next)
     {
       ConnmanService *service = CONNMAN_SERVICE(iter->data);
+      gint strength = connman_service_get_strength(service);
 
-      if (connman_service_has_object_path(service, path))
-        return TRUE;
+      if (!service_is_protected(service) && (weakest < 0 || strength < weakest))
+        weakest = strength;
     }
 
-  return FALSE;
+  return weakest < 0 ? G_MAXINT : weakest + READMIT_HYSTERESIS;
 }
 
-gboolean connman_manager_update_services(ConnmanManager *manager)
+static gboolean should_readmit(GVariant *attrs,
+                               gint threshold)
 {
-  GError *error = NULL;
-  GVariant *services;
-  GSList *iter, *remove_list = NULL;
-  gsize i;
+  const gchar *state = NULL;
+  gboolean favorite = FALSE;
+  guchar strength = 0;
 
-  connman_proxy_manager_call_get_services_sync(manager->proxy,
-                                               &services, NULL, &error);
-  if (error)
+  g_variant_lookup(attrs, "Favorite", "b", &favorite);
+  g_variant_lookup(attrs, "State", "&s", &state);
+  g_variant_lookup(attrs, "Strength", "y", &strength);
+
+  return favorite || state_is_protected(state) || (gint) strength > threshold;
+}
+
+/*
+ * Drop the weakest, least recently seen unprotected services until
+ * the list fits manager->max_services again. Protected services may
+ * keep the list above the limit.
+ */
+static void evict_services(ConnmanManager *manager,
+                           ConnmanManagerChanges *changes)
+{
+  GSList *candidates = NULL, *iter;
+  guint n = g_slist_length(manager->services);
+
+  if (!manager->max_services || n <= manager->max_services)
+    return;
+
+  for (iter = manager->services; iter; iter = iter->next)
+    if (!service_is_protected(iter->data))
+      candidates = g_slist_prepend(candidates, iter->data);
+
+  candidates = g_slist_sort(candidates, connman_service_compare_eviction);
+
+  for (iter = candidates; iter && n > manager->max_services; iter = iter->next, n--)
     {
-      g_error("%s", error->message);
-      g_error_free(error);
-      return FALSE;
+      ConnmanService *service = CONNMAN_SERVICE(iter->data);
+
+      manager->services = g_slist_remove(manager->services, service);
+      g_hash_table_remove(manager->pending, service);
+      index_remove(manager, service);
+      g_hash_table_insert(manager->evicted,
+                          g_strdup(connman_service_get_object_path(service)),
+                          GINT_TO_POINTER(TRUE));
+      manager->evictions++;
+
+      /* consumers never saw a service that is evicted in its first batch */
+      if (g_slist_find(changes->added, service))
+        {
+          changes->added = g_slist_remove(changes->added, service);
+          g_object_unref(service);
+        }
+      else
+        {
+          changes->removed = g_slist_prepend(changes->removed, service);
+        }
     }
 
-  /* look for added services */
+  g_slist_free(candidates);
+}
+
+/*
+ * Reconcile manager->services with a service list in GetServices form.
+ * Added and removed services are recorded in @changes, field
+ * modifications of existing services are folded into manager->pending.
+ */
+static void reconcile_services(ConnmanManager *manager,
+                               GVariant *services,
+                               ConnmanManagerChanges *changes)
+{
+  GHashTable *seen, *still_evicted;
+  GSList *iter, *remove_list = NULL;
+  gint64 now = g_get_monotonic_time();
+  guint n_added = 0, n_removed = 0, evictions = manager->evictions;
+  gint threshold = -1;
+  gsize i;
+
+  CONNMAN_TRACE1(reconcile_start, g_variant_n_children(services));
+
+  seen = g_hash_table_new(g_direct_hash, g_direct_equal);
+  still_evicted = g_hash_table_new_full(g_str_hash, g_str_equal, g_free, NULL);
+
+  if (manager->max_services)
+    threshold = readmit_threshold(manager);
+
+  /* look for added and modified services */
   for (i = 0; i < g_variant_n_children(services); i++)
     {
       GVariant *child = g_variant_get_child_value(services, i);
+      GVariant *attrs;
+      const gchar *path;
+      ConnmanService *service;
+      guchar strength;
+
+      g_variant_get(child, "(&o@a{sv})", &path, &attrs);
+      service = find_service(manager, path);
+
+      if (service)
+        {
+          guint fields = connman_service_update(service, attrs);
 
-      if (!service_in_list(manager, child))
+          if (fields)
+            mark_pending(manager, service, fields);
+          if (fields & CONNMAN_SERVICE_FIELD_NAME)
+            index_rename(manager, service);
+        }
+      else if (g_hash_table_lookup(manager->evicted, path) &&
+               !should_readmit(attrs, threshold))
+        {
+          /* still not interesting enough to track */
+          g_hash_table_insert(still_evicted, g_strdup(path), GINT_TO_POINTER(TRUE));
+          g_variant_unref(attrs);
+          g_variant_unref(child);
+          continue;
+        }
+      else
         {
-          ConnmanService *service;
+          GSList *f;
 
           service = connman_service_new(child);
+          for (f = manager->filters; f; f = f->next)
+            connman_service_add_filter(service, f->data);
+
           manager->services = g_slist_append(manager->services, service);
+          index_add(manager, service);
+          changes->added = g_slist_append(changes->added, service);
+          n_added++;
         }
+
+      /* out of range services are listed without a strength */
+      if (g_variant_lookup(attrs, "Strength", "y", &strength))
+        connman_service_set_last_seen(service, now);
+
+      g_hash_table_insert(seen, service, service);
+      g_variant_unref(attrs);
+      g_variant_unref(child);
     }
 
   /* look for removed services */
   for (iter = manager->services; iter; iter = iter->next)
-    {
-      ConnmanService *service = CONNMAN_SERVICE(iter->data);
-      gboolean found = FALSE;
-
-      for (i = 0; i < g_variant_n_children(services); i++)
-        {
-          GVariant *child = g_variant_get_child_value(services, i);
-          GVariant *o = g_variant_get_child_value(child, 0);
-          const gchar *path = g_variant_get_string(o, NULL);
-
-          if (connman_service_has_object_path(service, path))
-            {
-              found = TRUE;
-              break;
-            }
-        }
+    if (!g_hash_table_lookup(seen, iter->data))
+      remove_list = g_slist_append(remove_list, iter->data);
 
-      if (!found)
-        remove_list = g_slist_append(remove_list, service);
-    }
+  g_hash_table_destroy(seen);
 
   /* 
    * do the actual remove of services in an extra loop, so we don't
@@ -170,241 +525,2499 @@ gboolean connman_manager_update_services(ConnmanManager *manager)
     {
       ConnmanService *service = CONNMAN_SERVICE(iter->data);
       manager->services = g_slist_remove(manager->services, service);
-      g_object_unref(G_OBJECT(service));
+      g_hash_table_remove(manager->pending, service);
+      index_remove(manager, service);
+      n_removed++;
+
+      /* ConnMan dropped the service, its usage row can go as well */
+      if (manager->counter)
+        connman_counter_forget(manager->counter,
+                               connman_service_get_object_path(service));
     }
 
-  return TRUE;
+  /* the removed services are unreffed once the change set was delivered */
+  changes->removed = g_slist_concat(changes->removed, remove_list);
+
+  /*
+   * forget suppressed services ConnMan no longer lists, so the set
+   * never holds more than the current listing
+   */
+  g_hash_table_destroy(manager->evicted);
+  manager->evicted = still_evicted;
+
+  evict_services(manager, changes);
+  n_removed += manager->evictions - evictions;
+
+  /* counted along the way, the change lists may span several reconciles */
+  CONNMAN_TRACE2(reconcile_end, n_added, n_removed);
 }
 
-gboolean connman_manager_update_technologies (ConnmanManager *manager)
+static ConnmanTechnology *find_technology(ConnmanManager *manager,
+                                          const gchar *path)
 {
-  GVariant *props = connman_manager_get_properties(manager);
-  gsize i;
-  
-  for (i = 0; i < g_variant_n_children(props); i++)
+  GSList *iter;
+
+  for (iter = manager->technologies; iter; iter = iter->next)
     {
-      GVariant *prop = g_variant_get_child_value(props, i);
-      GVariant *key_v = g_variant_get_child_value(prop, 0);
-      const gchar *key = g_variant_get_string(key_v, NULL);
+      ConnmanTechnology *technology = CONNMAN_TECHNOLOGY(iter->data);
 
-      if (g_str_equal(key, "Technologies"))
-        {
-          GVariant *v = g_variant_get_child_value(prop, 1);
-          GVariant *array = g_variant_get_variant(v);
-          gsize j;
-
-          for (j = 0; j <  g_variant_n_children(array); j++)
-            {
-              GVariant *item = g_variant_get_child_value(array, j);
-              const gchar *path = g_variant_get_string(item, NULL);
-              ConnmanTechnology *technology;
-             
-              technology = connman_technology_new(manager->bus_type, path);
-              manager->technologies = g_slist_append(manager->technologies,
-                                                     technology);
-            }
-        }
+      if (g_strcmp0(connman_technology_get_object_path(technology), path) == 0)
+        return technology;
     }
 
-  return TRUE;
+  return NULL;
 }
 
-gboolean connman_manager_is_online (ConnmanManager *manager)
+/*
+ * Reconcile manager->technologies with a list of object paths. Known
+ * technologies are kept along with their proxies, which follow the
+ * daemon across restarts.
+ */
+static void reconcile_technologies(ConnmanManager *manager,
+                                   GVariant *paths)
 {
-  GVariant *props = connman_manager_get_properties(manager);
+  GSList *keep = NULL;
   gsize i;
-  
-  for (i = 0; i < g_variant_n_children(props); i++)
-    {
-      GVariant *prop = g_variant_get_child_value(props, i);
-      GVariant *key_v = g_variant_get_child_value(prop, 0);
-      const gchar *key = g_variant_get_string(key_v, NULL);
 
-      if (g_str_equal(key, "OfflineMode"))
+  for (i = 0; i < g_variant_n_children(paths); i++)
+    {
+      GVariant *item = g_variant_get_child_value(paths, i);
+      const gchar *path = g_variant_get_string(item, NULL);
+      ConnmanTechnology *technology = find_technology(manager, path);
+      GError *error = NULL;
+      const gchar *type;
+      ScanState *scan;
+
+      if (technology)
         {
-          GVariant *v = g_variant_get_child_value(prop, 1);
-          GVariant *va = g_variant_get_variant(v);
-          gboolean offline = g_variant_get_boolean(va);
+          manager->technologies = g_slist_remove(manager->technologies, technology);
+          keep = g_slist_append(keep, technology);
+          g_variant_unref(item);
+          continue;
+        }
 
-          return !offline;
+      technology = connman_technology_new(manager->bus_type, path, &error);
+      if (!technology)
+        {
+          /* skip it, the rest of the list is still useful */
+          g_warning("Unable to add technology %s: %s", path, error->message);
+          g_error_free(error);
+          g_variant_unref(item);
+          continue;
         }
-    }
 
-  return FALSE;
-}
+      keep = g_slist_append(keep, technology);
 
-static void
-service_connect_callback (GObject *source_object,
-                          GAsyncResult *res,
-                          gpointer user_data)
-{
-  ConnmanManager *manager = CONNMAN_MANAGER(user_data);
-  GError *error = NULL;
-  gchar *ret;
+      /* a technology that comes back may have gained scan support */
+      type = connman_technology_get_name(technology);
+      scan = type ? g_hash_table_lookup(manager->scans, type) : NULL;
+      if (scan)
+        scan->unsupported = FALSE;
 
-  connman_proxy_manager_call_connect_service_finish(manager->proxy,
-                                                    &ret, res, &error);
-  if (error)
-    {
-      g_critical("Unable to connect to service: %s", error->message);
-      g_error_free(error);
+      if (manager->changelog)
+        connman_changelog_technology_changed(manager->changelog, path,
+                                             connman_technology_get_name(technology));
+
+      g_variant_unref(item);
     }
-  else
+
+  /* whatever is left has disappeared */
+  if (manager->changelog)
     {
-      g_message("%s(): connected to %s", __func__, ret);
+      GSList *iter;
+
+      for (iter = manager->technologies; iter; iter = iter->next)
+        connman_changelog_technology_removed(manager->changelog,
+                                             connman_technology_get_object_path(iter->data));
     }
+
+  g_slist_foreach(manager->technologies, (GFunc) g_object_unref, NULL);
+  g_slist_free(manager->technologies);
+  manager->technologies = keep;
 }
 
-gboolean connman_manager_connect_service (ConnmanManager *manager,
-                                          ConnmanService *service,
-                                          const gchar *secret)
+/*
+ * Fetch the manager properties and update the technology list and the
+ * online state from them.
+ */
+static gboolean refresh_properties(ConnmanManager *manager,
+                                   GError **error)
 {
-  GVariantBuilder *builder;
-  GError *error = NULL;
-  GVariant *variant;
-  const gchar *ssid = connman_service_get_name(service);
+  GVariant *props = connman_manager_get_properties(manager, error);
+  GVariantIter iter;
+  const gchar *key;
+  GVariant *val;
 
-  g_message("Connecting to service '%s'", connman_service_get_name(service));
+  if (!props)
+    return FALSE;
 
-  if (!connman_service_type_wifi(service))
+  g_variant_iter_init(&iter, props);
+  while (g_variant_iter_next(&iter, "{&sv}", &key, &val))
     {
-      g_critical("Service is not a Wifi service");
-      return FALSE;
+      if (g_str_equal(key, "Technologies"))
+        reconcile_technologies(manager, val);
+      else if (g_str_equal(key, "OfflineMode"))
+        manager->online = !g_variant_get_boolean(val);
+
+      g_variant_unref(val);
     }
 
-  builder = g_variant_builder_new(G_VARIANT_TYPE_ARRAY);
+  g_variant_unref(props);
+
+  return TRUE;
+}
 
-  g_variant_builder_add(builder, "{sv}", "Type", g_variant_new_string("wifi"));
-  g_variant_builder_add(builder, "{sv}", "Mode", g_variant_new_string("managed"));
-  g_variant_builder_add(builder, "{sv}", "SSID", g_variant_new_string(ssid));
+/*
+ * Fetch the service list, unless a reply is already at hand, and
+ * reconcile it with manager->services.
+ */
+static gboolean refresh_services(ConnmanManager *manager,
+                                 ConnmanManagerChanges *changes,
+                                 GError **error)
+{
+  GError *local_error = NULL;
+  GVariant *services = NULL;
 
-  if (secret)
+  if (manager->prefetched)
     {
-      g_variant_builder_add(builder, "{sv}", "Security", g_variant_new_string("rsn"));
-      g_variant_builder_add(builder, "{sv}", "Passphrase", g_variant_new_string(secret));
+      services = manager->prefetched;
+      manager->prefetched = NULL;
     }
   else
     {
-      g_variant_builder_add(builder, "{sv}", "Security", g_variant_new_string("none"));
+      guint attempt = 0;
+      gint64 start;
+
+      do
+        {
+          start = connman_stats_begin();
+          connman_proxy_manager_call_get_services_sync(manager->proxy,
+                                                       &services, NULL, &local_error);
+          connman_stats_end(CONNMAN_STATS_MANAGER_GET_SERVICES, start, local_error != NULL);
+        }
+      while (connman_error_retry(&local_error, &attempt));
+
+      if (local_error)
+        {
+          g_propagate_error(error, local_error);
+          return FALSE;
+        }
     }
 
-  variant = g_variant_builder_end(builder);
+  reconcile_services(manager, services, changes);
+  g_variant_unref(services);
 
-  connman_proxy_manager_call_connect_service(manager->proxy,
-                                             variant, NULL,
-                                             service_connect_callback, manager);
-  g_variant_unref(variant);
+  manager->stale = FALSE;
 
-  if (error)
-    {
-      g_error("%s", error->message);
-      g_error_free(error);
-      return FALSE;
-    }
-  
   return TRUE;
 }
 
-static ConnmanTechnology *find_wifi_technology (ConnmanManager *manager)
+static void publish_shm(ConnmanManager *manager)
 {
+  ConnmanShmHeader *header;
   GSList *iter;
+  guint n;
 
-  for (iter = manager->technologies; iter; iter = iter->next)
-    {
-      ConnmanTechnology *t = CONNMAN_TECHNOLOGY(iter->data);
+  if (!manager->shm)
+    return;
 
-      if (g_str_equal("wifi", connman_technology_get_name(t)))
-        return t;
-    }
+  header = connman_shm_writer_begin(manager->shm);
 
-  return NULL;
-}
+  header->online = manager->online;
 
-gboolean connman_manager_enable_tethering (ConnmanManager *manager,
-                                           const gchar *bssid,
-                                           const gchar *secret)
-{
-  ConnmanTechnology *wifi = find_wifi_technology(manager);
+  for (iter = manager->technologies, n = 0;
+       iter && n < CONNMAN_SHM_MAX_TECHNOLOGIES;
+       iter = iter->next, n++)
+    g_strlcpy(header->technologies[n].type,
+              connman_technology_get_name(CONNMAN_TECHNOLOGY(iter->data)),
+              CONNMAN_SHM_TYPE_LEN);
+  header->n_technologies = n;
 
-  if (!wifi)
+  for (iter = manager->services, n = 0;
+       iter && n < header->max_services;
+       iter = iter->next, n++)
     {
-      g_critical("No wifi technology, can not enable tethering");
-      return FALSE;
+      ConnmanService *service = CONNMAN_SERVICE(iter->data);
+      ConnmanShmService *rec = &header->services[n];
+      const gchar *name = connman_service_get_name(service);
+      gboolean auto_connect;
+      gint type;
+
+      g_object_get(service, "type", &type, "auto-connect", &auto_connect, NULL);
+
+      g_strlcpy(rec->object_path, connman_service_get_object_path(service),
+                CONNMAN_SHM_PATH_LEN);
+      g_strlcpy(rec->name, name ? name : "", CONNMAN_SHM_SSID_LEN);
+      rec->type = type;
+      rec->state = connman_service_get_state(service);
+      rec->strength = connman_service_get_strength(service);
+      rec->generation = connman_service_get_generation(service);
+      rec->flags = 0;
+
+      if (connman_service_passphrase_is_favorite(service))
+        rec->flags |= CONNMAN_SHM_SERVICE_FAVORITE;
+      if (auto_connect)
+        rec->flags |= CONNMAN_SHM_SERVICE_AUTO_CONNECT;
+      if (connman_service_passphrase_is_immutable(service))
+        rec->flags |= CONNMAN_SHM_SERVICE_IMMUTABLE;
+      if (connman_service_login_required(service))
+        rec->flags |= CONNMAN_SHM_SERVICE_LOGIN_REQUIRED;
+      if (connman_service_passphrase_required(service))
+        rec->flags |= CONNMAN_SHM_SERVICE_PASSPHRASE_REQUIRED;
     }
+  header->n_services = n;
 
-  return connman_technology_enable_tethering(wifi, bssid, secret);
+  connman_shm_writer_commit(manager->shm);
 }
 
-gboolean connman_manager_disable_tethering (ConnmanManager *manager)
+static void log_changes(ConnmanManager *manager,
+                        ConnmanManagerChanges *changes)
 {
-  ConnmanTechnology *wifi = find_wifi_technology(manager);
+  GSList *iter;
 
-  if (!wifi)
+  if (!manager->changelog)
+    return;
+
+  for (iter = changes->added; iter; iter = iter->next)
+    connman_changelog_service_added(manager->changelog, iter->data);
+
+  for (iter = changes->removed; iter; iter = iter->next)
+    connman_changelog_service_removed(manager->changelog, iter->data);
+
+  for (iter = changes->modified; iter; iter = iter->next)
     {
-      g_critical("No wifi technology, can not disable tethering");
-      return FALSE;
+      ConnmanServiceChange *change = iter->data;
+
+      connman_changelog_service_changed(manager->changelog,
+                                        change->service, change->fields);
     }
 
-  return connman_technology_disable_tethering(wifi);
+  connman_changelog_flush(manager->changelog);
 }
 
-GSList *connman_manager_get_services (ConnmanManager *manager)
+static void scan_sync(ConnmanManager *manager);
+
+/*
+ * Deliver everything that accumulated since the last flush as one
+ * "services-updated" emission.
+ */
+static gboolean flush_changes(ConnmanManager *manager,
+                              GError **error)
 {
-  g_return_val_if_fail(CONNMAN_IS_MANAGER(manager), NULL);
+  ConnmanManagerChanges changes = { NULL, NULL, NULL };
+  GHashTableIter hiter;
+  gpointer key, value;
+  gboolean ret = TRUE;
 
-  return manager->services;
-}
+  if (manager->coalesce_source)
+    {
+      g_source_destroy(manager->coalesce_source);
+      g_source_unref(manager->coalesce_source);
+      manager->coalesce_source = NULL;
+    }
 
-ConnmanManager *connman_manager_new (GBusType bus_type)
-{
-  GError *error = NULL;
-  ConnmanManager *manager = g_object_new(CONNMAN_TYPE_MANAGER, NULL);
+  if (manager->properties_dirty)
+    {
+      if (!refresh_properties(manager, error))
+        return FALSE;
 
-  manager->services = NULL;
-  manager->technologies = NULL;
-  manager->bus_type = bus_type;
+      manager->properties_dirty = FALSE;
+      scan_sync(manager);
+    }
 
-  manager->proxy = connman_proxy_manager_proxy_new_for_bus_sync(bus_type,
-                                                                G_DBUS_PROXY_FLAGS_NONE,
-                                                                "net.connman", "/",
-                                                                NULL, /* cancelable */
-                                                                &error);
-  if (error)
+  if (manager->services_dirty)
     {
-      g_error("%s", error->message);
-      g_error_free(error);
-      return NULL;
+      /* stays dirty on failure, the cached list is kept meanwhile */
+      ret = refresh_services(manager, &changes, error);
+      manager->services_dirty = !ret;
     }
 
-  g_signal_connect(G_OBJECT(manager->proxy), "state-changed",
-                   G_CALLBACK(manager_state_changed), manager);
+  g_hash_table_iter_init(&hiter, manager->pending);
+  while (g_hash_table_iter_next(&hiter, &key, &value))
+    {
+      ConnmanServiceChange *change;
 
-  connman_manager_update_technologies(manager);
-  connman_manager_update_services(manager);
+      /* a freshly added service is reported as a whole */
+      if (g_slist_find(changes.added, key))
+        continue;
 
-  g_message("%d services", g_slist_length(manager->services));
+      change = g_slice_new(ConnmanServiceChange);
+      connman_stats_object_new(CONNMAN_STATS_OBJECT_CHANGE, sizeof(ConnmanServiceChange));
+      change->service = CONNMAN_SERVICE(key);
+      change->fields = GPOINTER_TO_UINT(value);
+      changes.modified = g_slist_prepend(changes.modified, change);
+    }
 
-  return manager;
-}
+  g_hash_table_remove_all(manager->pending);
 
-static void
-connman_manager_init (ConnmanManager *manager)
-{
-}
+  if (changes.added || changes.removed || changes.modified)
+    {
+      manager->snapshot_dirty = TRUE;
+      publish_shm(manager);
+      log_changes(manager, &changes);
+      g_signal_emit(manager, signals[SIGNAL_SERVICES_UPDATED], 0, &changes);
+    }
 
-static void
-connman_manager_finalize (GObject *object)
-{
+  for (; changes.modified; changes.modified = g_slist_delete_link(changes.modified, changes.modified))
+    {
+      g_slice_free(ConnmanServiceChange, changes.modified->data);
+      connman_stats_object_free(CONNMAN_STATS_OBJECT_CHANGE, sizeof(ConnmanServiceChange));
+    }
+
+  g_slist_free(changes.added);
+  g_slist_foreach(changes.removed, (GFunc) g_object_unref, NULL);
+  g_slist_free(changes.removed);
+
+  return ret;
+}
+
+static gboolean coalesce_timeout(gpointer user_data);
+
+/* try a failed refresh again later, backing off exponentially */
+static void schedule_retry(ConnmanManager *manager,
+                           const GError *error)
+{
+  guint delay = connman_error_backoff_delay(manager->retry_attempt++);
+
+  g_warning("Unable to refresh services, retrying in %u ms: %s",
+            delay, error->message);
+
+  if (manager->coalesce_source)
+    {
+      g_source_destroy(manager->coalesce_source);
+      g_source_unref(manager->coalesce_source);
+    }
+
+  manager->coalesce_source = g_timeout_source_new(delay);
+  g_source_set_callback(manager->coalesce_source, coalesce_timeout, manager, NULL);
+  g_source_attach(manager->coalesce_source, manager->context);
+}
+
+static gboolean coalesce_timeout(gpointer user_data)
+{
+  ConnmanManager *manager = CONNMAN_MANAGER(user_data);
+  GError *error = NULL;
+
+  if (flush_changes(manager, &error))
+    {
+      manager->retry_attempt = 0;
+      return FALSE;
+    }
+
+  schedule_retry(manager, error);
+  g_error_free(error);
+
+  return FALSE;
+}
+
+static void schedule_flush(ConnmanManager *manager)
+{
+  if (manager->coalesce_source)
+    return;
+
+  if (manager->coalesce_interval)
+    manager->coalesce_source = g_timeout_source_new(manager->coalesce_interval);
+  else
+    manager->coalesce_source = g_idle_source_new();
+
+  g_source_set_callback(manager->coalesce_source, coalesce_timeout, manager, NULL);
+  g_source_attach(manager->coalesce_source, manager->context);
+}
+
+static const gchar *service_type_name(ConnmanService *service)
+{
+  if (connman_service_type_wifi(service))
+    return "wifi";
+  if (connman_service_type_ethernet(service))
+    return "ethernet";
+
+  return NULL;
+}
+
+/*
+ * Scan at the fast interval unless a service of the technology is
+ * connected with a good signal.
+ */
+static gboolean scan_needs_fast(ConnmanManager *manager,
+                                const gchar *type)
+{
+  GSList *iter;
+
+  for (iter = manager->services; iter; iter = iter->next)
+    {
+      ConnmanService *service = CONNMAN_SERVICE(iter->data);
+      guint state = connman_service_get_state(service);
+
+      if (g_strcmp0(service_type_name(service), type) != 0 ||
+          (state != CONNMAN_SERVICE_STATE_READY && state != CONNMAN_SERVICE_STATE_ONLINE))
+        continue;
+
+      if (!connman_service_type_wifi(service) ||
+          connman_service_get_strength(service) >= SCAN_WEAK_STRENGTH)
+        return FALSE;
+    }
+
+  return TRUE;
+}
+
+static void scan_issue(ScanState *scan);
+
+static gboolean scan_timeout(gpointer user_data)
+{
+  ScanState *scan = user_data;
+
+  g_source_unref(scan->timer);
+  scan->timer = NULL;
+
+  scan_issue(scan);
+
+  return FALSE;
+}
+
+/* arm the next periodic scan, backing off while the connection is good */
+static void scan_reschedule(ScanState *scan)
+{
+  ConnmanManager *manager = scan->manager;
+
+  if (scan->timer)
+    {
+      g_source_destroy(scan->timer);
+      g_source_unref(scan->timer);
+      scan->timer = NULL;
+    }
+
+  if (!manager->scan_fast || scan->unsupported || scan->in_flight)
+    return;
+
+  if (scan_needs_fast(manager, scan->type) || !scan->interval)
+    scan->interval = manager->scan_fast;
+  else
+    scan->interval = MIN(scan->interval * 2, MAX(manager->scan_slow, manager->scan_fast));
+
+  scan->timer = g_timeout_source_new_seconds(scan->interval);
+  g_source_set_callback(scan->timer, scan_timeout, scan, NULL);
+  g_source_attach(scan->timer, manager->context);
+}
+
+static void
+scan_callback(GObject *source_object,
+              GAsyncResult *res,
+              gpointer user_data)
+{
+  ScanState *scan = user_data;
+  ConnmanManager *manager = scan->manager;
+  GError *error = NULL;
+
+  connman_proxy_manager_call_request_scan_finish(manager->proxy, res, &error);
+  connman_stats_end(CONNMAN_STATS_MANAGER_REQUEST_SCAN, scan->start, error != NULL);
+
+  scan->in_flight = FALSE;
+  scan->last_scan = g_get_monotonic_time();
+
+  if (error)
+    {
+      gchar *name = g_dbus_error_get_remote_error(error);
+
+      if (g_strcmp0(name, "net.connman.Error.NotSupported") == 0)
+        scan->unsupported = TRUE;
+
+      connman_debug(NULL, "%s scan failed: %s", scan->type, error->message);
+      g_free(name);
+      g_error_free(error);
+    }
+  else
+    {
+      /* all scans landing within the coalesce interval share one refresh */
+      manager->services_dirty = TRUE;
+      schedule_flush(manager);
+    }
+
+  scan_reschedule(scan);
+  g_object_unref(manager);
+}
+
+static void scan_issue(ScanState *scan)
+{
+  ConnmanManager *manager = scan->manager;
+
+  if (scan->in_flight || scan->unsupported)
+    return;
+
+  if (scan->timer)
+    {
+      g_source_destroy(scan->timer);
+      g_source_unref(scan->timer);
+      scan->timer = NULL;
+    }
+
+  scan->in_flight = TRUE;
+  scan->start = connman_stats_begin();
+  manager->scans_issued++;
+
+  connman_debug(NULL, "scanning %s", scan->type);
+  g_object_ref(manager);
+  connman_proxy_manager_call_request_scan(manager->proxy, scan->type, NULL,
+                                          scan_callback, scan);
+}
+
+static void scan_state_free(ScanState *scan)
+{
+  if (scan->timer)
+    {
+      g_source_destroy(scan->timer);
+      g_source_unref(scan->timer);
+    }
+
+  g_free(scan->type);
+  g_slice_free(ScanState, scan);
+}
+
+static ScanState *scan_state_get(ConnmanManager *manager,
+                                 const gchar *type)
+{
+  ScanState *scan = g_hash_table_lookup(manager->scans, type);
+
+  if (scan)
+    return scan;
+
+  scan = g_slice_new0(ScanState);
+  scan->manager = manager;
+  scan->type = g_strdup(type);
+  g_hash_table_insert(manager->scans, scan->type, scan);
+
+  return scan;
+}
+
+/* give every current technology a periodic scan */
+static void scan_sync(ConnmanManager *manager)
+{
+  GSList *iter;
+
+  if (!manager->scan_fast)
+    return;
+
+  for (iter = manager->technologies; iter; iter = iter->next)
+    {
+      const gchar *type = connman_technology_get_name(iter->data);
+      ScanState *scan;
+
+      if (!type)
+        continue;
+
+      scan = scan_state_get(manager, type);
+      if (!scan->timer && !scan->in_flight)
+        scan_reschedule(scan);
+    }
+}
+
+/* a connection of this type dropped or weakened, scan fast again */
+static void scan_service_changed(ConnmanManager *manager,
+                                 ConnmanService *service)
+{
+  const gchar *type = service_type_name(service);
+  ScanState *scan;
+
+  if (!manager->scan_fast || !type)
+    return;
+
+  scan = g_hash_table_lookup(manager->scans, type);
+  if (scan && scan->timer && scan->interval > manager->scan_fast &&
+      scan_needs_fast(manager, type))
+    scan_reschedule(scan);
+}
+
+static void
+manager_property_changed(ConnmanProxyManager *proxy,
+                         const gchar         *name,
+                         GVariant            *value,
+                         ConnmanManager      *manager)
+{
+  CONNMAN_TRACE1(manager_property_changed, name);
+
+  if (g_str_equal(name, "Services"))
+    {
+      manager->services_dirty = TRUE;
+      schedule_flush(manager);
+    }
+  else if (g_str_equal(name, "OfflineMode"))
+    {
+      GVariant *v = g_variant_get_variant(value);
+
+      manager->online = !g_variant_get_boolean(v);
+      manager->snapshot_dirty = TRUE;
+      publish_shm(manager);
+      g_variant_unref(v);
+
+      if (manager->changelog)
+        {
+          connman_changelog_manager_state(manager->changelog, manager->online);
+          connman_changelog_flush(manager->changelog);
+        }
+    }
+}
+
+static void
+service_property_changed(GDBusConnection *connection,
+                         const gchar     *sender_name,
+                         const gchar     *object_path,
+                         const gchar     *interface_name,
+                         const gchar     *signal_name,
+                         GVariant        *parameters,
+                         gpointer         user_data)
+{
+  ConnmanManager *manager = CONNMAN_MANAGER(user_data);
+  ConnmanService *service = find_service(manager, object_path);
+  const gchar *key;
+  GVariant *value;
+  guint fields;
+
+  CONNMAN_TRACE2(service_property_changed, object_path, service);
+
+  if (!service && g_hash_table_lookup(manager->evicted, object_path))
+    {
+      gboolean readmit = FALSE;
+
+      /* suppressed, unless it just became a favorite or connects */
+      g_variant_get(parameters, "(&sv)", &key, &value);
+      if (g_str_equal(key, "Favorite"))
+        readmit = g_variant_get_boolean(value);
+      else if (g_str_equal(key, "State"))
+        readmit = state_is_protected(g_variant_get_string(value, NULL));
+      g_variant_unref(value);
+
+      if (!readmit)
+        return;
+
+      g_hash_table_remove(manager->evicted, object_path);
+    }
+
+  if (!service)
+    {
+      /* not known yet, pick it up with the next refresh */
+      manager->services_dirty = TRUE;
+      schedule_flush(manager);
+      return;
+    }
+
+  g_variant_get(parameters, "(&sv)", &key, &value);
+  fields = connman_service_update_property(service, key, value);
+  g_variant_unref(value);
+
+  if (g_str_equal(key, "Strength"))
+    connman_service_set_last_seen(service, g_get_monotonic_time());
+
+  if (fields)
+    {
+      mark_pending(manager, service, fields);
+      schedule_flush(manager);
+    }
+
+  if (fields & CONNMAN_SERVICE_FIELD_NAME)
+    index_rename(manager, service);
+
+  if (fields & (CONNMAN_SERVICE_FIELD_STATE | CONNMAN_SERVICE_FIELD_STRENGTH))
+    scan_service_changed(manager, service);
+}
+
+static void
+connman_name_vanished(GDBusConnection *connection,
+                      const gchar     *name,
+                      gpointer         user_data)
+{
+  ConnmanManager *manager = CONNMAN_MANAGER(user_data);
+
+  if (manager->name_owner)
+    connman_message(NULL, "ConnMan disappeared from the bus");
+
+  /* keep everything, but mark it as unconfirmed until the daemon is back */
+  g_free(manager->name_owner);
+  manager->name_owner = NULL;
+  manager->owner_lost = TRUE;
+  manager->stale = TRUE;
+}
+
+static void
+recreate_session_callback(GObject *source_object,
+                          GAsyncResult *res,
+                          gpointer user_data)
+{
+  PendingCall *call = user_data;
+  ConnmanManager *manager = call->manager;
+  ConnmanSession *session = call->session;
+  GError *error = NULL;
+  gchar *path = NULL;
+
+  connman_proxy_manager_call_create_session_finish(CONNMAN_PROXY_MANAGER(source_object),
+                                                   &path, res, &error);
+  connman_stats_end(CONNMAN_STATS_MANAGER_CREATE_SESSION, call->start, error != NULL);
+  g_slice_free(PendingCall, call);
+  connman_stats_object_free(CONNMAN_STATS_OBJECT_PENDING_CALL, sizeof(PendingCall));
+
+  if (error)
+    {
+      connman_message(connman_session_get_notify_path(session),
+                      "Unable to recreate session: %s", error->message);
+      g_error_free(error);
+    }
+  else if (!g_slist_find(manager->sessions, session))
+    {
+      /* destroyed while the call was in flight, don't leave it behind */
+      connman_info(path, "session was destroyed meanwhile");
+      connman_proxy_manager_call_destroy_session(manager->proxy, path,
+                                                 NULL, NULL, NULL);
+    }
+  else if (!connman_session_attach(session, path, &error))
+    {
+      connman_message(connman_session_get_notify_path(session),
+                      "Unable to recreate session: %s", error->message);
+      g_error_free(error);
+    }
+
+  g_free(path);
+  g_object_unref(session);
+  g_object_unref(manager);
+}
+
+static void
+reregister_agent_callback(GObject *source_object,
+                          GAsyncResult *res,
+                          gpointer user_data)
+{
+  PendingCall *call = user_data;
+  ConnmanManager *manager = call->manager;
+  GError *error = NULL;
+
+  connman_proxy_manager_call_register_agent_finish(CONNMAN_PROXY_MANAGER(source_object),
+                                                   res, &error);
+  connman_stats_end(CONNMAN_STATS_MANAGER_REGISTER_AGENT, call->start, error != NULL);
+  g_slice_free(PendingCall, call);
+  connman_stats_object_free(CONNMAN_STATS_OBJECT_PENDING_CALL, sizeof(PendingCall));
+
+  if (error)
+    {
+      connman_message(NULL, "Unable to register the agent again: %s", error->message);
+      g_error_free(error);
+    }
+
+  g_object_unref(manager);
+}
+
+static void
+reregister_counter_callback(GObject *source_object,
+                            GAsyncResult *res,
+                            gpointer user_data)
+{
+  PendingCall *call = user_data;
+  ConnmanManager *manager = call->manager;
+  GError *error = NULL;
+
+  connman_proxy_manager_call_register_counter_finish(CONNMAN_PROXY_MANAGER(source_object),
+                                                     res, &error);
+  connman_stats_end(CONNMAN_STATS_MANAGER_REGISTER_COUNTER, call->start, error != NULL);
+  g_slice_free(PendingCall, call);
+  connman_stats_object_free(CONNMAN_STATS_OBJECT_PENDING_CALL, sizeof(PendingCall));
+
+  if (error)
+    {
+      connman_message(NULL, "Unable to register the counter again: %s", error->message);
+      g_error_free(error);
+    }
+
+  g_object_unref(manager);
+}
+
+/* a restarted daemon has forgotten our sessions, ask for them again */
+static void
+recreate_session(ConnmanSession *session,
+                 ConnmanManager *manager)
+{
+  PendingCall *call;
+
+  connman_session_detach(session);
+
+  call = g_slice_new0(PendingCall);
+  connman_stats_object_new(CONNMAN_STATS_OBJECT_PENDING_CALL, sizeof(PendingCall));
+  call->manager = g_object_ref(manager);
+  call->session = g_object_ref(session);
+  call->start = connman_stats_begin();
+
+  connman_proxy_manager_call_create_session(manager->proxy,
+                                            connman_session_get_requested_settings(session),
+                                            connman_session_get_notify_path(session),
+                                            NULL, recreate_session_callback,
+                                            call);
+}
+
+static void
+connman_name_appeared(GDBusConnection *connection,
+                      const gchar     *name,
+                      const gchar     *name_owner,
+                      gpointer         user_data)
+{
+  ConnmanManager *manager = CONNMAN_MANAGER(user_data);
+  GHashTableIter iter;
+  PendingCall *call;
+  gpointer value;
+  gboolean restarted;
+
+  if (g_strcmp0(manager->name_owner, name_owner) == 0)
+    return;
+
+  restarted = manager->owner_lost || manager->name_owner != NULL;
+
+  g_free(manager->name_owner);
+  manager->name_owner = g_strdup(name_owner);
+  manager->owner_lost = FALSE;
+
+  /* the initial callback for the daemon we just synced with */
+  if (!restarted && !manager->services_dirty && !manager->properties_dirty)
+    return;
+
+  connman_message(NULL, "ConnMan appeared as %s, resyncing", name_owner);
+
+  /*
+   * Services and technologies are matched by object path, so objects
+   * that survived the restart are updated in place and the whole
+   * resync is delivered as one services-updated batch.
+   */
+  manager->services_dirty = TRUE;
+  manager->properties_dirty = TRUE;
+  manager->retry_attempt = 0;
+
+  /* the new daemon may scan what the old one could not */
+  g_hash_table_iter_init(&iter, manager->scans);
+  while (g_hash_table_iter_next(&iter, NULL, &value))
+    ((ScanState *) value)->unsupported = FALSE;
+
+  /* a new daemon does not know our agent */
+  if (manager->agent)
+    {
+      call = g_slice_new0(PendingCall);
+      connman_stats_object_new(CONNMAN_STATS_OBJECT_PENDING_CALL, sizeof(PendingCall));
+      call->manager = g_object_ref(manager);
+      call->start = connman_stats_begin();
+
+      connman_proxy_manager_call_register_agent(manager->proxy,
+                                                connman_agent_get_object_path(manager->agent),
+                                                NULL, reregister_agent_callback, call);
+    }
+  if (manager->counter)
+    {
+      call = g_slice_new0(PendingCall);
+      connman_stats_object_new(CONNMAN_STATS_OBJECT_PENDING_CALL, sizeof(PendingCall));
+      call->manager = g_object_ref(manager);
+      call->start = connman_stats_begin();
+
+      connman_proxy_manager_call_register_counter(manager->proxy,
+                                                  connman_counter_get_object_path(manager->counter),
+                                                  manager->counter_accuracy,
+                                                  manager->counter_period,
+                                                  NULL, reregister_counter_callback, call);
+    }
+  g_slist_foreach(manager->sessions, (GFunc) recreate_session, manager);
+
+  if (manager->coalesce_source)
+    {
+      g_source_destroy(manager->coalesce_source);
+      g_source_unref(manager->coalesce_source);
+      manager->coalesce_source = NULL;
+    }
+
+  schedule_flush(manager);
+}
+
+gboolean connman_manager_update_services(ConnmanManager *manager,
+                                         GError **error)
+{
+  g_return_val_if_fail(CONNMAN_IS_MANAGER(manager), FALSE);
+
+  manager->services_dirty = TRUE;
+
+  return flush_changes(manager, error);
+}
+
+/*
+ * Find a tracked service by object path, service identifier or name,
+ * without asking ConnMan. Several services may share a name (one per
+ * BSS); any of them is returned then.
+ */
+ConnmanService *connman_manager_find_service(ConnmanManager *manager,
+                                             const gchar *key)
+{
+  ConnmanService *service;
+  GSList *list;
+
+  g_return_val_if_fail(CONNMAN_IS_MANAGER(manager), NULL);
+  g_return_val_if_fail(key != NULL, NULL);
+
+  service = g_hash_table_lookup(manager->by_path, key);
+  if (service)
+    return service;
+
+  service = g_hash_table_lookup(manager->by_identifier, key);
+  if (service)
+    return service;
+
+  list = g_hash_table_lookup(manager->by_name, key);
+
+  return list ? list->data : NULL;
+}
+
+/*
+ * All tracked services named @name. The list belongs to the manager
+ * and is only valid until the next services-updated emission.
+ */
+GSList *connman_manager_find_services_by_name(ConnmanManager *manager,
+                                              const gchar *name)
+{
+  g_return_val_if_fail(CONNMAN_IS_MANAGER(manager), NULL);
+  g_return_val_if_fail(name != NULL, NULL);
+
+  return g_hash_table_lookup(manager->by_name, name);
+}
+
+/*
+ * Resolve @pattern (an object path, identifier or name) to a service
+ * object path. The local index answers the common case; anything it
+ * does not know is asked from ConnMan with LookupService, and a
+ * service ConnMan knows but we do not track yet is picked up with the
+ * next refresh.
+ */
+gchar *connman_manager_lookup_service(ConnmanManager *manager,
+                                      const gchar *pattern,
+                                      GError **error)
+{
+  ConnmanService *service;
+  GError *local_error = NULL;
+  gchar *path = NULL;
+  gint64 start;
+
+  g_return_val_if_fail(CONNMAN_IS_MANAGER(manager), NULL);
+  g_return_val_if_fail(pattern != NULL, NULL);
+
+  service = connman_manager_find_service(manager, pattern);
+  if (service)
+    return g_strdup(connman_service_get_object_path(service));
+
+  start = connman_stats_begin();
+  connman_proxy_manager_call_lookup_service_sync(manager->proxy, pattern,
+                                                 &path, NULL, &local_error);
+  connman_stats_end(CONNMAN_STATS_MANAGER_LOOKUP_SERVICE, start, local_error != NULL);
+
+  if (local_error)
+    {
+      g_propagate_error(error, local_error);
+      return NULL;
+    }
+
+  if (!find_service(manager, path) && !g_hash_table_lookup(manager->evicted, path))
+    {
+      manager->services_dirty = TRUE;
+      schedule_flush(manager);
+    }
+
+  return path;
+}
+
+/* a bulk provisioning run, see connman_manager_provision_services() */
+typedef struct {
+  ConnmanManager *manager;      /* reffed until the batch is done */
+  gchar **data;                 /* serialized configs, NULL if invalid */
+  guint n_configs;
+  guint next;
+  guint in_flight;
+  guint max_in_flight;
+  guint succeeded;
+  guint failed;
+
+  ConnmanProvisionItemFunc item_func;
+  ConnmanProvisionDoneFunc done_func;
+  gpointer user_data;
+} ProvisionBatch;
+
+typedef struct {
+  ProvisionBatch *batch;
+  guint index;
+  gint64 start;
+} ProvisionItem;
+
+/*
+ * Check a configuration against what ConnMan's config file parser
+ * requires, so broken entries fail locally instead of costing a round
+ * trip each.
+ */
+static gboolean provision_validate(GKeyFile *config,
+                                   GError **error)
+{
+  gchar **groups;
+  guint i, services = 0;
+  gboolean ret = TRUE;
+
+  groups = g_key_file_get_groups(config, NULL);
+
+  for (i = 0; ret && groups[i]; i++)
+    {
+      const gchar *group = groups[i];
+      gchar *type, *security;
+
+      if (g_str_equal(group, "global"))
+        continue;
+
+      if (!g_str_has_prefix(group, "service_"))
+        {
+          g_set_error(error, G_KEY_FILE_ERROR, G_KEY_FILE_ERROR_GROUP_NOT_FOUND,
+                      "Unexpected group [%s]", group);
+          ret = FALSE;
+          break;
+        }
+
+      services++;
+
+      type = g_key_file_get_string(config, group, "Type", error);
+      if (!type)
+        {
+          ret = FALSE;
+          break;
+        }
+
+      security = g_key_file_get_string(config, group, "Security", NULL);
+
+      if (g_str_equal(type, "wifi") &&
+          !g_key_file_has_key(config, group, "Name", NULL) &&
+          !g_key_file_has_key(config, group, "SSID", NULL))
+        {
+          g_set_error(error, G_KEY_FILE_ERROR, G_KEY_FILE_ERROR_KEY_NOT_FOUND,
+                      "[%s] needs a Name or an SSID", group);
+          ret = FALSE;
+        }
+      else if (g_strcmp0(security, "psk") == 0 &&
+               !g_key_file_has_key(config, group, "Passphrase", NULL))
+        {
+          g_set_error(error, G_KEY_FILE_ERROR, G_KEY_FILE_ERROR_KEY_NOT_FOUND,
+                      "[%s] uses psk without a Passphrase", group);
+          ret = FALSE;
+        }
+      else if (g_strcmp0(security, "ieee8021x") == 0 &&
+               !g_key_file_has_key(config, group, "EAP", NULL))
+        {
+          g_set_error(error, G_KEY_FILE_ERROR, G_KEY_FILE_ERROR_KEY_NOT_FOUND,
+                      "[%s] uses ieee8021x without EAP", group);
+          ret = FALSE;
+        }
+
+      g_free(security);
+      g_free(type);
+    }
+
+  if (ret && !services)
+    {
+      g_set_error(error, G_KEY_FILE_ERROR, G_KEY_FILE_ERROR_GROUP_NOT_FOUND,
+                  "No [service_*] group");
+      ret = FALSE;
+    }
+
+  g_strfreev(groups);
+
+  return ret;
+}
+
+static void provision_report(ProvisionBatch *batch,
+                             guint index,
+                             const GError *error)
+{
+  if (error)
+    {
+      connman_message(NULL, "provisioning item %u failed: %s", index, error->message);
+      batch->failed++;
+    }
+  else
+    {
+      batch->succeeded++;
+    }
+
+  if (batch->item_func)
+    batch->item_func(batch->manager, index, error, batch->user_data);
+}
+
+static void provision_pump(ProvisionBatch *batch);
+
+static gboolean provision_done(gpointer user_data)
+{
+  ProvisionBatch *batch = user_data;
+
+  connman_info(NULL, "provisioned %u of %u configurations",
+               batch->succeeded, batch->n_configs);
+
+  if (batch->done_func)
+    batch->done_func(batch->manager, batch->succeeded, batch->failed, batch->user_data);
+
+  g_strfreev(batch->data);
+  g_object_unref(batch->manager);
+  g_slice_free(ProvisionBatch, batch);
+
+  return FALSE;
+}
+
+static void
+provision_callback(GObject *source_object,
+                   GAsyncResult *res,
+                   gpointer user_data)
+{
+  ProvisionItem *item = user_data;
+  ProvisionBatch *batch = item->batch;
+  GError *error = NULL;
+
+  connman_proxy_manager_call_provision_service_finish(batch->manager->proxy, res, &error);
+  connman_stats_end(CONNMAN_STATS_MANAGER_PROVISION_SERVICE, item->start, error != NULL);
+
+  batch->in_flight--;
+  provision_report(batch, item->index, error);
+
+  g_clear_error(&error);
+  g_slice_free(ProvisionItem, item);
+
+  provision_pump(batch);
+}
+
+/*
+ * Keep up to max_in_flight calls outstanding. GDBus writes each call
+ * out as soon as it is made, so the calls travel pipelined on the one
+ * connection instead of waiting for each reply in turn.
+ */
+static void provision_pump(ProvisionBatch *batch)
+{
+  GSource *source;
+
+  while (batch->in_flight < batch->max_in_flight && batch->next < batch->n_configs)
+    {
+      guint index = batch->next++;
+      ProvisionItem *item;
+
+      if (!batch->data[index])
+        continue;
+
+      item = g_slice_new(ProvisionItem);
+      item->batch = batch;
+      item->index = index;
+      item->start = connman_stats_begin();
+
+      batch->in_flight++;
+      connman_proxy_manager_call_provision_service(batch->manager->proxy,
+                                                   batch->data[index], NULL,
+                                                   provision_callback, item);
+    }
+
+  if (batch->in_flight || batch->next < batch->n_configs)
+    return;
+
+  /*
+   * A batch with nothing to send is done right away; complete from the
+   * main loop anyway, so the caller never sees done_func run inside
+   * connman_manager_provision_services().
+   */
+  source = g_idle_source_new();
+  g_source_set_callback(source, provision_done, batch, NULL);
+  g_source_attach(source, batch->manager->context);
+  g_source_unref(source);
+}
+
+/*
+ * Provision @n_configs ConnMan service configurations. Each one is
+ * validated and serialized up front; invalid ones are reported through
+ * @item_func right away and never sent. The rest go out through
+ * ProvisionService with at most @max_in_flight calls outstanding
+ * (0 for the default), and @item_func gets each result as it lands.
+ * @done_func runs once after the last one, from the manager's main
+ * context and never before this function returned.
+ */
+void connman_manager_provision_services(ConnmanManager *manager,
+                                        GKeyFile **configs,
+                                        guint n_configs,
+                                        guint max_in_flight,
+                                        ConnmanProvisionItemFunc item_func,
+                                        ConnmanProvisionDoneFunc done_func,
+                                        gpointer user_data)
+{
+  ProvisionBatch *batch;
+  guint i;
+
+  g_return_if_fail(CONNMAN_IS_MANAGER(manager));
+  g_return_if_fail(configs != NULL || n_configs == 0);
+
+  batch = g_slice_new0(ProvisionBatch);
+  batch->manager = g_object_ref(manager);
+  batch->data = g_new0(gchar *, n_configs + 1);
+  batch->n_configs = n_configs;
+  batch->max_in_flight = max_in_flight ? max_in_flight : DEFAULT_PROVISION_CONCURRENCY;
+  batch->item_func = item_func;
+  batch->done_func = done_func;
+  batch->user_data = user_data;
+
+  for (i = 0; i < n_configs; i++)
+    {
+      GError *error = NULL;
+
+      if (provision_validate(configs[i], &error))
+        batch->data[i] = g_key_file_to_data(configs[i], NULL, &error);
+
+      if (!batch->data[i])
+        {
+          provision_report(batch, i, error);
+          g_error_free(error);
+        }
+    }
+
+  provision_pump(batch);
+}
+
+/*
+ * Ask ConnMan to scan @type ("wifi", ...). Requests from several
+ * consumers are coalesced: while a scan is running, or if one finished
+ * within SCAN_COALESCE_WINDOW, no new scan is issued. Results arrive
+ * as a regular services-updated batch. Returns FALSE if ConnMan
+ * reported it can not scan this technology.
+ */
+gboolean connman_manager_request_scan(ConnmanManager *manager,
+                                      const gchar *type)
+{
+  ScanState *scan;
+
+  g_return_val_if_fail(CONNMAN_IS_MANAGER(manager), FALSE);
+  g_return_val_if_fail(type != NULL, FALSE);
+
+  scan = scan_state_get(manager, type);
+  if (scan->unsupported)
+    return FALSE;
+
+  if (scan->in_flight ||
+      (scan->last_scan &&
+       g_get_monotonic_time() - scan->last_scan < SCAN_COALESCE_WINDOW * G_USEC_PER_SEC))
+    {
+      manager->scans_coalesced++;
+      return TRUE;
+    }
+
+  scan_issue(scan);
+
+  return TRUE;
+}
+
+/*
+ * Scan every technology periodically: every @fast seconds while it has
+ * no connection or only a weak one, backing off up to every @slow
+ * seconds while the connection is good. A @fast of 0 stops periodic
+ * scanning.
+ */
+void connman_manager_set_scan_intervals(ConnmanManager *manager,
+                                        guint fast,
+                                        guint slow)
+{
+  GHashTableIter iter;
+  gpointer value;
+
+  g_return_if_fail(CONNMAN_IS_MANAGER(manager));
+
+  manager->scan_fast = fast;
+  manager->scan_slow = slow;
+
+  g_hash_table_iter_init(&iter, manager->scans);
+  while (g_hash_table_iter_next(&iter, NULL, &value))
+    {
+      ScanState *scan = value;
+
+      scan->interval = 0;
+      scan_reschedule(scan);
+    }
+
+  scan_sync(manager);
+}
+
+/* scans issued, and requests folded into a running or recent scan */
+void connman_manager_get_scan_counts(ConnmanManager *manager,
+                                     guint *issued,
+                                     guint *coalesced)
+{
+  g_return_if_fail(CONNMAN_IS_MANAGER(manager));
+
+  if (issued)
+    *issued = manager->scans_issued;
+  if (coalesced)
+    *coalesced = manager->scans_coalesced;
+}
+
+/*
+ * Track at most @max services (0 disables the limit). Beyond that the
+ * weakest, least recently updated services are dropped, except for
+ * favorites and services that are connecting or connected. Takes
+ * effect with the next refresh, which is scheduled right away.
+ */
+void connman_manager_set_max_services(ConnmanManager *manager,
+                                      guint max)
+{
+  g_return_if_fail(CONNMAN_IS_MANAGER(manager));
+
+  manager->max_services = max;
+  if (!max)
+    g_hash_table_remove_all(manager->evicted);
+
+  manager->services_dirty = TRUE;
+  schedule_flush(manager);
+}
+
+/* number of services evicted since the manager was created */
+guint connman_manager_get_evictions(ConnmanManager *manager)
+{
+  g_return_val_if_fail(CONNMAN_IS_MANAGER(manager), 0);
+
+  return manager->evictions;
+}
+
+/* number of services ConnMan currently lists that are not tracked */
+guint connman_manager_get_suppressed(ConnmanManager *manager)
+{
+  g_return_val_if_fail(CONNMAN_IS_MANAGER(manager), 0);
+
+  return g_hash_table_size(manager->evicted);
+}
+
+void connman_manager_set_coalesce_interval(ConnmanManager *manager,
+                                           guint msec)
+{
+  g_return_if_fail(CONNMAN_IS_MANAGER(manager));
+
+  manager->coalesce_interval = msec;
+}
+
+/*
+ * Attach @filter to all current and future services of @manager.
+ */
+void connman_manager_add_service_filter(ConnmanManager *manager,
+                                        ConnmanServiceFilter *filter)
+{
+  GSList *iter;
+
+  g_return_if_fail(CONNMAN_IS_MANAGER(manager));
+  g_return_if_fail(filter != NULL);
+
+  if (g_slist_find(manager->filters, filter))
+    return;
+
+  manager->filters = g_slist_append(manager->filters,
+                                    connman_service_filter_ref(filter));
+
+  for (iter = manager->services; iter; iter = iter->next)
+    connman_service_add_filter(CONNMAN_SERVICE(iter->data), filter);
+}
+
+void connman_manager_remove_service_filter(ConnmanManager *manager,
+                                           ConnmanServiceFilter *filter)
+{
+  GSList *iter;
+
+  g_return_if_fail(CONNMAN_IS_MANAGER(manager));
+  g_return_if_fail(filter != NULL);
+
+  if (!g_slist_find(manager->filters, filter))
+    return;
+
+  for (iter = manager->services; iter; iter = iter->next)
+    connman_service_remove_filter(CONNMAN_SERVICE(iter->data), filter);
+
+  manager->filters = g_slist_remove(manager->filters, filter);
+  connman_service_filter_unref(filter);
+}
+
+/*
+ * The OfflineMode tracked from PropertyChanged, inverted. While the
+ * manager is stale this is the state from the snapshot. Never blocks.
+ */
+gboolean connman_manager_is_online (ConnmanManager *manager)
+{
+  g_return_val_if_fail(CONNMAN_IS_MANAGER(manager), FALSE);
+
+  return manager->online;
+}
+
+static void
+connect_waiter_free(ConnectWaiter *waiter)
+{
+  g_slice_free(ConnectWaiter, waiter);
+}
+
+static void
+connect_op_free(ConnectOp *op)
+{
+  g_slist_free_full(op->waiters, (GDestroyNotify) connect_waiter_free);
+  g_object_unref(op->service);
+  if (op->proxy)
+    g_object_unref(op->proxy);
+  g_free(op->secret);
+  g_slice_free(ConnectOp, op);
+  connman_stats_object_free(CONNMAN_STATS_OBJECT_PENDING_CALL, sizeof(ConnectOp));
+}
+
+/* hand the outcome to everybody who asked for this connect */
+static void
+connect_op_complete(ConnmanManager *manager,
+                    ConnectOp *op,
+                    const GError *error)
+{
+  gint64 latency = g_get_monotonic_time() - op->requested;
+  GSList *iter;
+
+  if (error)
+    connman_message(connman_service_get_object_path(op->service),
+                    "connect failed after %" G_GINT64_FORMAT " ms: %s",
+                    latency / 1000, error->message);
+  else
+    connman_message(connman_service_get_object_path(op->service),
+                    "connected after %" G_GINT64_FORMAT " ms", latency / 1000);
+
+  for (iter = op->waiters; iter; iter = iter->next)
+    {
+      ConnectWaiter *waiter = iter->data;
+
+      if (waiter->callback)
+        waiter->callback(manager, op->service, error, latency, waiter->user_data);
+    }
+
+  connect_op_free(op);
+}
+
+static void connect_slot_dispatch(ConnmanManager *manager,
+                                  ConnectSlot *slot);
+
+/* the in-flight call of a slot returned, move on to the next one */
+static void
+connect_op_finish(ConnectOp *op,
+                  GError *error)
+{
+  ConnmanManager *manager = op->manager;
+  ConnectSlot *slot = op->slot;
+
+  CONNMAN_TRACE1(connect_reply, error != NULL);
+
+  slot->active = NULL;
+  connect_op_complete(manager, op, error);
+  g_clear_error(&error);
+
+  connect_slot_dispatch(manager, slot);
+  g_object_unref(manager);
+}
+
+static void
+service_connect_callback (GObject *source_object,
+                          GAsyncResult *res,
+                          gpointer user_data)
+{
+  ConnectOp *op = user_data;
+  GError *error = NULL;
+  gchar *ret = NULL;
+
+  connman_proxy_manager_call_connect_service_finish(op->manager->proxy,
+                                                    &ret, res, &error);
+  connman_stats_end(CONNMAN_STATS_MANAGER_CONNECT_SERVICE, op->start, error != NULL);
+  g_free(ret);
+
+  connect_op_finish(op, error);
+}
+
+static void
+service_path_connect_callback (GObject *source_object,
+                               GAsyncResult *res,
+                               gpointer user_data)
+{
+  ConnectOp *op = user_data;
+  GError *error = NULL;
+
+  connman_proxy_service_call_connect_finish(op->proxy, res, &error);
+  connman_stats_end(CONNMAN_STATS_SERVICE_CONNECT, op->start, error != NULL);
+
+  connect_op_finish(op, error);
+}
+
+/*
+ * Service.Connect on the object path we already track is much cheaper
+ * than having ConnMan resolve an SSID dictionary. It is only usable
+ * when the path is current and no secret was given. A secret may be a
+ * changed password, which only the SSID dictionary can carry.
+ */
+static gboolean
+connect_by_path(ConnmanManager *manager,
+                ConnectOp *op)
+{
+  const gchar *path = connman_service_get_object_path(op->service);
+  const gchar *name = connman_service_get_name(op->service);
+  GError *error = NULL;
+
+  if (manager->stale || !name || !*name ||
+      !find_service(manager, path))
+    return FALSE;
+
+  if (op->secret)
+    return FALSE;
+
+  /* with the unique name and no signals the proxy costs no round trip */
+  op->proxy =
+    connman_proxy_service_proxy_new_sync(g_dbus_proxy_get_connection(G_DBUS_PROXY(manager->proxy)),
+                                         G_DBUS_PROXY_FLAGS_DO_NOT_LOAD_PROPERTIES |
+                                         G_DBUS_PROXY_FLAGS_DO_NOT_CONNECT_SIGNALS,
+                                         manager->name_owner ? manager->name_owner : "net.connman",
+                                         path, NULL, &error);
+  if (!op->proxy)
+    {
+      connman_debug(path, "no service proxy: %s", error->message);
+      g_error_free(error);
+      return FALSE;
+    }
+
+  op->manager = g_object_ref(manager);
+  op->start = connman_stats_begin();
+
+  CONNMAN_TRACE2(connect_request, path, op->secret != NULL);
+  connman_proxy_service_call_connect(op->proxy, NULL,
+                                     service_path_connect_callback, op);
+
+  return TRUE;
+}
+
+/*
+ * ConnectService dictionary for @op. Failover keeps reconnecting to
+ * the same few networks, so the dictionaries are built once per
+ * service, security and credential and shared. The credential is part
+ * of the key as a hash only, so a changed password gets a dictionary
+ * of its own. Hidden networks are not cached: until ConnMan reports
+ * the name there is no SSID to send. Returns a new reference.
+ */
+static GVariant *
+connect_params_lookup(ConnmanManager *manager,
+                      ConnectOp *op)
+{
+  GVariantBuilder builder;
+  GVariant *params, *raw;
+  const gchar *ssid = connman_service_get_name(op->service);
+  const gchar *security = connman_service_get_security(op->service);
+  const gchar *type = "wifi";
+  gchar *key = NULL;
+
+  /* the model does not know yet, guess from whether we have a secret */
+  if (!security)
+    security = op->secret ? "psk" : "none";
+
+  if (ssid && *ssid)
+    {
+      gchar *hash = NULL;
+
+      if (op->secret)
+        hash = g_compute_checksum_for_string(G_CHECKSUM_SHA256, op->secret, -1);
+
+      key = g_strjoin("\n", connman_service_get_object_path(op->service),
+                      security, hash ? hash : "", NULL);
+      g_free(hash);
+
+      params = g_hash_table_lookup(manager->connect_params, key);
+      if (params)
+        {
+          g_free(key);
+          return g_variant_ref(params);
+        }
+    }
+
+  /* as ConnMan reported it; only Wifi services get this far */
+  raw = connman_service_lookup_raw(op->service, "Type");
+  if (raw && g_variant_is_of_type(raw, G_VARIANT_TYPE_STRING))
+    type = g_variant_get_string(raw, NULL);
+
+  g_variant_builder_init(&builder, G_VARIANT_TYPE("a{sv}"));
+  g_variant_builder_add(&builder, "{sv}", "Type", g_variant_new_string(type));
+  g_variant_builder_add(&builder, "{sv}", "Mode", g_variant_new_string("managed"));
+  g_variant_builder_add(&builder, "{sv}", "SSID", g_variant_new_string(ssid ? ssid : ""));
+  g_variant_builder_add(&builder, "{sv}", "Security", g_variant_new_string(security));
+  if (op->secret)
+    g_variant_builder_add(&builder, "{sv}", "Passphrase", g_variant_new_string(op->secret));
+
+  params = g_variant_ref_sink(g_variant_builder_end(&builder));
+
+  if (!key)
+    return params;
+
+  /* drop the oldest dictionary to make room */
+  if (g_hash_table_size(manager->connect_params) >= MAX_CONNECT_PARAMS)
+    g_hash_table_remove(manager->connect_params,
+                        g_queue_pop_head(&manager->connect_params_order));
+
+  g_hash_table_insert(manager->connect_params, key, g_variant_ref(params));
+  g_queue_push_tail(&manager->connect_params_order, key);
+
+  return params;
+}
+
+/* issue the head of the queue if nothing is in flight for this technology */
+static void
+connect_slot_dispatch(ConnmanManager *manager,
+                      ConnectSlot *slot)
+{
+  GVariant *params;
+  ConnectOp *op;
+
+  if (slot->active || !slot->queue)
+    return;
+
+  op = slot->queue->data;
+  slot->queue = g_slist_delete_link(slot->queue, slot->queue);
+  slot->active = op;
+
+  if (connect_by_path(manager, op))
+    return;
+
+  /* hidden, unknown or not provisioned yet, go by SSID */
+  params = connect_params_lookup(manager, op);
+
+  op->manager = g_object_ref(manager);
+  op->start = connman_stats_begin();
+
+  CONNMAN_TRACE2(connect_request, connman_service_get_object_path(op->service), op->secret != NULL);
+  connman_proxy_manager_call_connect_service(manager->proxy,
+                                             params, NULL,
+                                             service_connect_callback, op);
+  g_variant_unref(params);
+}
+
+static ConnectOp *
+connect_slot_find(ConnectSlot *slot,
+                  ConnmanService *service)
+{
+  GSList *iter;
+
+  if (slot->active && slot->active->service == service)
+    return slot->active;
+
+  for (iter = slot->queue; iter; iter = iter->next)
+    if (((ConnectOp *) iter->data)->service == service)
+      return iter->data;
+
+  return NULL;
+}
+
+static gint
+compare_connect_priority(gconstpointer a,
+                         gconstpointer b)
+{
+  const ConnectOp *oa = a;
+  const ConnectOp *ob = b;
+
+  return ob->priority - oa->priority;
+}
+
+/*
+ * Queue a connect to @service. Only one ConnectService call is in
+ * flight per technology; the rest wait ordered by @priority, higher
+ * first. A new request supersedes every queued request of the same or
+ * lower priority, which completes with G_IO_ERROR_CANCELLED. Requests
+ * for a service that is already queued or connecting attach to that
+ * operation instead of issuing another call.
+ *
+ * @callback runs once with the outcome and the latency in microseconds
+ * measured from the request, queueing included.
+ */
+gboolean connman_manager_connect_service_full(ConnmanManager *manager,
+                                              ConnmanService *service,
+                                              const gchar *secret,
+                                              gint priority,
+                                              ConnmanConnectCallback callback,
+                                              gpointer user_data)
+{
+  ConnectWaiter *waiter;
+  ConnectSlot *slot;
+  ConnectOp *op;
+  GSList *iter, *superseded = NULL;
+  gint type = CONNMAN_SERVICE_TYPE_UNKNOWN;
+
+  g_return_val_if_fail(CONNMAN_IS_MANAGER(manager), FALSE);
+  g_return_val_if_fail(CONNMAN_IS_SERVICE(service), FALSE);
+
+  connman_message(connman_service_get_object_path(service),
+                  "Connecting to service '%s'", connman_service_get_name(service));
+
+  if (!connman_service_type_wifi(service))
+    {
+      g_critical("Service is not a Wifi service");
+      return FALSE;
+    }
+
+  g_object_get(service, "type", &type, NULL);
+  slot = &manager->connects[type];
+
+  waiter = g_slice_new(ConnectWaiter);
+  waiter->callback = callback;
+  waiter->user_data = user_data;
+
+  op = connect_slot_find(slot, service);
+  if (op)
+    {
+      connman_debug(connman_service_get_object_path(service),
+                    "joining pending connect");
+      op->waiters = g_slist_append(op->waiters, waiter);
+
+      /* a queued connect can still be moved up */
+      if (op != slot->active && priority > op->priority)
+        {
+          op->priority = priority;
+          slot->queue = g_slist_sort(slot->queue, compare_connect_priority);
+        }
+
+      if (op != slot->active && g_strcmp0(secret, op->secret) != 0)
+        {
+          g_free(op->secret);
+          op->secret = g_strdup(secret);
+        }
+
+      return TRUE;
+    }
+
+  op = g_slice_new0(ConnectOp);
+  connman_stats_object_new(CONNMAN_STATS_OBJECT_PENDING_CALL, sizeof(ConnectOp));
+  op->slot = slot;
+  op->service = g_object_ref(service);
+  op->secret = g_strdup(secret);
+  op->priority = priority;
+  op->requested = g_get_monotonic_time();
+  op->waiters = g_slist_append(NULL, waiter);
+
+  for (iter = slot->queue; iter; )
+    {
+      ConnectOp *queued = iter->data;
+      GSList *next = iter->next;
+
+      if (queued->priority <= priority)
+        {
+          slot->queue = g_slist_delete_link(slot->queue, iter);
+          superseded = g_slist_prepend(superseded, queued);
+        }
+
+      iter = next;
+    }
+
+  slot->queue = g_slist_insert_sorted(slot->queue, op, compare_connect_priority);
+
+  for (iter = superseded; iter; iter = iter->next)
+    {
+      GError *error = g_error_new(G_IO_ERROR, G_IO_ERROR_CANCELLED,
+                                  "Superseded by a connect to '%s'",
+                                  connman_service_get_name(service));
+
+      connect_op_complete(manager, iter->data, error);
+      g_error_free(error);
+    }
+  g_slist_free(superseded);
+
+  connect_slot_dispatch(manager, slot);
+
+  return TRUE;
+}
+
+gboolean connman_manager_connect_service (ConnmanManager *manager,
+                                          ConnmanService *service,
+                                          const gchar *secret)
+{
+  return connman_manager_connect_service_full(manager, service, secret,
+                                              0, NULL, NULL);
+}
+
+static ConnmanTechnology *find_wifi_technology (ConnmanManager *manager)
+{
+  GSList *iter;
+
+  for (iter = manager->technologies; iter; iter = iter->next)
+    {
+      ConnmanTechnology *t = CONNMAN_TECHNOLOGY(iter->data);
+
+      if (g_str_equal("wifi", connman_technology_get_name(t)))
+        return t;
+    }
+
+  return NULL;
+}
+
+gboolean connman_manager_enable_tethering (ConnmanManager *manager,
+                                           const gchar *bssid,
+                                           const gchar *secret,
+                                           GError **error)
+{
+  ConnmanTechnology *wifi = find_wifi_technology(manager);
+
+  if (!wifi)
+    {
+      g_set_error(error, G_IO_ERROR, G_IO_ERROR_NOT_FOUND,
+                  "No wifi technology, can not enable tethering");
+      return FALSE;
+    }
+
+  return connman_technology_enable_tethering(wifi, bssid, secret, error);
+}
+
+gboolean connman_manager_disable_tethering (ConnmanManager *manager,
+                                            GError **error)
+{
+  ConnmanTechnology *wifi = find_wifi_technology(manager);
+
+  if (!wifi)
+    {
+      g_set_error(error, G_IO_ERROR, G_IO_ERROR_NOT_FOUND,
+                  "No wifi technology, can not disable tethering");
+      return FALSE;
+    }
+
+  return connman_technology_disable_tethering(wifi, error);
+}
+
+/*
+ * Make @agent the one ConnMan asks for credentials. It stays registered
+ * across ConnMan restarts until connman_manager_unregister_agent().
+ */
+gboolean connman_manager_register_agent(ConnmanManager *manager,
+                                        ConnmanAgent *agent,
+                                        GError **error)
+{
+  GError *local_error = NULL;
+  gint64 start;
+
+  g_return_val_if_fail(CONNMAN_IS_MANAGER(manager), FALSE);
+  g_return_val_if_fail(CONNMAN_IS_AGENT(agent), FALSE);
+
+  start = connman_stats_begin();
+  connman_proxy_manager_call_register_agent_sync(manager->proxy,
+                                                 connman_agent_get_object_path(agent),
+                                                 NULL, &local_error);
+  connman_stats_end(CONNMAN_STATS_MANAGER_REGISTER_AGENT, start, local_error != NULL);
+
+  if (local_error)
+    {
+      g_propagate_error(error, local_error);
+      return FALSE;
+    }
+
+  if (manager->agent)
+    g_object_unref(manager->agent);
+  manager->agent = g_object_ref(agent);
+
+  return TRUE;
+}
+
+gboolean connman_manager_unregister_agent(ConnmanManager *manager,
+                                          GError **error)
+{
+  ConnmanAgent *agent;
+  GError *local_error = NULL;
+  gint64 start;
+
+  g_return_val_if_fail(CONNMAN_IS_MANAGER(manager), FALSE);
+
+  agent = manager->agent;
+  if (!agent)
+    return TRUE;
+
+  manager->agent = NULL;
+
+  start = connman_stats_begin();
+  connman_proxy_manager_call_unregister_agent_sync(manager->proxy,
+                                                   connman_agent_get_object_path(agent),
+                                                   NULL, &local_error);
+  connman_stats_end(CONNMAN_STATS_MANAGER_UNREGISTER_AGENT, start, local_error != NULL);
+
+  g_object_unref(agent);
+
+  if (local_error)
+    {
+      g_propagate_error(error, local_error);
+      return FALSE;
+    }
+
+  return TRUE;
+}
+
+/*
+ * Have ConnMan report traffic to @counter every @period seconds, or
+ * earlier once @accuracy kilobytes were transferred. Like the agent,
+ * the counter is registered again when ConnMan restarts.
+ */
+gboolean connman_manager_register_counter(ConnmanManager *manager,
+                                          ConnmanCounter *counter,
+                                          guint accuracy,
+                                          guint period,
+                                          GError **error)
+{
+  GError *local_error = NULL;
+  gint64 start;
+
+  g_return_val_if_fail(CONNMAN_IS_MANAGER(manager), FALSE);
+  g_return_val_if_fail(CONNMAN_IS_COUNTER(counter), FALSE);
+
+  start = connman_stats_begin();
+  connman_proxy_manager_call_register_counter_sync(manager->proxy,
+                                                   connman_counter_get_object_path(counter),
+                                                   accuracy, period,
+                                                   NULL, &local_error);
+  connman_stats_end(CONNMAN_STATS_MANAGER_REGISTER_COUNTER, start, local_error != NULL);
+
+  if (local_error)
+    {
+      g_propagate_error(error, local_error);
+      return FALSE;
+    }
+
+  if (manager->counter)
+    g_object_unref(manager->counter);
+  manager->counter = g_object_ref(counter);
+  manager->counter_accuracy = accuracy;
+  manager->counter_period = period;
+
+  return TRUE;
+}
+
+gboolean connman_manager_unregister_counter(ConnmanManager *manager,
+                                            GError **error)
+{
+  ConnmanCounter *counter;
+  gboolean ret;
+  gint64 start;
+
+  g_return_val_if_fail(CONNMAN_IS_MANAGER(manager), FALSE);
+
+  counter = manager->counter;
+  if (!counter)
+    return TRUE;
+
+  manager->counter = NULL;
+
+  start = connman_stats_begin();
+  ret = connman_proxy_manager_call_unregister_counter_sync(manager->proxy,
+                                                           connman_counter_get_object_path(counter),
+                                                           NULL, error);
+  connman_stats_end(CONNMAN_STATS_MANAGER_UNREGISTER_COUNTER, start, !ret);
+  g_object_unref(counter);
+
+  return ret;
+}
+
+/*
+ * Create a session with the policy @settings (a{sv}, may be floating),
+ * exporting its notification object at @notify_path. The manager keeps
+ * the session alive on the daemon side, across restarts, until
+ * connman_manager_destroy_session(); the returned reference belongs
+ * to the caller.
+ */
+ConnmanSession *connman_manager_create_session(ConnmanManager *manager,
+                                               const gchar *notify_path,
+                                               GVariant *settings,
+                                               GError **error)
+{
+  ConnmanSession *session;
+  gchar *path = NULL;
+  gboolean ret;
+  gint64 start;
+
+  g_return_val_if_fail(CONNMAN_IS_MANAGER(manager), NULL);
+  g_return_val_if_fail(notify_path != NULL, NULL);
+  g_return_val_if_fail(settings != NULL, NULL);
+
+  session = connman_session_new(g_dbus_proxy_get_connection(G_DBUS_PROXY(manager->proxy)),
+                                notify_path, settings, error);
+  if (!session)
+    return NULL;
+
+  start = connman_stats_begin();
+  ret = connman_proxy_manager_call_create_session_sync(manager->proxy,
+                                                       connman_session_get_requested_settings(session),
+                                                       notify_path, &path, NULL, error);
+  connman_stats_end(CONNMAN_STATS_MANAGER_CREATE_SESSION, start, !ret);
+
+  if (!ret || !connman_session_attach(session, path, error))
+    {
+      g_free(path);
+      g_object_unref(session);
+      return NULL;
+    }
+
+  connman_info(path, "created session for %s", notify_path);
+  g_free(path);
+
+  manager->sessions = g_slist_prepend(manager->sessions, g_object_ref(session));
+
+  return session;
+}
+
+gboolean connman_manager_destroy_session(ConnmanManager *manager,
+                                         ConnmanSession *session,
+                                         GError **error)
+{
+  const gchar *path;
+  gboolean ret = TRUE;
+
+  g_return_val_if_fail(CONNMAN_IS_MANAGER(manager), FALSE);
+  g_return_val_if_fail(CONNMAN_IS_SESSION(session), FALSE);
+
+  if (!g_slist_find(manager->sessions, session))
+    return TRUE;
+
+  path = connman_session_get_object_path(session);
+  if (path)
+    {
+      gint64 start = connman_stats_begin();
+
+      ret = connman_proxy_manager_call_destroy_session_sync(manager->proxy, path, NULL, error);
+      connman_stats_end(CONNMAN_STATS_MANAGER_DESTROY_SESSION, start, !ret);
+    }
+
+  connman_session_detach(session);
+  manager->sessions = g_slist_remove(manager->sessions, session);
+  g_object_unref(session);
+
+  return ret;
+}
+
+GSList *connman_manager_get_services (ConnmanManager *manager)
+{
+  g_return_val_if_fail(CONNMAN_IS_MANAGER(manager), NULL);
+
+  return manager->services;
+}
+
+/*
+ * TRUE while services and online state are not confirmed by the daemon,
+ * i.e. served from the snapshot or kept across a ConnMan restart.
+ */
+gboolean connman_manager_is_stale(ConnmanManager *manager)
+{
+  g_return_val_if_fail(CONNMAN_IS_MANAGER(manager), FALSE);
+
+  return manager->stale;
+}
+
+gboolean connman_manager_save_snapshot(ConnmanManager *manager)
+{
+  GVariantBuilder builder;
+  GVariant *services;
+  GSList *iter;
+  gboolean ret;
+
+  g_return_val_if_fail(CONNMAN_IS_MANAGER(manager), FALSE);
+  g_return_val_if_fail(manager->snapshot_path != NULL, FALSE);
+
+  g_variant_builder_init(&builder, G_VARIANT_TYPE("a(oa{sv})"));
+
+  for (iter = manager->services; iter; iter = iter->next)
+    {
+      ConnmanService *service = CONNMAN_SERVICE(iter->data);
+      GVariant *attrs = connman_service_dup_attributes(service);
+
+      g_variant_builder_add(&builder, "(o@a{sv})",
+                            connman_service_get_object_path(service), attrs);
+      g_variant_unref(attrs);
+    }
+
+  services = g_variant_ref_sink(g_variant_builder_end(&builder));
+  ret = connman_snapshot_write(manager->snapshot_path, services, manager->online);
+  g_variant_unref(services);
+
+  if (ret)
+    manager->snapshot_dirty = FALSE;
+
+  return ret;
+}
+
+/*
+ * Publish the service and technology tables in the POSIX shared memory
+ * segment @name, for readers using connman_shm_reader_open(). Services
+ * beyond @max_services are not exported.
+ */
+gboolean connman_manager_export_shm(ConnmanManager *manager,
+                                    const gchar *name,
+                                    guint max_services)
+{
+  g_return_val_if_fail(CONNMAN_IS_MANAGER(manager), FALSE);
+  g_return_val_if_fail(manager->shm == NULL, FALSE);
+
+  manager->shm = connman_shm_writer_new(name ? name : CONNMAN_SHM_NAME,
+                                        max_services);
+  if (!manager->shm)
+    return FALSE;
+
+  publish_shm(manager);
+
+  return TRUE;
+}
+
+/*
+ * Append a binary change log to @fd, see connman-changelog.c for the
+ * format. The current state is written first as a series of added
+ * records, so a consumer can rebuild everything from the stream.
+ */
+void connman_manager_set_changelog_fd(ConnmanManager *manager,
+                                      int fd)
+{
+  GSList *iter;
+
+  g_return_if_fail(CONNMAN_IS_MANAGER(manager));
+
+  connman_changelog_free(manager->changelog);
+  manager->changelog = NULL;
+
+  if (fd < 0)
+    return;
+
+  manager->changelog = connman_changelog_new(fd, manager->context);
+
+  connman_changelog_manager_state(manager->changelog, manager->online);
+
+  for (iter = manager->technologies; iter; iter = iter->next)
+    {
+      ConnmanTechnology *technology = CONNMAN_TECHNOLOGY(iter->data);
+
+      connman_changelog_technology_changed(manager->changelog,
+                                           connman_technology_get_object_path(technology),
+                                           connman_technology_get_name(technology));
+    }
+
+  for (iter = manager->services; iter; iter = iter->next)
+    connman_changelog_service_added(manager->changelog, iter->data);
+
+  connman_changelog_flush(manager->changelog);
+}
+
+static gboolean snapshot_timeout(gpointer user_data)
+{
+  ConnmanManager *manager = CONNMAN_MANAGER(user_data);
+
+  if (manager->snapshot_dirty && !manager->stale)
+    connman_manager_save_snapshot(manager);
+
+  return TRUE;
+}
+
+static void
+warm_start_callback (GObject *source_object,
+                     GAsyncResult *res,
+                     gpointer user_data)
+{
+  PendingCall *call = user_data;
+  ConnmanManager *manager = call->manager;
+  GError *error = NULL;
+  GVariant *services;
+
+  connman_proxy_manager_call_get_services_finish(manager->proxy,
+                                                 &services, res, &error);
+  connman_stats_end(CONNMAN_STATS_MANAGER_GET_SERVICES, call->start, error != NULL);
+  g_slice_free(PendingCall, call);
+  connman_stats_object_free(CONNMAN_STATS_OBJECT_PENDING_CALL, sizeof(PendingCall));
+
+  if (error)
+    {
+      /* keep serving the snapshot and validate it once the bus recovers */
+      manager->services_dirty = TRUE;
+      manager->properties_dirty = TRUE;
+      schedule_retry(manager, error);
+      g_error_free(error);
+      g_object_unref(manager);
+      return;
+    }
+
+  manager->prefetched = services;
+  manager->services_dirty = TRUE;
+  manager->properties_dirty = TRUE;
+
+  if (!flush_changes(manager, &error))
+    {
+      schedule_retry(manager, error);
+      g_clear_error(&error);
+    }
+
+  publish_shm(manager);
+
+  g_object_unref(manager);
+}
+
+ConnmanManager *connman_manager_new (GBusType bus_type)
+{
+  GError *error = NULL;
+  ConnmanManager *manager = connman_manager_new_full(bus_type, NULL, &error);
+
+  if (!manager)
+    {
+      g_critical("Unable to create manager: %s", error->message);
+      g_error_free(error);
+    }
+
+  return manager;
+}
+
+/*
+ * Like connman_manager_new(), but keeps a snapshot of the service list
+ * in @snapshot_path. If a valid snapshot exists, the manager comes up
+ * with the cached services marked stale and validates them against the
+ * daemon asynchronously; the differences arrive as a regular
+ * "services-updated" emission.
+ *
+ * Only failing to reach the bus is fatal. If ConnMan itself does not
+ * answer yet, the manager starts empty and keeps retrying.
+ */
+ConnmanManager *connman_manager_new_full (GBusType bus_type,
+                                          const gchar *snapshot_path,
+                                          GError **error)
+{
+  GError *local_error = NULL;
+  ConnmanManager *manager = g_object_new(CONNMAN_TYPE_MANAGER, NULL);
+  ConnmanSnapshot *snapshot = NULL;
+  PendingCall *call;
+
+  manager->services = NULL;
+  manager->technologies = NULL;
+  manager->bus_type = bus_type;
+
+  manager->context = g_main_context_get_thread_default();
+  if (!manager->context)
+    manager->context = g_main_context_default();
+  g_main_context_ref(manager->context);
+
+  manager->proxy = connman_proxy_manager_proxy_new_for_bus_sync(bus_type,
+                                                                G_DBUS_PROXY_FLAGS_NONE,
+                                                                "net.connman", "/",
+                                                                NULL, /* cancelable */
+                                                                error);
+  if (!manager->proxy)
+    {
+      g_object_unref(manager);
+      return NULL;
+    }
+
+  g_signal_connect(G_OBJECT(manager->proxy), "state-changed",
+                   G_CALLBACK(manager_state_changed), manager);
+  g_signal_connect(G_OBJECT(manager->proxy), "property-changed",
+                   G_CALLBACK(manager_property_changed), manager);
+
+  manager->service_signal_id =
+    g_dbus_connection_signal_subscribe(g_dbus_proxy_get_connection(G_DBUS_PROXY(manager->proxy)),
+                                       "net.connman",
+                                       "net.connman.Service",
+                                       "PropertyChanged",
+                                       NULL, /* any service path */
+                                       NULL,
+                                       G_DBUS_SIGNAL_FLAGS_NONE,
+                                       service_property_changed,
+                                       manager, NULL);
+
+  if (snapshot_path)
+    {
+      manager->snapshot_path = g_strdup(snapshot_path);
+      snapshot = connman_snapshot_load(snapshot_path);
+    }
+
+  if (snapshot)
+    {
+      ConnmanManagerChanges changes = { NULL, NULL, NULL };
+
+      manager->stale = TRUE;
+      manager->online = connman_snapshot_get_online(snapshot);
+      reconcile_services(manager, connman_snapshot_get_services(snapshot), &changes);
+      g_slist_free(changes.added);
+      connman_snapshot_free(snapshot);
+
+      call = g_slice_new0(PendingCall);
+      connman_stats_object_new(CONNMAN_STATS_OBJECT_PENDING_CALL, sizeof(PendingCall));
+      call->manager = g_object_ref(manager);
+      call->start = connman_stats_begin();
+
+      connman_proxy_manager_call_get_services(manager->proxy, NULL,
+                                              warm_start_callback, call);
+    }
+  else
+    {
+      manager->properties_dirty = TRUE;
+
+      if (!connman_manager_update_services(manager, &local_error))
+        {
+          /* start with what we have, the retry fills in the rest */
+          schedule_retry(manager, local_error);
+          g_clear_error(&local_error);
+        }
+    }
+
+  manager->name_watch_id =
+    g_bus_watch_name_on_connection(g_dbus_proxy_get_connection(G_DBUS_PROXY(manager->proxy)),
+                                   "net.connman",
+                                   G_BUS_NAME_WATCHER_FLAGS_NONE,
+                                   connman_name_appeared,
+                                   connman_name_vanished,
+                                   manager, NULL);
+
+  if (manager->snapshot_path)
+    {
+      manager->snapshot_source = g_timeout_source_new_seconds(SNAPSHOT_INTERVAL);
+      g_source_set_callback(manager->snapshot_source, snapshot_timeout, manager, NULL);
+      g_source_attach(manager->snapshot_source, manager->context);
+    }
+
+  connman_debug(NULL, "%d services%s", g_slist_length(manager->services),
+                manager->stale ? " (from snapshot)" : "");
+
+  return manager;
+}
+
+static void
+connman_manager_init (ConnmanManager *manager)
+{
+  manager->coalesce_interval = DEFAULT_COALESCE_INTERVAL;
+  manager->pending = g_hash_table_new(g_direct_hash, g_direct_equal);
+  manager->evicted = g_hash_table_new_full(g_str_hash, g_str_equal, g_free, NULL);
+  manager->by_path = g_hash_table_new_full(g_str_hash, g_str_equal, g_free, NULL);
+  manager->by_identifier = g_hash_table_new_full(g_str_hash, g_str_equal, g_free, NULL);
+  manager->by_name = g_hash_table_new_full(g_str_hash, g_str_equal, g_free, NULL);
+  manager->indexed_names = g_hash_table_new_full(g_direct_hash, g_direct_equal, NULL, g_free);
+  manager->scans = g_hash_table_new_full(g_str_hash, g_str_equal, NULL,
+                                         (GDestroyNotify) scan_state_free);
+  manager->connect_params = g_hash_table_new_full(g_str_hash, g_str_equal, g_free,
+                                                  (GDestroyNotify) g_variant_unref);
+  g_queue_init(&manager->connect_params_order);
+}
+
+static void
+connman_manager_finalize (GObject *object)
+{
   ConnmanManager *manager = CONNMAN_MANAGER(object);
+  GHashTableIter hiter;
+  gpointer value;
+  GSList *iter;
+
+  if (manager->coalesce_source)
+    {
+      g_source_destroy(manager->coalesce_source);
+      g_source_unref(manager->coalesce_source);
+      manager->coalesce_source = NULL;
+    }
+
+  g_hash_table_destroy(manager->pending);
+  manager->pending = NULL;
+
+  g_hash_table_destroy(manager->evicted);
+  manager->evicted = NULL;
+
+  g_queue_clear(&manager->connect_params_order);
+  g_hash_table_destroy(manager->connect_params);
+  manager->connect_params = NULL;
+
+  /*
+   * Hand back what we registered with the daemon. Nobody is left to
+   * hear the replies, so the calls go out without expecting any.
+   */
+  if (manager->agent)
+    {
+      if (manager->proxy)
+        connman_proxy_manager_call_unregister_agent(manager->proxy,
+                                                    connman_agent_get_object_path(manager->agent),
+                                                    NULL, NULL, NULL);
+      g_object_unref(manager->agent);
+      manager->agent = NULL;
+    }
+
+  if (manager->counter)
+    {
+      if (manager->proxy)
+        connman_proxy_manager_call_unregister_counter(manager->proxy,
+                                                      connman_counter_get_object_path(manager->counter),
+                                                      NULL, NULL, NULL);
+      g_object_unref(manager->counter);
+      manager->counter = NULL;
+    }
+
+  for (iter = manager->sessions; iter; iter = iter->next)
+    {
+      ConnmanSession *session = CONNMAN_SESSION(iter->data);
+      const gchar *path = connman_session_get_object_path(session);
+
+      if (manager->proxy && path)
+        connman_proxy_manager_call_destroy_session(manager->proxy, path,
+                                                   NULL, NULL, NULL);
+      connman_session_detach(session);
+    }
+
+  g_slist_free_full(manager->sessions, g_object_unref);
+  manager->sessions = NULL;
+
+  g_hash_table_destroy(manager->scans);
+  manager->scans = NULL;
+
+  if (manager->snapshot_source)
+    {
+      g_source_destroy(manager->snapshot_source);
+      g_source_unref(manager->snapshot_source);
+      manager->snapshot_source = NULL;
+    }
+
+  /* clean shutdown, persist what we know for the next start */
+  if (manager->snapshot_path && !manager->stale)
+    connman_manager_save_snapshot(manager);
+
+  g_free(manager->snapshot_path);
+  manager->snapshot_path = NULL;
+
+  if (manager->prefetched)
+    {
+      g_variant_unref(manager->prefetched);
+      manager->prefetched = NULL;
+    }
+
+  connman_shm_writer_free(manager->shm);
+  manager->shm = NULL;
+
+  connman_changelog_free(manager->changelog);
+  manager->changelog = NULL;
+
+  if (manager->name_watch_id)
+    {
+      g_bus_unwatch_name(manager->name_watch_id);
+      manager->name_watch_id = 0;
+    }
+
+  g_free(manager->name_owner);
+  manager->name_owner = NULL;
+
+  if (manager->proxy)
+    {
+      if (manager->service_signal_id)
+        g_dbus_connection_signal_unsubscribe(g_dbus_proxy_get_connection(G_DBUS_PROXY(manager->proxy)),
+                                             manager->service_signal_id);
+      g_signal_handlers_disconnect_by_data(manager->proxy, manager);
+      g_object_unref(manager->proxy);
+      manager->proxy = NULL;
+    }
+
+  if (manager->context)
+    {
+      g_main_context_unref(manager->context);
+      manager->context = NULL;
+    }
 
   g_slist_foreach(manager->technologies, (GFunc) g_object_unref, NULL);
   g_slist_free(manager->technologies);
   manager->technologies = NULL;
 
+  g_hash_table_destroy(manager->by_path);
+  g_hash_table_destroy(manager->by_identifier);
+  /* the name lists are updated in place, so they are not owned by the table */
+  g_hash_table_iter_init(&hiter, manager->by_name);
+  while (g_hash_table_iter_next(&hiter, NULL, &value))
+    g_slist_free(value);
+  g_hash_table_destroy(manager->by_name);
+  g_hash_table_destroy(manager->indexed_names);
+
   g_slist_foreach(manager->services, (GFunc) g_object_unref, NULL);
   g_slist_free(manager->services);
   manager->services = NULL;
 
+  g_slist_foreach(manager->filters, (GFunc) connman_service_filter_unref, NULL);
+  g_slist_free(manager->filters);
+  manager->filters = NULL;
+
   G_OBJECT_CLASS (parent_class)->finalize (object);
 }
 
@@ -419,6 +3032,22 @@ connman_manager_class_init (ConnmanManagerClass *klass)
   object_class->get_property = connman_manager_get_property;
   object_class->set_property = connman_manager_set_property;
   object_class->finalize = connman_manager_finalize;
+
+  /**
+   * ConnmanManager::services-updated:
+   * @manager: the manager
+   * @changes: a #ConnmanManagerChanges describing the batch
+   *
+   * Emitted once per coalesce interval with everything that changed
+   * in the service list during that window.
+   */
+  signals[SIGNAL_SERVICES_UPDATED] =
+    g_signal_new("services-updated",
+                 G_TYPE_FROM_CLASS(klass),
+                 G_SIGNAL_RUN_LAST,
+                 0, NULL, NULL,
+                 g_cclosure_marshal_VOID__POINTER,
+                 G_TYPE_NONE, 1, G_TYPE_POINTER);
 }
 
 G_DEFINE_TYPE (ConnmanManager, connman_manager, G_TYPE_OBJECT)
@@ -3,29 +3,147 @@
 
 #include <gio/gio.h>
 #include <glib-object.h>
+#include "connman-agent.h"
+#include "connman-counter.h"
 #include "connman-service.h"
+#include "connman-session.h"
 
 G_BEGIN_DECLS
 
 typedef struct _ConnmanManager      ConnmanManager;
 typedef struct _ConnmanManagerClass ConnmanManagerClass;
 
+typedef struct _ConnmanServiceChange  ConnmanServiceChange;
+typedef struct _ConnmanManagerChanges ConnmanManagerChanges;
+
 struct _ConnmanManagerClass {
   GObjectClass parent_class;
 };
 
+/*
+ * Change set passed to the "services-updated" signal. All signals
+ * arriving within the coalesce interval are folded into one of these.
+ */
+struct _ConnmanServiceChange {
+  ConnmanService *service;
+  guint fields;                 /* CONNMAN_SERVICE_FIELD_* mask */
+};
+
+struct _ConnmanManagerChanges {
+  GSList *added;                /* ConnmanService, owned by the manager */
+  GSList *removed;              /* ConnmanService, valid during emission only */
+  GSList *modified;             /* ConnmanServiceChange */
+};
+
+/*
+ * Outcome of a scheduled connect. @error is NULL on success, and
+ * G_IO_ERROR_CANCELLED if a newer request superseded this one.
+ * @latency is in microseconds from the request.
+ */
+typedef void (*ConnmanConnectCallback) (ConnmanManager *manager,
+                                        ConnmanService *service,
+                                        const GError *error,
+                                        gint64 latency,
+                                        gpointer user_data);
+
+/* result of one configuration of a provisioning batch, NULL @error on success */
+typedef void (*ConnmanProvisionItemFunc) (ConnmanManager *manager,
+                                          guint index,
+                                          const GError *error,
+                                          gpointer user_data);
+typedef void (*ConnmanProvisionDoneFunc) (ConnmanManager *manager,
+                                          guint succeeded,
+                                          guint failed,
+                                          gpointer user_data);
+
 gboolean connman_manager_connect_service(ConnmanManager *manager,
                                          ConnmanService *service,
                                          const gchar *secret);
+gboolean connman_manager_connect_service_full(ConnmanManager *manager,
+                                              ConnmanService *service,
+                                              const gchar *secret,
+                                              gint priority,
+                                              ConnmanConnectCallback callback,
+                                              gpointer user_data);
+/*
+ * The calls below taking a GError block on D-Bus. When the calling
+ * thread is not running its main loop, the tethering calls, the
+ * constructors and connman_manager_update_services() also sleep
+ * through up to 700ms of retries on transient failures.
+ */
 gboolean connman_manager_enable_tethering(ConnmanManager *manager,
                                           const gchar *bssid,
-                                          const gchar *secret);
-gboolean connman_manager_disable_tethering(ConnmanManager *manager);
+                                          const gchar *secret,
+                                          GError **error);
+gboolean connman_manager_disable_tethering(ConnmanManager *manager,
+                                           GError **error);
+gboolean connman_manager_register_agent(ConnmanManager *manager,
+                                        ConnmanAgent *agent,
+                                        GError **error);
+gboolean connman_manager_unregister_agent(ConnmanManager *manager,
+                                          GError **error);
+gboolean connman_manager_register_counter(ConnmanManager *manager,
+                                          ConnmanCounter *counter,
+                                          guint accuracy,
+                                          guint period,
+                                          GError **error);
+gboolean connman_manager_unregister_counter(ConnmanManager *manager,
+                                            GError **error);
+ConnmanSession *connman_manager_create_session(ConnmanManager *manager,
+                                               const gchar *notify_path,
+                                               GVariant *settings,
+                                               GError **error);
+gboolean connman_manager_destroy_session(ConnmanManager *manager,
+                                         ConnmanSession *session,
+                                         GError **error);
 
 gboolean connman_manager_is_online (ConnmanManager *manager);
 GSList *connman_manager_get_services(ConnmanManager *manager);
-gboolean connman_manager_update_services(ConnmanManager *manager);
+gboolean connman_manager_update_services(ConnmanManager *manager,
+                                         GError **error);
+void connman_manager_set_coalesce_interval(ConnmanManager *manager,
+                                           guint msec);
+ConnmanService *connman_manager_find_service(ConnmanManager *manager,
+                                             const gchar *key);
+GSList *connman_manager_find_services_by_name(ConnmanManager *manager,
+                                              const gchar *name);
+gchar *connman_manager_lookup_service(ConnmanManager *manager,
+                                      const gchar *pattern,
+                                      GError **error);
+void connman_manager_provision_services(ConnmanManager *manager,
+                                        GKeyFile **configs,
+                                        guint n_configs,
+                                        guint max_in_flight,
+                                        ConnmanProvisionItemFunc item_func,
+                                        ConnmanProvisionDoneFunc done_func,
+                                        gpointer user_data);
+gboolean connman_manager_request_scan(ConnmanManager *manager,
+                                      const gchar *type);
+void connman_manager_set_scan_intervals(ConnmanManager *manager,
+                                        guint fast,
+                                        guint slow);
+void connman_manager_get_scan_counts(ConnmanManager *manager,
+                                     guint *issued,
+                                     guint *coalesced);
+void connman_manager_set_max_services(ConnmanManager *manager,
+                                      guint max);
+guint connman_manager_get_evictions(ConnmanManager *manager);
+guint connman_manager_get_suppressed(ConnmanManager *manager);
+void connman_manager_add_service_filter(ConnmanManager *manager,
+                                        ConnmanServiceFilter *filter);
+void connman_manager_remove_service_filter(ConnmanManager *manager,
+                                           ConnmanServiceFilter *filter);
+gboolean connman_manager_is_stale(ConnmanManager *manager);
+gboolean connman_manager_save_snapshot(ConnmanManager *manager);
+gboolean connman_manager_export_shm(ConnmanManager *manager,
+                                    const gchar *name,
+                                    guint max_services);
+void connman_manager_set_changelog_fd(ConnmanManager *manager,
+                                      int fd);
 ConnmanManager *connman_manager_new(GBusType bus_type);
+ConnmanManager *connman_manager_new_full(GBusType bus_type,
+                                         const gchar *snapshot_path,
+                                         GError **error);
 
 GType connman_manager_get_type (void);
 #define CONNMAN_TYPE_MANAGER             connman_manager_get_type()
@@ -0,0 +1,57 @@
+#ifndef CONNMAN_SEQLOCK_H_
+#define CONNMAN_SEQLOCK_H_
+
+#include <glib.h>
+
+G_BEGIN_DECLS
+
+/*
+ * Sequence lock for a single writer and any number of lock-free
+ * readers. The writer makes the counter odd before changing the data
+ * and even again afterwards; a reader copies the data and retries if
+ * the counter was odd or moved meanwhile.
+ *
+ * The fences keep the data accesses inside the window on weakly
+ * ordered CPUs: the reader's copy may not be satisfied after its
+ * closing counter check, and the writer's stores may not become
+ * visible before the counter turns odd or after it turns even again.
+ *
+ *   do
+ *     {
+ *       seq = connman_seqlock_read_begin(&lock);
+ *       if (seq & 1)
+ *         continue;
+ *       ... copy the data ...
+ *     }
+ *   while (connman_seqlock_read_retry(&lock, seq));
+ */
+
+static inline gint connman_seqlock_read_begin(const gint *seq)
+{
+  return __atomic_load_n(seq, __ATOMIC_ACQUIRE);
+}
+
+/* TRUE if the data copied since connman_seqlock_read_begin() is torn */
+static inline gboolean connman_seqlock_read_retry(const gint *seq,
+                                                  gint start)
+{
+  __atomic_thread_fence(__ATOMIC_ACQUIRE);
+
+  return (start & 1) || __atomic_load_n(seq, __ATOMIC_RELAXED) != start;
+}
+
+static inline void connman_seqlock_write_begin(gint *seq)
+{
+  __atomic_add_fetch(seq, 1, __ATOMIC_RELAXED);
+  __atomic_thread_fence(__ATOMIC_RELEASE);
+}
+
+static inline void connman_seqlock_write_end(gint *seq)
+{
+  __atomic_thread_fence(__ATOMIC_RELEASE);
+  __atomic_add_fetch(seq, 1, __ATOMIC_RELAXED);
+}
+
+G_END_DECLS
+
+#endif /* CONNMAN_SEQLOCK_H_ */
@@ -21,7 +21,10 @@
 #include <gio/gio.h>
 
 #include "connman-generated.h"
+#include "connman-log.h"
 #include "connman-service.h"
+#include "connman-stats.h"
+#include "connman-trace.h"
 
 struct _ConnmanService {
   GObject parent;
@@ -39,24 +42,138 @@ struct _ConnmanService {
   gboolean favorite;
   gchar *name;
   gint type;
+
+  /* change tracking */
+  guint dirty;                  /* CONNMAN_SERVICE_FIELD_* mask */
+  guint64 generation;
+  gint64 last_update;           /* monotonic time of the last change */
+  gint64 last_seen;             /* monotonic time ConnMan last reported it in range */
+  GSList *filters;              /* ConnmanServiceFilter, referenced */
+
+  /* raw attributes, for keys not modelled above */
+  GVariant *attrs;              /* a{sv} of the last full update */
+  GHashTable *raw;              /* key -> GVariant, borrowed out by lookup_raw */
 };
 
+/*
+ * A filter sits between the update path and one consumer. It drops
+ * Strength changes below a deadband and holds back deliveries that
+ * arrive faster than the configured rate, so listeners only wake up
+ * for meaningful changes.
+ */
+struct _ConnmanServiceFilter {
+  gint ref_count;
+
+  guint fields;                 /* CONNMAN_SERVICE_FIELD_* of interest */
+  guint strength_deadband;
+  guint min_interval;           /* ms between two deliveries */
+
+  ConnmanServiceFilterFunc func;
+  gpointer user_data;
+  GDestroyNotify destroy;
+
+  GMainContext *context;
+  GHashTable *states;           /* ConnmanService -> FilterState */
+};
+
+typedef struct {
+  ConnmanServiceFilter *filter;
+  ConnmanService *service;
+  guint reported_strength;
+  gint64 last_report;           /* monotonic time, usec */
+  guint pending;                /* fields held back by the rate limit */
+  GSource *trailing;
+} FilterState;
+
 static GObjectClass *parent_class = NULL;
 
 enum {
+  SIGNAL_CHANGED,
   SIGNAL_LAST
 };
 
 static gint signals[SIGNAL_LAST];
 
+/* "changed" signal details, indexed by CONNMAN_SERVICE_FIELD_* bit number */
+static const gchar *field_names[] = {
+  "name",
+  "type",
+  "state",
+  "strength",
+  "favorite",
+  "auto-connect",
+  "immutable",
+  "login-required",
+  "passphrase-required",
+};
+
+static GQuark field_quarks[G_N_ELEMENTS(field_names)];
+
+static void filter_process(ConnmanServiceFilter *filter,
+                           ConnmanService *service,
+                           guint changed);
+
+/*
+ * The first property ids mirror the CONNMAN_SERVICE_FIELD_* bits, so
+ * field bit n is notified through props[n + 1].
+ */
+enum {
+  PROP_0,
+  PROP_NAME,
+  PROP_TYPE,
+  PROP_STATE,
+  PROP_STRENGTH,
+  PROP_FAVORITE,
+  PROP_AUTO_CONNECT,
+  PROP_IMMUTABLE,
+  PROP_LOGIN_REQUIRED,
+  PROP_PASSPHRASE_REQUIRED,
+  PROP_OBJECT_PATH,
+  PROP_LAST
+};
+
+static GParamSpec *props[PROP_LAST];
+
 static void
 connman_service_get_property (GObject    *object,
                               guint       property_id,
                               GValue     *value,
                               GParamSpec *pspec)
 {
+  ConnmanService *service = CONNMAN_SERVICE(object);
+
   switch (property_id)
     {
+      case PROP_NAME:
+        g_value_set_string(value, service->name);
+        break;
+      case PROP_TYPE:
+        g_value_set_int(value, service->type);
+        break;
+      case PROP_STATE:
+        g_value_set_uint(value, service->state);
+        break;
+      case PROP_STRENGTH:
+        g_value_set_uint(value, service->strength);
+        break;
+      case PROP_FAVORITE:
+        g_value_set_boolean(value, service->favorite);
+        break;
+      case PROP_AUTO_CONNECT:
+        g_value_set_boolean(value, service->auto_connect);
+        break;
+      case PROP_IMMUTABLE:
+        g_value_set_boolean(value, service->immutable);
+        break;
+      case PROP_LOGIN_REQUIRED:
+        g_value_set_boolean(value, service->login_required);
+        break;
+      case PROP_PASSPHRASE_REQUIRED:
+        g_value_set_boolean(value, service->passphrase_required);
+        break;
+      case PROP_OBJECT_PATH:
+        g_value_set_string(value, service->object_path);
+        break;
       default:
         G_OBJECT_WARN_INVALID_PROPERTY_ID (object, property_id, pspec);
     }
@@ -68,8 +185,17 @@ connman_service_set_property (GObject      *object,
                               const GValue *value,
                               GParamSpec   *pspec)
 {
+  ConnmanService *service = CONNMAN_SERVICE(object);
+
   switch (property_id)
     {
+      case PROP_OBJECT_PATH:
+        connman_stats_string_replaced(CONNMAN_STATS_OBJECT_SERVICE,
+                                      service->object_path,
+                                      g_value_get_string(value));
+        g_free(service->object_path);
+        service->object_path = g_value_dup_string(value);
+        break;
       default:
         G_OBJECT_WARN_INVALID_PROPERTY_ID (object, property_id, pspec);
     }
@@ -83,68 +209,586 @@ gboolean connman_service_has_object_path(ConnmanService *service,
   return g_str_equal(service->object_path, path);
 }
 
-ConnmanService *connman_service_new(GVariant *variant)
+static const gchar *state_names[] = {
+  [CONNMAN_SERVICE_STATE_IDLE]          = "idle",
+  [CONNMAN_SERVICE_STATE_FAILURE]       = "failure",
+  [CONNMAN_SERVICE_STATE_ASSOCIATION]   = "association",
+  [CONNMAN_SERVICE_STATE_CONFIGURATION] = "configuration",
+  [CONNMAN_SERVICE_STATE_READY]         = "ready",
+  [CONNMAN_SERVICE_STATE_ONLINE]        = "online",
+  [CONNMAN_SERVICE_STATE_DISCONNECT]    = "disconnect",
+};
+
+static guint parse_state(const gchar *v)
 {
-  ConnmanService *service = g_object_new(CONNMAN_TYPE_SERVICE, NULL);
-  GVariant *child = g_variant_get_child_value(variant, 0);
-  GVariant *attrs;
-  gsize i;
+  guint i;
+
+  for (i = CONNMAN_SERVICE_STATE_IDLE; i <= CONNMAN_SERVICE_STATE_MAX; i++)
+    if (g_str_equal(v, state_names[i]))
+      return i;
 
-  service->object_path = g_variant_dup_string(child, NULL);
-  attrs = g_variant_get_child_value(variant, 1);
+  return CONNMAN_SERVICE_STATE_UNKNOWN;
+}
 
-  for (i = 0; i < g_variant_n_children(attrs); i++)
+static guint update_boolean(gboolean *field, GVariant *val, guint bit)
+{
+  gboolean v = g_variant_get_boolean(val);
+
+  if (*field == v)
+    return 0;
+
+  *field = v;
+  return bit;
+}
+
+/*
+ * Store a single ConnMan property in the service. Returns the
+ * CONNMAN_SERVICE_FIELD_* bit of the field if its value changed,
+ * or 0 for unchanged and unknown properties.
+ */
+static guint apply_property(ConnmanService *service,
+                            const gchar *key,
+                            GVariant *val)
+{
+  if (g_str_equal(key, "Name"))
     {
-      GVariant *attr = g_variant_get_child_value(attrs, i);
-      GVariant *key_v = g_variant_get_child_value(attr, 0);
-      GVariant *val_v = g_variant_get_child_value(attr, 1);
-      GVariant *val = g_variant_get_variant(val_v);
-      const gchar *key = g_variant_get_string(key_v, NULL);
+      const gchar *v = g_variant_get_string(val, NULL);
+
+      if (g_strcmp0(service->name, v) == 0)
+        return 0;
+
+      connman_stats_string_replaced(CONNMAN_STATS_OBJECT_SERVICE, service->name, v);
+      g_free(service->name);
+      service->name = g_strdup(v);
+      return CONNMAN_SERVICE_FIELD_NAME;
+    }
+
+  if (g_str_equal(key, "Type"))
+    {
+      const gchar *v = g_variant_get_string(val, NULL);
+      gint type = CONNMAN_SERVICE_TYPE_UNKNOWN;
+
+      if (g_str_equal(v, "wifi"))
+        type = CONNMAN_SERVICE_TYPE_WIFI;
+
+      if (g_str_equal(v, "ethernet"))
+        type = CONNMAN_SERVICE_TYPE_ETHERNET;
+
+      if (service->type == type)
+        return 0;
+
+      service->type = type;
+      return CONNMAN_SERVICE_FIELD_TYPE;
+    }
+
+  if (g_str_equal(key, "State"))
+    {
+      guint state = parse_state(g_variant_get_string(val, NULL));
+
+      if (service->state == state)
+        return 0;
+
+      service->state = state;
+      return CONNMAN_SERVICE_FIELD_STATE;
+    }
+
+  if (g_str_equal(key, "Strength"))
+    {
+      guchar strength = g_variant_get_byte(val);
+
+      if (service->strength == strength)
+        return 0;
+
+      service->strength = strength;
+      return CONNMAN_SERVICE_FIELD_STRENGTH;
+    }
+
+  if (g_str_equal(key, "LoginRequired"))
+    return update_boolean(&service->login_required, val,
+                          CONNMAN_SERVICE_FIELD_LOGIN_REQUIRED);
 
-      if (g_str_equal(key, "Name"))
-        service->name =  g_variant_dup_string(val, NULL);
+  if (g_str_equal(key, "PassphraseRequired"))
+    return update_boolean(&service->passphrase_required, val,
+                          CONNMAN_SERVICE_FIELD_PASSPHRASE_REQUIRED);
 
-      if (g_str_equal(key, "Type"))
+  if (g_str_equal(key, "AutoConnect"))
+    return update_boolean(&service->auto_connect, val,
+                          CONNMAN_SERVICE_FIELD_AUTO_CONNECT);
+
+  if (g_str_equal(key, "Immutable"))
+    return update_boolean(&service->immutable, val,
+                          CONNMAN_SERVICE_FIELD_IMMUTABLE);
+
+  if (g_str_equal(key, "Favorite"))
+    return update_boolean(&service->favorite, val,
+                          CONNMAN_SERVICE_FIELD_FAVORITE);
+
+  return 0;
+}
+
+/*
+ * Record a set of changed fields: mark them dirty, start a new
+ * generation and emit "changed" and "notify" once per field. Property
+ * notifications are frozen meanwhile, so a multi-field update reaches
+ * notify listeners as one batch.
+ */
+static void commit_changes(ConnmanService *service, guint changed)
+{
+  GSList *iter, *filters;
+  guint i;
+
+  if (!changed)
+    return;
+
+  service->dirty |= changed;
+  service->generation++;
+  service->last_update = g_get_monotonic_time();
+
+  g_object_freeze_notify(G_OBJECT(service));
+
+  for (i = 0; i < G_N_ELEMENTS(field_quarks); i++)
+    if (changed & (1 << i))
+      {
+        g_signal_emit(service, signals[SIGNAL_CHANGED], field_quarks[i], 1 << i);
+        g_object_notify_by_pspec(G_OBJECT(service), props[i + 1]);
+      }
+
+  g_object_thaw_notify(G_OBJECT(service));
+
+  /*
+   * Consumers run synchronously from filter_process() and may remove
+   * their filter, so walk a reffed copy and skip filters that are gone.
+   */
+  filters = g_slist_copy(service->filters);
+  g_slist_foreach(filters, (GFunc) connman_service_filter_ref, NULL);
+  g_object_ref(service);
+
+  for (iter = filters; iter; iter = iter->next)
+    if (g_slist_find(service->filters, iter->data))
+      filter_process(iter->data, service, changed);
+
+  g_slist_foreach(filters, (GFunc) connman_service_filter_unref, NULL);
+  g_slist_free(filters);
+  g_object_unref(service);
+}
+
+/*
+ * Apply a single ConnMan property, as delivered by PropertyChanged.
+ * Returns the CONNMAN_SERVICE_FIELD_* bit if the value changed.
+ */
+guint connman_service_update_property(ConnmanService *service,
+                                      const gchar *key,
+                                      GVariant *val)
+{
+  guint changed;
+
+  g_return_val_if_fail(CONNMAN_IS_SERVICE(service), 0);
+
+  changed = apply_property(service, key, val);
+
+  /* shadows the entry in service->attrs until the next full update */
+  g_hash_table_insert(service->raw, g_strdup(key), g_variant_ref(val));
+
+  commit_changes(service, changed);
+
+  return changed;
+}
+
+/*
+ * Apply an a{sv} attribute dictionary as delivered by GetServices.
+ * Returns the mask of fields that changed.
+ */
+guint connman_service_update(ConnmanService *service,
+                             GVariant *attrs)
+{
+  GVariantIter iter;
+  const gchar *key;
+  GVariant *val;
+  guint changed = 0;
+
+  g_return_val_if_fail(CONNMAN_IS_SERVICE(service), 0);
+
+  g_variant_iter_init(&iter, attrs);
+  while (g_variant_iter_next(&iter, "{&sv}", &key, &val))
+    {
+      changed |= apply_property(service, key, val);
+      g_variant_unref(val);
+    }
+
+  /* keep the dictionary itself instead of copying unmodelled values */
+  g_hash_table_remove_all(service->raw);
+  connman_stats_variant_replaced(CONNMAN_STATS_OBJECT_SERVICE, service->attrs, attrs);
+  if (service->attrs)
+    g_variant_unref(service->attrs);
+  service->attrs = g_variant_ref_sink(attrs);
+
+  commit_changes(service, changed);
+
+  return changed;
+}
+
+/*
+ * Look up an arbitrary ConnMan property by its D-Bus name. The value
+ * is borrowed from the service and stays valid until the next call to
+ * connman_service_update(), or to connman_service_update_property()
+ * for @key; take a reference to keep it longer.
+ */
+GVariant *connman_service_lookup_raw(ConnmanService *service,
+                                     const gchar *key)
+{
+  GVariant *val;
+
+  g_return_val_if_fail(CONNMAN_IS_SERVICE(service), NULL);
+  g_return_val_if_fail(key != NULL, NULL);
+
+  val = g_hash_table_lookup(service->raw, key);
+  if (val || !service->attrs)
+    return val;
+
+  /* child values share the serialised data of the dictionary */
+  val = g_variant_lookup_value(service->attrs, key, NULL);
+  if (val)
+    g_hash_table_insert(service->raw, g_strdup(key), val);
+
+  return val;
+}
+
+/*
+ * Primary security method ConnMan reports for the service ("none",
+ * "wep", "psk", "ieee8021x", ...), or NULL if unknown. Borrowed like
+ * connman_service_lookup_raw(); copy the string to keep it across
+ * updates.
+ */
+const gchar *connman_service_get_security(ConnmanService *service)
+{
+  GVariant *security = connman_service_lookup_raw(service, "Security");
+  const gchar *method = NULL;
+
+  if (security && g_variant_is_of_type(security, G_VARIANT_TYPE_STRING_ARRAY) &&
+      g_variant_n_children(security) > 0)
+    g_variant_get_child(security, 0, "&s", &method);
+
+  return method;
+}
+
+/*
+ * Build the current a{sv} of the service, i.e. the last full update
+ * with all PropertyChanged values applied on top.
+ */
+GVariant *connman_service_dup_attributes(ConnmanService *service)
+{
+  GVariantBuilder builder;
+  GHashTableIter hiter;
+  GVariantIter iter;
+  gpointer key, value;
+  const gchar *k;
+  GVariant *val;
+
+  g_return_val_if_fail(CONNMAN_IS_SERVICE(service), NULL);
+
+  g_variant_builder_init(&builder, G_VARIANT_TYPE("a{sv}"));
+
+  if (service->attrs)
+    {
+      g_variant_iter_init(&iter, service->attrs);
+      while (g_variant_iter_next(&iter, "{&sv}", &k, &val))
         {
-          const gchar *v = g_variant_get_string(val, NULL);
-          
-          if (g_str_equal(v, "wifi"))
-            service->type = CONNMAN_SERVICE_TYPE_WIFI;
-          
-          if (g_str_equal(v, "ethernet"))
-            service->type = CONNMAN_SERVICE_TYPE_ETHERNET;
+          if (!g_hash_table_lookup(service->raw, k))
+            g_variant_builder_add(&builder, "{sv}", k, val);
+          g_variant_unref(val);
         }
+    }
 
-      if (g_str_equal(key, "LoginRequired"))
-        service->login_required = g_variant_get_boolean(val);
-
-      if (g_str_equal(key, "PassphraseRequired"))
-        service->passphrase_required = g_variant_get_boolean(val);
-
-      if (g_str_equal(key, "AutoConnect"))
-        service->auto_connect = g_variant_get_boolean(val);
-      
-      if (g_str_equal(key, "Immutable"))
-        service->immutable = g_variant_get_boolean(val);
-      
-      if (g_str_equal(key, "Favorite"))
-        service->favorite = g_variant_get_boolean(val);
-      
-      if (g_str_equal(key, "Strength"))
-        service->strength = g_variant_get_byte(val);
+  g_hash_table_iter_init(&hiter, service->raw);
+  while (g_hash_table_iter_next(&hiter, &key, &value))
+    g_variant_builder_add(&builder, "{sv}", key, value);
+
+  return g_variant_ref_sink(g_variant_builder_end(&builder));
+}
+
+gint64 connman_service_get_last_update(ConnmanService *service)
+{
+  g_return_val_if_fail(CONNMAN_IS_SERVICE(service), 0);
+  return service->last_update;
+}
+
+/*
+ * When ConnMan last listed the service with a signal strength, i.e.
+ * in range. Unlike the last update this does not move when only e.g.
+ * the name or the favorite flag changes.
+ */
+gint64 connman_service_get_last_seen(ConnmanService *service)
+{
+  g_return_val_if_fail(CONNMAN_IS_SERVICE(service), 0);
+  return service->last_seen;
+}
+
+void connman_service_set_last_seen(ConnmanService *service,
+                                   gint64 time)
+{
+  g_return_if_fail(CONNMAN_IS_SERVICE(service));
+  service->last_seen = time;
+}
+
+/*
+ * GCompareFunc putting the services to drop first in front: weakest
+ * first, then least recently seen in range.
+ */
+gint connman_service_compare_eviction(gconstpointer a,
+                                      gconstpointer b)
+{
+  const ConnmanService *sa = a;
+  const ConnmanService *sb = b;
+
+  if (sa->strength != sb->strength)
+    return sa->strength < sb->strength ? -1 : 1;
+
+  return sa->last_seen < sb->last_seen ? -1 : sa->last_seen > sb->last_seen;
+}
+
+guint connman_service_get_dirty(ConnmanService *service)
+{
+  g_return_val_if_fail(CONNMAN_IS_SERVICE(service), 0);
+  return service->dirty;
+}
+
+/* return the dirty mask and reset it, for consumers that poll */
+guint connman_service_take_dirty(ConnmanService *service)
+{
+  guint dirty;
+
+  g_return_val_if_fail(CONNMAN_IS_SERVICE(service), 0);
+
+  dirty = service->dirty;
+  service->dirty = 0;
+
+  return dirty;
+}
+
+guint64 connman_service_get_generation(ConnmanService *service)
+{
+  g_return_val_if_fail(CONNMAN_IS_SERVICE(service), 0);
+  return service->generation;
+}
+
+static void filter_state_free(FilterState *state)
+{
+  if (state->trailing)
+    {
+      g_source_destroy(state->trailing);
+      g_source_unref(state->trailing);
+    }
+
+  g_slice_free(FilterState, state);
+  connman_stats_object_free(CONNMAN_STATS_OBJECT_FILTER_STATE, sizeof(FilterState));
+}
+
+static void filter_deliver(FilterState *state)
+{
+  ConnmanServiceFilter *filter = state->filter;
+  ConnmanService *service = state->service;
+  guint fields = state->pending;
+
+  state->pending = 0;
+
+  /* strength may have drifted back while the delivery was held back */
+  if ((fields & CONNMAN_SERVICE_FIELD_STRENGTH) &&
+      ABS((gint) service->strength - (gint) state->reported_strength) < (gint) filter->strength_deadband)
+    fields &= ~CONNMAN_SERVICE_FIELD_STRENGTH;
+
+  if (!fields)
+    return;
+
+  if (fields & CONNMAN_SERVICE_FIELD_STRENGTH)
+    state->reported_strength = service->strength;
+
+  state->last_report = g_get_monotonic_time();
+  filter->func(service, fields, filter->user_data);
+}
+
+static gboolean filter_trailing_timeout(gpointer user_data)
+{
+  FilterState *state = user_data;
+
+  g_source_unref(state->trailing);
+  state->trailing = NULL;
+
+  filter_deliver(state);
+
+  return FALSE;
+}
+
+static void filter_process(ConnmanServiceFilter *filter,
+                           ConnmanService *service,
+                           guint changed)
+{
+  FilterState *state = g_hash_table_lookup(filter->states, service);
+  gint64 wait;
+
+  if (!state)
+    return;
+
+  state->pending |= changed & filter->fields;
+  if (!state->pending || state->trailing)
+    return;
+
+  wait = state->last_report + (gint64) filter->min_interval * 1000 - g_get_monotonic_time();
+  if (wait <= 0)
+    {
+      filter_deliver(state);
+      return;
     }
 
-  g_message("new service %p: '%s' (%d)", service, service->name, service->type);
+  /* rate limited: deliver whatever is pending once the interval expired */
+  state->trailing = g_timeout_source_new(wait / 1000 + 1);
+  g_source_set_callback(state->trailing, filter_trailing_timeout, state, NULL);
+  g_source_attach(state->trailing, filter->context);
+}
+
+ConnmanServiceFilter *connman_service_filter_new(guint fields,
+                                                 ConnmanServiceFilterFunc func,
+                                                 gpointer user_data,
+                                                 GDestroyNotify destroy)
+{
+  ConnmanServiceFilter *filter;
+
+  g_return_val_if_fail(func != NULL, NULL);
+
+  filter = g_slice_new0(ConnmanServiceFilter);
+  connman_stats_object_new(CONNMAN_STATS_OBJECT_FILTER, sizeof(ConnmanServiceFilter));
+  filter->ref_count = 1;
+  filter->fields = fields;
+  filter->func = func;
+  filter->user_data = user_data;
+  filter->destroy = destroy;
+  filter->states = g_hash_table_new_full(g_direct_hash, g_direct_equal, NULL,
+                                         (GDestroyNotify) filter_state_free);
+
+  filter->context = g_main_context_get_thread_default();
+  if (!filter->context)
+    filter->context = g_main_context_default();
+  g_main_context_ref(filter->context);
+
+  return filter;
+}
+
+ConnmanServiceFilter *connman_service_filter_ref(ConnmanServiceFilter *filter)
+{
+  g_return_val_if_fail(filter != NULL, NULL);
+
+  g_atomic_int_inc(&filter->ref_count);
+
+  return filter;
+}
+
+void connman_service_filter_unref(ConnmanServiceFilter *filter)
+{
+  g_return_if_fail(filter != NULL);
+
+  if (!g_atomic_int_dec_and_test(&filter->ref_count))
+    return;
+
+  /* services hold references, so no state can be left at this point */
+  g_hash_table_destroy(filter->states);
+  g_main_context_unref(filter->context);
+
+  if (filter->destroy)
+    filter->destroy(filter->user_data);
+
+  g_slice_free(ConnmanServiceFilter, filter);
+  connman_stats_object_free(CONNMAN_STATS_OBJECT_FILTER, sizeof(ConnmanServiceFilter));
+}
+
+/* ignore Strength changes smaller than @deadband relative to the last delivery */
+void connman_service_filter_set_strength_deadband(ConnmanServiceFilter *filter,
+                                                  guint deadband)
+{
+  g_return_if_fail(filter != NULL);
+
+  filter->strength_deadband = deadband;
+}
+
+/* deliver at most one change per service every @msec milliseconds */
+void connman_service_filter_set_min_interval(ConnmanServiceFilter *filter,
+                                             guint msec)
+{
+  g_return_if_fail(filter != NULL);
+
+  filter->min_interval = msec;
+}
+
+void connman_service_add_filter(ConnmanService *service,
+                                ConnmanServiceFilter *filter)
+{
+  FilterState *state;
+
+  g_return_if_fail(CONNMAN_IS_SERVICE(service));
+  g_return_if_fail(filter != NULL);
+
+  if (g_hash_table_lookup(filter->states, service))
+    return;
+
+  state = g_slice_new0(FilterState);
+  connman_stats_object_new(CONNMAN_STATS_OBJECT_FILTER_STATE, sizeof(FilterState));
+  state->filter = filter;
+  state->service = service;
+  state->reported_strength = service->strength;
+
+  g_hash_table_insert(filter->states, service, state);
+  service->filters = g_slist_prepend(service->filters,
+                                     connman_service_filter_ref(filter));
+}
+
+void connman_service_remove_filter(ConnmanService *service,
+                                   ConnmanServiceFilter *filter)
+{
+  g_return_if_fail(CONNMAN_IS_SERVICE(service));
+  g_return_if_fail(filter != NULL);
+
+  if (!g_slist_find(service->filters, filter))
+    return;
+
+  g_hash_table_remove(filter->states, service);
+  service->filters = g_slist_remove(service->filters, filter);
+  connman_service_filter_unref(filter);
+}
+
+ConnmanService *connman_service_new(GVariant *variant)
+{
+  ConnmanService *service;
+  const gchar *path;
+  GVariant *attrs;
+
+  g_variant_get(variant, "(&o@a{sv})", &path, &attrs);
+  service = g_object_new(CONNMAN_TYPE_SERVICE, "object-path", path, NULL);
+  connman_service_update(service, attrs);
+  g_variant_unref(attrs);
+
+  CONNMAN_TRACE2(service_new, service->object_path, service);
+  connman_debug(service->object_path, "new service %p: '%s' (%d)",
+                service, service->name, service->type);
 
   return service;
 }
 
+const gchar *connman_service_get_object_path(ConnmanService *service)
+{
+  g_return_val_if_fail(CONNMAN_IS_SERVICE(service), NULL);
+  return service->object_path;
+}
+
 const gchar *connman_service_get_name(ConnmanService *service)
 {
   g_return_val_if_fail(CONNMAN_IS_SERVICE(service), NULL);
   return service->name;
 }
 
+guint connman_service_get_state(ConnmanService *service)
+{
+  g_return_val_if_fail(CONNMAN_IS_SERVICE(service), CONNMAN_SERVICE_STATE_UNKNOWN);
+  return service->state;
+}
+
 guint connman_service_get_strength(ConnmanService *service)
 {
   g_return_val_if_fail(CONNMAN_IS_SERVICE(service), CONNMAN_SERVICE_TYPE_UNKNOWN);
@@ -191,6 +835,10 @@ gboolean connman_service_type_ethernet(ConnmanService *service)
 static void
 connman_service_init (ConnmanService *service)
 {
+  service->raw = g_hash_table_new_full(g_str_hash, g_str_equal, g_free,
+                                       (GDestroyNotify) g_variant_unref);
+
+  connman_stats_object_new(CONNMAN_STATS_OBJECT_SERVICE, sizeof(ConnmanService));
 }
 
 static void
@@ -198,12 +846,31 @@ connman_service_finalize (GObject *object)
 {
   ConnmanService *service = CONNMAN_SERVICE(object);
 
+  CONNMAN_TRACE2(service_destroy, service->object_path, service);
+
+  while (service->filters)
+    connman_service_remove_filter(service, service->filters->data);
+
+  connman_stats_string_replaced(CONNMAN_STATS_OBJECT_SERVICE, service->object_path, NULL);
   g_free(service->object_path);
   service->object_path = NULL;
   
+  connman_stats_string_replaced(CONNMAN_STATS_OBJECT_SERVICE, service->name, NULL);
   g_free(service->name);
   service->name = NULL;
 
+  g_hash_table_destroy(service->raw);
+  service->raw = NULL;
+
+  if (service->attrs)
+    {
+      connman_stats_variant_replaced(CONNMAN_STATS_OBJECT_SERVICE, service->attrs, NULL);
+      g_variant_unref(service->attrs);
+      service->attrs = NULL;
+    }
+
+  connman_stats_object_free(CONNMAN_STATS_OBJECT_SERVICE, sizeof(ConnmanService));
+
   G_OBJECT_CLASS (parent_class)->finalize (object);
 }
 
@@ -211,6 +878,7 @@ static void
 connman_service_class_init (ConnmanServiceClass *klass)
 {
   GObjectClass *object_class;
+  guint i;
 
   parent_class = (GObjectClass *) g_type_class_peek_parent (klass);
   object_class = (GObjectClass *) klass;
@@ -218,6 +886,64 @@ connman_service_class_init (ConnmanServiceClass *klass)
   object_class->get_property = connman_service_get_property;
   object_class->set_property = connman_service_set_property;
   object_class->finalize = connman_service_finalize;
+
+  props[PROP_NAME] =
+    g_param_spec_string("name", "Name", "Service name, the SSID for wifi",
+                        NULL, G_PARAM_READABLE | G_PARAM_STATIC_STRINGS);
+  props[PROP_TYPE] =
+    g_param_spec_int("type", "Type", "CONNMAN_SERVICE_TYPE_* value",
+                     CONNMAN_SERVICE_TYPE_UNKNOWN, CONNMAN_SERVICE_TYPE_MAX,
+                     CONNMAN_SERVICE_TYPE_UNKNOWN,
+                     G_PARAM_READABLE | G_PARAM_STATIC_STRINGS);
+  props[PROP_STATE] =
+    g_param_spec_uint("state", "State", "CONNMAN_SERVICE_STATE_* value",
+                      CONNMAN_SERVICE_STATE_UNKNOWN, CONNMAN_SERVICE_STATE_MAX,
+                      CONNMAN_SERVICE_STATE_UNKNOWN,
+                      G_PARAM_READABLE | G_PARAM_STATIC_STRINGS);
+  props[PROP_STRENGTH] =
+    g_param_spec_uint("strength", "Strength", "Signal strength",
+                      0, G_MAXUINT8, 0,
+                      G_PARAM_READABLE | G_PARAM_STATIC_STRINGS);
+  props[PROP_FAVORITE] =
+    g_param_spec_boolean("favorite", "Favorite", "Service was connected before",
+                         FALSE, G_PARAM_READABLE | G_PARAM_STATIC_STRINGS);
+  props[PROP_AUTO_CONNECT] =
+    g_param_spec_boolean("auto-connect", "AutoConnect", "Service connects automatically",
+                         FALSE, G_PARAM_READABLE | G_PARAM_STATIC_STRINGS);
+  props[PROP_IMMUTABLE] =
+    g_param_spec_boolean("immutable", "Immutable", "Service is provisioned and read-only",
+                         FALSE, G_PARAM_READABLE | G_PARAM_STATIC_STRINGS);
+  props[PROP_LOGIN_REQUIRED] =
+    g_param_spec_boolean("login-required", "LoginRequired", "Service needs a web login",
+                         FALSE, G_PARAM_READABLE | G_PARAM_STATIC_STRINGS);
+  props[PROP_PASSPHRASE_REQUIRED] =
+    g_param_spec_boolean("passphrase-required", "PassphraseRequired", "Service needs a passphrase",
+                         FALSE, G_PARAM_READABLE | G_PARAM_STATIC_STRINGS);
+  props[PROP_OBJECT_PATH] =
+    g_param_spec_string("object-path", "Object path", "D-Bus object path of the service",
+                        NULL, G_PARAM_READWRITE | G_PARAM_CONSTRUCT_ONLY | G_PARAM_STATIC_STRINGS);
+
+  g_object_class_install_properties(object_class, PROP_LAST, props);
+
+  for (i = 0; i < G_N_ELEMENTS(field_names); i++)
+    field_quarks[i] = g_quark_from_static_string(field_names[i]);
+
+  /**
+   * ConnmanService::changed:
+   * @service: the service
+   * @field: the CONNMAN_SERVICE_FIELD_* bit that changed
+   *
+   * Emitted once for every field whose value actually changed during
+   * an update. The signal detail is the field name, so listeners can
+   * connect to e.g. "changed::strength" only.
+   */
+  signals[SIGNAL_CHANGED] =
+    g_signal_new("changed",
+                 G_TYPE_FROM_CLASS(klass),
+                 G_SIGNAL_RUN_LAST | G_SIGNAL_DETAILED,
+                 0, NULL, NULL,
+                 g_cclosure_marshal_VOID__UINT,
+                 G_TYPE_NONE, 1, G_TYPE_UINT);
 }
 
 G_DEFINE_TYPE (ConnmanService, connman_service, G_TYPE_OBJECT)
@@ -6,8 +6,13 @@
 
 G_BEGIN_DECLS
 
-typedef struct _ConnmanService      ConnmanService;
-typedef struct _ConnmanServiceClass ConnmanServiceClass;
+typedef struct _ConnmanService       ConnmanService;
+typedef struct _ConnmanServiceClass  ConnmanServiceClass;
+typedef struct _ConnmanServiceFilter ConnmanServiceFilter;
+
+typedef void (*ConnmanServiceFilterFunc) (ConnmanService *service,
+                                          guint fields,
+                                          gpointer user_data);
 
 enum {
   CONNMAN_SERVICE_TYPE_UNKNOWN = 0,
@@ -16,11 +21,39 @@ enum {
   CONNMAN_SERVICE_TYPE_MAX = CONNMAN_SERVICE_TYPE_WIFI
 };
 
+enum {
+  CONNMAN_SERVICE_STATE_UNKNOWN = 0,
+  CONNMAN_SERVICE_STATE_IDLE,
+  CONNMAN_SERVICE_STATE_FAILURE,
+  CONNMAN_SERVICE_STATE_ASSOCIATION,
+  CONNMAN_SERVICE_STATE_CONFIGURATION,
+  CONNMAN_SERVICE_STATE_READY,
+  CONNMAN_SERVICE_STATE_ONLINE,
+  CONNMAN_SERVICE_STATE_DISCONNECT,
+  CONNMAN_SERVICE_STATE_MAX = CONNMAN_SERVICE_STATE_DISCONNECT
+};
+
+/* one bit per modelled field, as reported by connman_service_update() */
+enum {
+  CONNMAN_SERVICE_FIELD_NAME                = 1 << 0,
+  CONNMAN_SERVICE_FIELD_TYPE                = 1 << 1,
+  CONNMAN_SERVICE_FIELD_STATE               = 1 << 2,
+  CONNMAN_SERVICE_FIELD_STRENGTH            = 1 << 3,
+  CONNMAN_SERVICE_FIELD_FAVORITE            = 1 << 4,
+  CONNMAN_SERVICE_FIELD_AUTO_CONNECT        = 1 << 5,
+  CONNMAN_SERVICE_FIELD_IMMUTABLE           = 1 << 6,
+  CONNMAN_SERVICE_FIELD_LOGIN_REQUIRED      = 1 << 7,
+  CONNMAN_SERVICE_FIELD_PASSPHRASE_REQUIRED = 1 << 8,
+  CONNMAN_SERVICE_FIELD_ALL                 = (1 << 9) - 1
+};
+
 struct _ConnmanServiceClass {
   GObjectClass parent_class;
 };
 
+const gchar *connman_service_get_object_path(ConnmanService *service);
 const gchar *connman_service_get_name(ConnmanService *service);
+guint connman_service_get_state(ConnmanService *service);
 guint connman_service_get_strength(ConnmanService *service);
 gboolean connman_service_login_required(ConnmanService *service);
 gboolean connman_service_passphrase_required(ConnmanService *service);
@@ -31,6 +64,39 @@ gboolean connman_service_type_ethernet(ConnmanService *service);
 
 gboolean connman_service_has_object_path(ConnmanService *service,
                                          const gchar *path);
+guint connman_service_update_property(ConnmanService *service,
+                                      const gchar *key,
+                                      GVariant *value);
+guint connman_service_update(ConnmanService *service,
+                             GVariant *attrs);
+GVariant *connman_service_lookup_raw(ConnmanService *service,
+                                     const gchar *key);
+GVariant *connman_service_dup_attributes(ConnmanService *service);
+const gchar *connman_service_get_security(ConnmanService *service);
+gint64 connman_service_get_last_update(ConnmanService *service);
+gint64 connman_service_get_last_seen(ConnmanService *service);
+void connman_service_set_last_seen(ConnmanService *service,
+                                   gint64 time);
+gint connman_service_compare_eviction(gconstpointer a,
+                                      gconstpointer b);
+guint connman_service_get_dirty(ConnmanService *service);
+guint connman_service_take_dirty(ConnmanService *service);
+guint64 connman_service_get_generation(ConnmanService *service);
+
+ConnmanServiceFilter *connman_service_filter_new(guint fields,
+                                                 ConnmanServiceFilterFunc func,
+                                                 gpointer user_data,
+                                                 GDestroyNotify destroy);
+ConnmanServiceFilter *connman_service_filter_ref(ConnmanServiceFilter *filter);
+void connman_service_filter_unref(ConnmanServiceFilter *filter);
+void connman_service_filter_set_strength_deadband(ConnmanServiceFilter *filter,
+                                                  guint deadband);
+void connman_service_filter_set_min_interval(ConnmanServiceFilter *filter,
+                                             guint msec);
+void connman_service_add_filter(ConnmanService *service,
+                                ConnmanServiceFilter *filter);
+void connman_service_remove_filter(ConnmanService *service,
+                                   ConnmanServiceFilter *filter);
 ConnmanService *connman_service_new(GVariant *variant);
 
 GType connman_service_get_type (void);
@@ -0,0 +1,396 @@
+/*
+ *  Connection Session example
+ *
+ *  Copyright (C) 2011  Daniel Mack <daniel@zonque.org>
+ *
+ *  This program is free software; you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License version 2 as
+ *  published by the Free Software Foundation.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program; if not, write to the Free Software
+ *  Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+
+
+#include <glib.h>
+#include <gio/gio.h>
+
+#include "connman-export.h"
+#include "connman-generated.h"
+#include "connman-log.h"
+#include "connman-session.h"
+
+/*
+ * One ConnMan session, i.e. the connectivity policy of one application.
+ * ConnMan pushes the session settings to our net.connman.Notification
+ * object whenever they change; they are merged into a local table so
+ * routing decisions never have to ask the daemon.
+ */
+struct _ConnmanSession {
+  GObject parent;
+
+  GDBusConnection *connection;
+  ConnmanExport *notifier;      /* only ConnMan may send updates */
+  gchar *notify_path;
+  GVariant *requested;          /* a{sv} passed to CreateSession */
+
+  ConnmanProxySession *proxy;   /* NULL while not attached to a daemon */
+
+  GHashTable *settings;         /* key -> GVariant, merged from Update */
+};
+
+static GObjectClass *parent_class = NULL;
+
+enum {
+  SIGNAL_UPDATED,
+  SIGNAL_RELEASED,
+  SIGNAL_LAST
+};
+
+static gint signals[SIGNAL_LAST];
+
+static void
+connman_session_get_property (GObject    *object,
+                              guint       property_id,
+                              GValue     *value,
+                              GParamSpec *pspec)
+{
+  switch (property_id)
+    {
+      default:
+        G_OBJECT_WARN_INVALID_PROPERTY_ID (object, property_id, pspec);
+    }
+}
+
+static void
+connman_session_set_property (GObject      *object,
+                              guint         property_id,
+                              const GValue *value,
+                              GParamSpec   *pspec)
+{
+  switch (property_id)
+    {
+      default:
+        G_OBJECT_WARN_INVALID_PROPERTY_ID (object, property_id, pspec);
+    }
+}
+
+/* Update only carries the settings that changed */
+static gboolean
+handle_update(ConnmanProxyNotification *notifier,
+              GDBusMethodInvocation *invocation,
+              GVariant *settings,
+              gpointer user_data)
+{
+  ConnmanSession *session = CONNMAN_SESSION(user_data);
+  GVariantIter iter;
+  GVariant *value;
+  const gchar *key;
+
+  if (!connman_export_check_caller(session->notifier, invocation))
+    return TRUE;
+
+  g_variant_iter_init(&iter, settings);
+  while (g_variant_iter_loop(&iter, "{&sv}", &key, &value))
+    g_hash_table_insert(session->settings, g_strdup(key), g_variant_ref(value));
+
+  connman_debug(session->notify_path, "%d settings updated, state '%s'",
+                (gint) g_variant_n_children(settings),
+                connman_session_get_state(session));
+
+  g_signal_emit(session, signals[SIGNAL_UPDATED], 0, settings);
+  connman_proxy_notification_complete_update(notifier, invocation);
+
+  return TRUE;
+}
+
+static gboolean
+handle_release(ConnmanProxyNotification *notifier,
+               GDBusMethodInvocation *invocation,
+               gpointer user_data)
+{
+  ConnmanSession *session = CONNMAN_SESSION(user_data);
+
+  if (!connman_export_check_caller(session->notifier, invocation))
+    return TRUE;
+
+  connman_info(session->notify_path, "session released by ConnMan");
+  connman_session_detach(session);
+
+  g_signal_emit(session, signals[SIGNAL_RELEASED], 0);
+  connman_proxy_notification_complete_release(notifier, invocation);
+
+  return TRUE;
+}
+
+/* the session object ConnMan created for us, or NULL if there is none */
+const gchar *connman_session_get_object_path(ConnmanSession *session)
+{
+  g_return_val_if_fail(CONNMAN_IS_SESSION(session), NULL);
+
+  if (!session->proxy)
+    return NULL;
+
+  return g_dbus_proxy_get_object_path(G_DBUS_PROXY(session->proxy));
+}
+
+const gchar *connman_session_get_notify_path(ConnmanSession *session)
+{
+  g_return_val_if_fail(CONNMAN_IS_SESSION(session), NULL);
+  return session->notify_path;
+}
+
+GVariant *connman_session_get_requested_settings(ConnmanSession *session)
+{
+  g_return_val_if_fail(CONNMAN_IS_SESSION(session), NULL);
+  return session->requested;
+}
+
+/*
+ * Look up a session setting as last reported by ConnMan. The value is
+ * borrowed and stays valid until the next update of that key.
+ */
+GVariant *connman_session_lookup_setting(ConnmanSession *session,
+                                         const gchar *key)
+{
+  g_return_val_if_fail(CONNMAN_IS_SESSION(session), NULL);
+  g_return_val_if_fail(key != NULL, NULL);
+
+  return g_hash_table_lookup(session->settings, key);
+}
+
+static const gchar *
+session_lookup_string(ConnmanSession *session,
+                      const gchar *key)
+{
+  GVariant *value = connman_session_lookup_setting(session, key);
+
+  if (!value || !g_variant_is_of_type(value, G_VARIANT_TYPE_STRING))
+    return NULL;
+
+  return g_variant_get_string(value, NULL);
+}
+
+/* "disconnected", "connected" or "online" */
+const gchar *connman_session_get_state(ConnmanSession *session)
+{
+  return session_lookup_string(session, "State");
+}
+
+const gchar *connman_session_get_bearer(ConnmanSession *session)
+{
+  return session_lookup_string(session, "Bearer");
+}
+
+const gchar *connman_session_get_interface(ConnmanSession *session)
+{
+  return session_lookup_string(session, "Interface");
+}
+
+const gchar *connman_session_get_ipv4_address(ConnmanSession *session)
+{
+  GVariant *ipv4 = connman_session_lookup_setting(session, "IPv4");
+  const gchar *address = NULL;
+
+  if (ipv4 && g_variant_is_of_type(ipv4, G_VARIANT_TYPE("a{sv}")))
+    g_variant_lookup(ipv4, "Address", "&s", &address);
+
+  return address;
+}
+
+gboolean connman_session_is_online(ConnmanSession *session)
+{
+  return g_strcmp0(connman_session_get_state(session), "online") == 0;
+}
+
+static gboolean
+session_check_attached(ConnmanSession *session,
+                       GError **error)
+{
+  if (session->proxy)
+    return TRUE;
+
+  g_set_error(error, G_IO_ERROR, G_IO_ERROR_NOT_FOUND,
+              "Session %s is not known to ConnMan", session->notify_path);
+  return FALSE;
+}
+
+gboolean connman_session_connect(ConnmanSession *session,
+                                 GError **error)
+{
+  g_return_val_if_fail(CONNMAN_IS_SESSION(session), FALSE);
+
+  if (!session_check_attached(session, error))
+    return FALSE;
+
+  return connman_proxy_session_call_connect_sync(session->proxy, NULL, error);
+}
+
+gboolean connman_session_disconnect(ConnmanSession *session,
+                                    GError **error)
+{
+  g_return_val_if_fail(CONNMAN_IS_SESSION(session), FALSE);
+
+  if (!session_check_attached(session, error))
+    return FALSE;
+
+  return connman_proxy_session_call_disconnect_sync(session->proxy, NULL, error);
+}
+
+/*
+ * Change one policy setting ("AllowedBearers", "ConnectionType", ...).
+ * The local table follows once ConnMan confirms with an Update.
+ */
+gboolean connman_session_change(ConnmanSession *session,
+                                const gchar *key,
+                                GVariant *value,
+                                GError **error)
+{
+  g_return_val_if_fail(CONNMAN_IS_SESSION(session), FALSE);
+  g_return_val_if_fail(key != NULL, FALSE);
+  g_return_val_if_fail(value != NULL, FALSE);
+
+  if (!session_check_attached(session, error))
+    {
+      g_variant_unref(g_variant_ref_sink(value));
+      return FALSE;
+    }
+
+  return connman_proxy_session_call_change_sync(session->proxy, key,
+                                                g_variant_new_variant(value),
+                                                NULL, error);
+}
+
+/* bind the session to the object ConnMan returned from CreateSession */
+gboolean connman_session_attach(ConnmanSession *session,
+                                const gchar *object_path,
+                                GError **error)
+{
+  g_return_val_if_fail(CONNMAN_IS_SESSION(session), FALSE);
+
+  connman_session_detach(session);
+
+  session->proxy =
+    connman_proxy_session_proxy_new_sync(session->connection,
+                                         G_DBUS_PROXY_FLAGS_DO_NOT_LOAD_PROPERTIES |
+                                         G_DBUS_PROXY_FLAGS_DO_NOT_CONNECT_SIGNALS,
+                                         "net.connman", object_path,
+                                         NULL, error);
+
+  return session->proxy != NULL;
+}
+
+/* the daemon dropped the session; settings are kept until it is recreated */
+void connman_session_detach(ConnmanSession *session)
+{
+  g_return_if_fail(CONNMAN_IS_SESSION(session));
+
+  if (session->proxy)
+    {
+      g_object_unref(session->proxy);
+      session->proxy = NULL;
+    }
+}
+
+/*
+ * Export the notification object at @notify_path. The session only
+ * becomes usable once ConnmanManager created it on the daemon side and
+ * attached it.
+ */
+ConnmanSession *connman_session_new(GDBusConnection *connection,
+                                    const gchar *notify_path,
+                                    GVariant *settings,
+                                    GError **error)
+{
+  ConnmanSession *session = g_object_new(CONNMAN_TYPE_SESSION, NULL);
+  ConnmanProxyNotification *notifier;
+
+  session->connection = g_object_ref(connection);
+  session->notify_path = g_strdup(notify_path);
+  session->requested = g_variant_ref_sink(settings);
+
+  notifier = connman_proxy_notification_skeleton_new();
+
+  g_signal_connect(notifier, "handle-update",
+                   G_CALLBACK(handle_update), session);
+  g_signal_connect(notifier, "handle-release",
+                   G_CALLBACK(handle_release), session);
+
+  session->notifier = connman_export_new(connection,
+                                         G_DBUS_INTERFACE_SKELETON(notifier),
+                                         notify_path, "session", session, error);
+  if (!session->notifier)
+    {
+      g_object_unref(session);
+      return NULL;
+    }
+
+  connman_debug(notify_path, "new session %p", session);
+
+  return session;
+}
+
+static void
+connman_session_init (ConnmanSession *session)
+{
+  session->settings = g_hash_table_new_full(g_str_hash, g_str_equal, g_free,
+                                            (GDestroyNotify) g_variant_unref);
+}
+
+static void
+connman_session_finalize (GObject *object)
+{
+  ConnmanSession *session = CONNMAN_SESSION(object);
+
+  connman_session_detach(session);
+
+  connman_export_free(session->notifier);
+
+  if (session->requested)
+    g_variant_unref(session->requested);
+
+  g_object_unref(session->connection);
+  g_hash_table_destroy(session->settings);
+  g_free(session->notify_path);
+
+  G_OBJECT_CLASS (parent_class)->finalize (object);
+}
+
+static void
+connman_session_class_init (ConnmanSessionClass *klass)
+{
+  GObjectClass *object_class;
+
+  parent_class = (GObjectClass *) g_type_class_peek_parent (klass);
+  object_class = (GObjectClass *) klass;
+
+  object_class->get_property = connman_session_get_property;
+  object_class->set_property = connman_session_set_property;
+  object_class->finalize = connman_session_finalize;
+
+  /* carries the a{sv} of changed settings */
+  signals[SIGNAL_UPDATED] =
+    g_signal_new("updated",
+                 G_TYPE_FROM_CLASS(klass),
+                 G_SIGNAL_RUN_LAST,
+                 0, NULL, NULL,
+                 g_cclosure_marshal_VOID__VARIANT,
+                 G_TYPE_NONE, 1, G_TYPE_VARIANT);
+
+  signals[SIGNAL_RELEASED] =
+    g_signal_new("released",
+                 G_TYPE_FROM_CLASS(klass),
+                 G_SIGNAL_RUN_LAST,
+                 0, NULL, NULL,
+                 g_cclosure_marshal_VOID__VOID,
+                 G_TYPE_NONE, 0);
+}
+
+G_DEFINE_TYPE (ConnmanSession, connman_session, G_TYPE_OBJECT)
+
@@ -0,0 +1,58 @@
+#ifndef CONNMAN_SESSION_H_
+#define CONNMAN_SESSION_H_
+
+#include <gio/gio.h>
+#include <glib-object.h>
+
+G_BEGIN_DECLS
+
+typedef struct _ConnmanSession      ConnmanSession;
+typedef struct _ConnmanSessionClass ConnmanSessionClass;
+
+struct _ConnmanSessionClass {
+  GObjectClass parent_class;
+};
+
+const gchar *connman_session_get_object_path(ConnmanSession *session);
+const gchar *connman_session_get_notify_path(ConnmanSession *session);
+GVariant *connman_session_get_requested_settings(ConnmanSession *session);
+
+GVariant *connman_session_lookup_setting(ConnmanSession *session,
+                                         const gchar *key);
+const gchar *connman_session_get_state(ConnmanSession *session);
+const gchar *connman_session_get_bearer(ConnmanSession *session);
+const gchar *connman_session_get_interface(ConnmanSession *session);
+const gchar *connman_session_get_ipv4_address(ConnmanSession *session);
+gboolean connman_session_is_online(ConnmanSession *session);
+
+gboolean connman_session_connect(ConnmanSession *session,
+                                 GError **error);
+gboolean connman_session_disconnect(ConnmanSession *session,
+                                    GError **error);
+gboolean connman_session_change(ConnmanSession *session,
+                                const gchar *key,
+                                GVariant *value,
+                                GError **error);
+
+/* used by ConnmanManager, see connman_manager_create_session() */
+ConnmanSession *connman_session_new(GDBusConnection *connection,
+                                    const gchar *notify_path,
+                                    GVariant *settings,
+                                    GError **error);
+gboolean connman_session_attach(ConnmanSession *session,
+                                const gchar *object_path,
+                                GError **error);
+void connman_session_detach(ConnmanSession *session);
+
+GType connman_session_get_type (void);
+#define CONNMAN_TYPE_SESSION             connman_session_get_type()
+#define CONNMAN_SESSION(obj)             (G_TYPE_CHECK_INSTANCE_CAST ((obj), CONNMAN_TYPE_SESSION, ConnmanSession))
+#define CONNMAN_SESSION_CLASS(klass)     (G_TYPE_CHECK_CLASS_CAST ((klass), CONNMAN_TYPE_SESSION, ConnmanSessionClass))
+#define CONNMAN_IS_SESSION(obj)          (G_TYPE_CHECK_INSTANCE_TYPE ((obj), CONNMAN_TYPE_SESSION))
+#define CONNMAN_IS_SESSION_CLASS(klass)  (G_TYPE_CHECK_CLASS_TYPE ((klass), CONNMAN_TYPE_SESSION))
+#define CONNMAN_SESSION_GET_CLASS(obj)   (G_TYPE_INSTANCE_GET_CLASS ((obj), CONNMAN_TYPE_SESSION, ConnmanSessionClass))
+
+G_END_DECLS
+
+
+#endif /* CONNMAN_SESSION_H_ */
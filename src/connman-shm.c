@@ -0,0 +1,244 @@
+/*
+ *  Connection Manager example
+ *
+ *  Copyright (C) 2011  Daniel Mack <daniel@zonque.org>
+ *
+ *  This program is free software; you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License version 2 as
+ *  published by the Free Software Foundation.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program; if not, write to the Free Software
+ *  Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+
+#include <errno.h>
+#include <fcntl.h>
+#include <string.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+
+#include <glib.h>
+
+#include "connman-seqlock.h"
+#include "connman-shm.h"
+
+/*
+ * A writer that died halfway through an update leaves the counter odd
+ * for good, so readers give up after this many attempts.
+ */
+#define MAX_READ_ATTEMPTS 1000
+
+/*
+ * The segment is protected by a sequence lock: the writer makes the
+ * counter odd before touching the tables and even again afterwards.
+ * Readers copy the tables and retry if the counter was odd or moved
+ * meanwhile, so the read path is a plain memcpy without syscalls or
+ * locks, and a stalled reader can never block the writer.
+ */
+
+struct _ConnmanShmWriter {
+  gchar *name;
+  ConnmanShmHeader *header;
+  gsize size;
+};
+
+struct _ConnmanShmReader {
+  ConnmanShmHeader *header;
+  gsize map_size;
+  gsize size;
+  guint max_services;           /* as validated at open time */
+  ConnmanShmHeader *copy;
+};
+
+static gsize segment_size(guint max_services)
+{
+  return sizeof(ConnmanShmHeader) + max_services * sizeof(ConnmanShmService);
+}
+
+ConnmanShmWriter *connman_shm_writer_new(const gchar *name,
+                                         guint max_services)
+{
+  ConnmanShmWriter *writer;
+  gpointer map;
+  gsize size;
+  int fd;
+
+  g_return_val_if_fail(name != NULL, NULL);
+  g_return_val_if_fail(max_services > 0, NULL);
+
+  size = segment_size(max_services);
+
+  fd = shm_open(name, O_CREAT | O_RDWR, 0644);
+  if (fd < 0)
+    {
+      g_warning("Unable to open shared memory %s: %s", name, g_strerror(errno));
+      return NULL;
+    }
+
+  if (ftruncate(fd, size) < 0)
+    {
+      g_warning("Unable to size shared memory %s: %s", name, g_strerror(errno));
+      close(fd);
+      shm_unlink(name);
+      return NULL;
+    }
+
+  map = mmap(NULL, size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+  close(fd);
+
+  if (map == MAP_FAILED)
+    {
+      g_warning("Unable to map shared memory %s: %s", name, g_strerror(errno));
+      shm_unlink(name);
+      return NULL;
+    }
+
+  writer = g_slice_new0(ConnmanShmWriter);
+  writer->name = g_strdup(name);
+  writer->header = map;
+  writer->size = size;
+
+  memset(writer->header, 0, size);
+  writer->header->version = CONNMAN_SHM_VERSION;
+  writer->header->max_services = max_services;
+
+  /* readers check the magic last, so it goes in once the rest is set */
+  g_atomic_int_set(&writer->header->magic, CONNMAN_SHM_MAGIC);
+
+  return writer;
+}
+
+void connman_shm_writer_free(ConnmanShmWriter *writer)
+{
+  if (!writer)
+    return;
+
+  munmap(writer->header, writer->size);
+  shm_unlink(writer->name);
+  g_free(writer->name);
+  g_slice_free(ConnmanShmWriter, writer);
+}
+
+/*
+ * Open a write section. The returned header may be filled freely
+ * until connman_shm_writer_commit() is called.
+ */
+ConnmanShmHeader *connman_shm_writer_begin(ConnmanShmWriter *writer)
+{
+  g_return_val_if_fail(writer != NULL, NULL);
+
+  /* odd: tables are in flux */
+  connman_seqlock_write_begin(&writer->header->seq);
+
+  return writer->header;
+}
+
+void connman_shm_writer_commit(ConnmanShmWriter *writer)
+{
+  g_return_if_fail(writer != NULL);
+  g_return_if_fail(writer->header->seq & 1);
+
+  /* even again: consistent */
+  connman_seqlock_write_end(&writer->header->seq);
+}
+
+ConnmanShmReader *connman_shm_reader_open(const gchar *name)
+{
+  ConnmanShmReader *reader;
+  ConnmanShmHeader *header;
+  struct stat st;
+  gpointer map;
+  int fd;
+
+  g_return_val_if_fail(name != NULL, NULL);
+
+  fd = shm_open(name, O_RDONLY, 0);
+  if (fd < 0)
+    return NULL;
+
+  if (fstat(fd, &st) < 0 || (gsize) st.st_size < sizeof(ConnmanShmHeader))
+    {
+      close(fd);
+      return NULL;
+    }
+
+  map = mmap(NULL, st.st_size, PROT_READ, MAP_SHARED, fd, 0);
+  close(fd);
+
+  if (map == MAP_FAILED)
+    return NULL;
+
+  header = map;
+  if (g_atomic_int_get(&header->magic) != CONNMAN_SHM_MAGIC ||
+      header->version != CONNMAN_SHM_VERSION ||
+      segment_size(header->max_services) > (gsize) st.st_size)
+    {
+      munmap(map, st.st_size);
+      return NULL;
+    }
+
+  reader = g_slice_new0(ConnmanShmReader);
+  reader->header = header;
+  reader->map_size = st.st_size;
+  reader->max_services = header->max_services;
+  reader->size = segment_size(reader->max_services);
+  reader->copy = g_malloc(reader->size);
+
+  return reader;
+}
+
+void connman_shm_reader_close(ConnmanShmReader *reader)
+{
+  if (!reader)
+    return;
+
+  munmap(reader->header, reader->map_size);
+  g_free(reader->copy);
+  g_slice_free(ConnmanShmReader, reader);
+}
+
+/*
+ * Take a consistent copy of the published state: the header and the
+ * n_services records in use. The result is owned by the reader and
+ * stays valid until the next call. Returns NULL if no consistent copy
+ * could be taken, e.g. because the writer died in the middle of an
+ * update.
+ */
+const ConnmanShmHeader *connman_shm_reader_read(ConnmanShmReader *reader)
+{
+  guint attempt;
+  gint seq;
+
+  g_return_val_if_fail(reader != NULL, NULL);
+
+  for (attempt = 0; attempt < MAX_READ_ATTEMPTS; attempt++)
+    {
+      guint n;
+
+      seq = connman_seqlock_read_begin(&reader->header->seq);
+      if (seq & 1)
+        {
+          g_thread_yield();
+          continue;
+        }
+
+      /* a torn count is caught by the sequence check below */
+      n = MIN(reader->header->n_services, reader->max_services);
+      memcpy(reader->copy, reader->header, segment_size(n));
+
+      if (!connman_seqlock_read_retry(&reader->header->seq, seq))
+        {
+          reader->copy->n_services = n;
+          return reader->copy;
+        }
+    }
+
+  return NULL;
+}
@@ -0,0 +1,75 @@
+#ifndef CONNMAN_SHM_H_
+#define CONNMAN_SHM_H_
+
+#include <glib.h>
+
+G_BEGIN_DECLS
+
+/*
+ * Flat, fixed-size layout of the shared-memory state export. Strings
+ * are NUL terminated and truncated to fit.
+ */
+#define CONNMAN_SHM_NAME            "/connman-state"
+#define CONNMAN_SHM_MAGIC           0x434d5348 /* "CMSH" */
+#define CONNMAN_SHM_VERSION         1
+
+#define CONNMAN_SHM_PATH_LEN        128
+#define CONNMAN_SHM_SSID_LEN        64
+#define CONNMAN_SHM_TYPE_LEN        16
+#define CONNMAN_SHM_MAX_TECHNOLOGIES 8
+
+/* ConnmanShmService.flags */
+enum {
+  CONNMAN_SHM_SERVICE_FAVORITE            = 1 << 0,
+  CONNMAN_SHM_SERVICE_AUTO_CONNECT        = 1 << 1,
+  CONNMAN_SHM_SERVICE_IMMUTABLE           = 1 << 2,
+  CONNMAN_SHM_SERVICE_LOGIN_REQUIRED      = 1 << 3,
+  CONNMAN_SHM_SERVICE_PASSPHRASE_REQUIRED = 1 << 4
+};
+
+typedef struct {
+  gchar object_path[CONNMAN_SHM_PATH_LEN];
+  gchar name[CONNMAN_SHM_SSID_LEN];
+  guint32 type;                 /* CONNMAN_SERVICE_TYPE_* */
+  guint32 state;                /* CONNMAN_SERVICE_STATE_* */
+  guint32 strength;
+  guint32 flags;
+  guint64 generation;
+} ConnmanShmService;
+
+typedef struct {
+  gchar type[CONNMAN_SHM_TYPE_LEN];
+} ConnmanShmTechnology;
+
+typedef struct {
+  gint magic;
+  guint32 version;
+  gint seq;                     /* sequence lock, odd while writing */
+  guint32 max_services;
+
+  guint32 online;
+  guint32 n_technologies;
+  guint32 n_services;
+  guint32 reserved;
+
+  ConnmanShmTechnology technologies[CONNMAN_SHM_MAX_TECHNOLOGIES];
+  ConnmanShmService services[];
+} ConnmanShmHeader;
+
+typedef struct _ConnmanShmWriter ConnmanShmWriter;
+typedef struct _ConnmanShmReader ConnmanShmReader;
+
+ConnmanShmWriter *connman_shm_writer_new(const gchar *name,
+                                         guint max_services);
+void connman_shm_writer_free(ConnmanShmWriter *writer);
+ConnmanShmHeader *connman_shm_writer_begin(ConnmanShmWriter *writer);
+void connman_shm_writer_commit(ConnmanShmWriter *writer);
+
+ConnmanShmReader *connman_shm_reader_open(const gchar *name);
+void connman_shm_reader_close(ConnmanShmReader *reader);
+const ConnmanShmHeader *connman_shm_reader_read(ConnmanShmReader *reader);
+
+G_END_DECLS
+
+
+#endif /* CONNMAN_SHM_H_ */
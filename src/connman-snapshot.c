@@ -0,0 +1,201 @@
+/*
+ *  Connection Manager example
+ *
+ *  Copyright (C) 2011  Daniel Mack <daniel@zonque.org>
+ *
+ *  This program is free software; you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License version 2 as
+ *  published by the Free Software Foundation.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program; if not, write to the Free Software
+ *  Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+
+#include <string.h>
+
+#include <glib.h>
+
+#include "connman-log.h"
+#include "connman-snapshot.h"
+
+/*
+ * On-disk layout: a fixed header followed by the serialised GVariant
+ * of the service list, in exactly the a(oa{sv}) form GetServices
+ * returns. The payload starts 8-byte aligned, so it can be used
+ * straight from the mapping without copying or parsing.
+ *
+ * The file is a host-local cache and is written in native byte
+ * order; a file from a foreign host fails the version check.
+ */
+#define SNAPSHOT_MAGIC   "CMSNAP\0\0"
+#define SNAPSHOT_VERSION 1
+
+#define SNAPSHOT_FLAG_ONLINE (1 << 0)
+
+typedef struct {
+  gchar magic[8];
+  guint32 version;
+  guint32 flags;
+  gint64 timestamp;             /* wall clock, usec */
+  guint64 payload_size;
+  guint8 checksum[16];          /* MD5 of the payload */
+} SnapshotHeader;
+
+struct _ConnmanSnapshot {
+  GMappedFile *file;
+  GVariant *services;
+  gboolean online;
+  gint64 timestamp;
+};
+
+static void snapshot_checksum(const guint8 *data,
+                              gsize size,
+                              guint8 *digest)
+{
+  GChecksum *checksum = g_checksum_new(G_CHECKSUM_MD5);
+  gsize len = 16;
+
+  g_checksum_update(checksum, data, size);
+  g_checksum_get_digest(checksum, digest, &len);
+  g_checksum_free(checksum);
+}
+
+/*
+ * Map and validate a snapshot. Returns NULL if the file is missing,
+ * truncated, from another version or fails its checksum.
+ */
+ConnmanSnapshot *connman_snapshot_load(const gchar *path)
+{
+  ConnmanSnapshot *snapshot;
+  const SnapshotHeader *header;
+  GMappedFile *file;
+  GError *error = NULL;
+  const guint8 *data;
+  guint8 digest[16];
+  gsize size;
+
+  g_return_val_if_fail(path != NULL, NULL);
+
+  file = g_mapped_file_new(path, FALSE, &error);
+  if (error)
+    {
+      connman_info(path, "No snapshot loaded: %s", error->message);
+      g_error_free(error);
+      return NULL;
+    }
+
+  data = (const guint8 *) g_mapped_file_get_contents(file);
+  size = g_mapped_file_get_length(file);
+  header = (const SnapshotHeader *) data;
+
+  if (size < sizeof(*header) ||
+      memcmp(header->magic, SNAPSHOT_MAGIC, sizeof(header->magic)) != 0 ||
+      header->version != SNAPSHOT_VERSION ||
+      header->payload_size != size - sizeof(*header))
+    {
+      connman_message(path, "Ignoring invalid snapshot");
+      g_mapped_file_unref(file);
+      return NULL;
+    }
+
+  snapshot_checksum(data + sizeof(*header), header->payload_size, digest);
+  if (memcmp(digest, header->checksum, sizeof(digest)) != 0)
+    {
+      connman_message(path, "Ignoring corrupt snapshot");
+      g_mapped_file_unref(file);
+      return NULL;
+    }
+
+  snapshot = g_slice_new0(ConnmanSnapshot);
+  snapshot->file = file;
+  snapshot->online = !!(header->flags & SNAPSHOT_FLAG_ONLINE);
+  snapshot->timestamp = header->timestamp;
+
+  /* the variant keeps its own reference on the mapping */
+  snapshot->services =
+    g_variant_new_from_data(G_VARIANT_TYPE("a(oa{sv})"),
+                            data + sizeof(*header), header->payload_size,
+                            FALSE,
+                            (GDestroyNotify) g_mapped_file_unref,
+                            g_mapped_file_ref(file));
+  g_variant_ref_sink(snapshot->services);
+
+  return snapshot;
+}
+
+void connman_snapshot_free(ConnmanSnapshot *snapshot)
+{
+  if (!snapshot)
+    return;
+
+  g_variant_unref(snapshot->services);
+  g_mapped_file_unref(snapshot->file);
+  g_slice_free(ConnmanSnapshot, snapshot);
+}
+
+/* borrowed, in the same a(oa{sv}) form GetServices returns */
+GVariant *connman_snapshot_get_services(ConnmanSnapshot *snapshot)
+{
+  g_return_val_if_fail(snapshot != NULL, NULL);
+  return snapshot->services;
+}
+
+gboolean connman_snapshot_get_online(ConnmanSnapshot *snapshot)
+{
+  g_return_val_if_fail(snapshot != NULL, FALSE);
+  return snapshot->online;
+}
+
+gint64 connman_snapshot_get_timestamp(ConnmanSnapshot *snapshot)
+{
+  g_return_val_if_fail(snapshot != NULL, 0);
+  return snapshot->timestamp;
+}
+
+/*
+ * Write @services (a(oa{sv})) and the online flag to @path. The file
+ * is replaced atomically, so readers never see a partial snapshot.
+ */
+gboolean connman_snapshot_write(const gchar *path,
+                                GVariant *services,
+                                gboolean online)
+{
+  SnapshotHeader *header;
+  GError *error = NULL;
+  guint8 *data;
+  gsize size;
+  gboolean ret;
+
+  g_return_val_if_fail(path != NULL, FALSE);
+  g_return_val_if_fail(g_variant_is_of_type(services, G_VARIANT_TYPE("a(oa{sv})")), FALSE);
+
+  size = sizeof(*header) + g_variant_get_size(services);
+  data = g_malloc0(size);
+  header = (SnapshotHeader *) data;
+
+  g_variant_store(services, data + sizeof(*header));
+
+  memcpy(header->magic, SNAPSHOT_MAGIC, sizeof(header->magic));
+  header->version = SNAPSHOT_VERSION;
+  header->flags = online ? SNAPSHOT_FLAG_ONLINE : 0;
+  header->timestamp = g_get_real_time();
+  header->payload_size = size - sizeof(*header);
+  snapshot_checksum(data + sizeof(*header), header->payload_size, header->checksum);
+
+  ret = g_file_set_contents(path, (const gchar *) data, size, &error);
+  if (error)
+    {
+      g_warning("Unable to write snapshot %s: %s", path, error->message);
+      g_error_free(error);
+    }
+
+  g_free(data);
+
+  return ret;
+}
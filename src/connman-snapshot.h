@@ -0,0 +1,24 @@
+#ifndef CONNMAN_SNAPSHOT_H_
+#define CONNMAN_SNAPSHOT_H_
+
+#include <glib.h>
+
+G_BEGIN_DECLS
+
+typedef struct _ConnmanSnapshot ConnmanSnapshot;
+
+ConnmanSnapshot *connman_snapshot_load(const gchar *path);
+void connman_snapshot_free(ConnmanSnapshot *snapshot);
+
+GVariant *connman_snapshot_get_services(ConnmanSnapshot *snapshot);
+gboolean connman_snapshot_get_online(ConnmanSnapshot *snapshot);
+gint64 connman_snapshot_get_timestamp(ConnmanSnapshot *snapshot);
+
+gboolean connman_snapshot_write(const gchar *path,
+                                GVariant *services,
+                                gboolean online);
+
+G_END_DECLS
+
+
+#endif /* CONNMAN_SNAPSHOT_H_ */
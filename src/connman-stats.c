@@ -0,0 +1,318 @@
+/*
+ *  Connection Manager example
+ *
+ *  Copyright (C) 2011  Daniel Mack <daniel@zonque.org>
+ *
+ *  This program is free software; you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License version 2 as
+ *  published by the Free Software Foundation.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program; if not, write to the Free Software
+ *  Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+
+#include <signal.h>
+#include <string.h>
+
+#include <glib.h>
+#include <glib-unix.h>
+
+#include "connman-stats.h"
+
+/*
+ * Log-linear latency buckets in the spirit of HdrHistogram: values
+ * below 16us get a bucket each, above that every power of two is
+ * split into 16 sub-buckets, which keeps the relative error under
+ * 7% up to over an hour. All counters are updated with atomic
+ * operations only, so recording never takes a lock.
+ */
+#define SUB_BITS     4
+#define SUB_BUCKETS  (1 << SUB_BITS)
+#define N_BUCKETS    (SUB_BUCKETS + (32 - SUB_BITS) * SUB_BUCKETS)
+
+typedef struct {
+  gint count;
+  gint errors;
+  gint max;                     /* usec */
+  gint buckets[N_BUCKETS];
+} Histogram;
+
+static const gchar *method_names[CONNMAN_STATS_LAST] = {
+  "Manager.GetProperties",
+  "Manager.GetServices",
+  "Manager.ConnectService",
+  "Technology.GetProperties",
+  "Technology.SetProperty",
+  "Service.Connect",
+  "Manager.RequestScan",
+  "Manager.ProvisionService",
+  "Clock.GetProperties",
+  "Manager.RegisterAgent",
+  "Manager.UnregisterAgent",
+  "Manager.RegisterCounter",
+  "Manager.UnregisterCounter",
+  "Manager.CreateSession",
+  "Manager.DestroySession",
+  "Manager.LookupService",
+};
+
+static Histogram histograms[CONNMAN_STATS_LAST];
+
+/*
+ * Memory accounting. Sizes are kept as gssize so they can be adjusted
+ * with g_atomic_pointer_add() from any thread.
+ */
+typedef struct {
+  gint live;
+  gssize object_bytes;
+  gssize string_bytes;
+  gssize variant_bytes;
+} Memory;
+
+static const gchar *object_names[CONNMAN_STATS_OBJECT_LAST] = {
+  "ConnmanService",
+  "ConnmanTechnology",
+  "ConnmanServiceFilter",
+  "filter state",
+  "service change",
+  "pending call",
+};
+
+static Memory memory[CONNMAN_STATS_OBJECT_LAST];
+
+static guint bucket_index(guint32 usec)
+{
+  guint e;
+
+  if (usec < SUB_BUCKETS)
+    return usec;
+
+  e = g_bit_storage(usec) - 1;
+  return SUB_BUCKETS + (e - SUB_BITS) * SUB_BUCKETS +
+         ((usec >> (e - SUB_BITS)) - SUB_BUCKETS);
+}
+
+/* highest value that falls into bucket @index */
+static guint64 bucket_value(guint index)
+{
+  guint e, sub;
+
+  if (index < SUB_BUCKETS)
+    return index;
+
+  e = (index - SUB_BUCKETS) / SUB_BUCKETS + SUB_BITS;
+  sub = (index - SUB_BUCKETS) % SUB_BUCKETS;
+
+  return ((guint64) (SUB_BUCKETS + sub + 1) << (e - SUB_BITS)) - 1;
+}
+
+gint64 connman_stats_begin(void)
+{
+  return g_get_monotonic_time();
+}
+
+/* record one call of @method that was started at @start */
+void connman_stats_end(guint method,
+                       gint64 start,
+                       gboolean failed)
+{
+  Histogram *h;
+  gint64 elapsed;
+  gint usec, max;
+
+  g_return_if_fail(method < CONNMAN_STATS_LAST);
+
+  h = &histograms[method];
+  elapsed = g_get_monotonic_time() - start;
+  usec = CLAMP(elapsed, 0, G_MAXINT32);
+
+  g_atomic_int_inc(&h->buckets[bucket_index(usec)]);
+  g_atomic_int_inc(&h->count);
+
+  if (failed)
+    g_atomic_int_inc(&h->errors);
+
+  do
+    max = g_atomic_int_get(&h->max);
+  while (usec > max && !g_atomic_int_compare_and_exchange(&h->max, max, usec));
+}
+
+const gchar *connman_stats_get_name(guint method)
+{
+  g_return_val_if_fail(method < CONNMAN_STATS_LAST, NULL);
+  return method_names[method];
+}
+
+guint connman_stats_get_count(guint method)
+{
+  g_return_val_if_fail(method < CONNMAN_STATS_LAST, 0);
+  return g_atomic_int_get(&histograms[method].count);
+}
+
+guint connman_stats_get_errors(guint method)
+{
+  g_return_val_if_fail(method < CONNMAN_STATS_LAST, 0);
+  return g_atomic_int_get(&histograms[method].errors);
+}
+
+guint64 connman_stats_get_max(guint method)
+{
+  g_return_val_if_fail(method < CONNMAN_STATS_LAST, 0);
+  return g_atomic_int_get(&histograms[method].max);
+}
+
+/*
+ * Latency in usec below which @percentile (0..100) of the calls of
+ * @method completed. Concurrent updates may skew the result slightly.
+ */
+guint64 connman_stats_get_percentile(guint method,
+                                     gdouble percentile)
+{
+  Histogram *h;
+  guint64 target, seen = 0;
+  guint count, i;
+
+  g_return_val_if_fail(method < CONNMAN_STATS_LAST, 0);
+
+  h = &histograms[method];
+  count = g_atomic_int_get(&h->count);
+  if (!count)
+    return 0;
+
+  target = (guint64) (count * CLAMP(percentile, 0.0, 100.0) / 100.0 + 0.5);
+  target = MAX(target, 1);
+
+  for (i = 0; i < N_BUCKETS; i++)
+    {
+      seen += g_atomic_int_get(&h->buckets[i]);
+      if (seen >= target)
+        return MIN(bucket_value(i), (guint64) g_atomic_int_get(&h->max));
+    }
+
+  return g_atomic_int_get(&h->max);
+}
+
+void connman_stats_dump(void)
+{
+  guint i;
+
+  for (i = 0; i < CONNMAN_STATS_LAST; i++)
+    {
+      if (!connman_stats_get_count(i))
+        continue;
+
+      g_message("%-26s %6u calls %4u errors  p50 %" G_GUINT64_FORMAT
+                "us  p99 %" G_GUINT64_FORMAT "us  p999 %" G_GUINT64_FORMAT
+                "us  max %" G_GUINT64_FORMAT "us",
+                method_names[i],
+                connman_stats_get_count(i),
+                connman_stats_get_errors(i),
+                connman_stats_get_percentile(i, 50.0),
+                connman_stats_get_percentile(i, 99.0),
+                connman_stats_get_percentile(i, 99.9),
+                connman_stats_get_max(i));
+    }
+}
+
+void connman_stats_object_new(guint type,
+                              gsize size)
+{
+  g_return_if_fail(type < CONNMAN_STATS_OBJECT_LAST);
+
+  g_atomic_int_inc(&memory[type].live);
+  g_atomic_pointer_add(&memory[type].object_bytes, size);
+}
+
+void connman_stats_object_free(guint type,
+                               gsize size)
+{
+  g_return_if_fail(type < CONNMAN_STATS_OBJECT_LAST);
+
+  g_atomic_int_add(&memory[type].live, -1);
+  g_atomic_pointer_add(&memory[type].object_bytes, -(gssize) size);
+}
+
+/* account for a string member being replaced, either side may be NULL */
+void connman_stats_string_replaced(guint type,
+                                   const gchar *old_str,
+                                   const gchar *new_str)
+{
+  gssize delta = 0;
+
+  g_return_if_fail(type < CONNMAN_STATS_OBJECT_LAST);
+
+  if (old_str)
+    delta -= strlen(old_str) + 1;
+  if (new_str)
+    delta += strlen(new_str) + 1;
+
+  g_atomic_pointer_add(&memory[type].string_bytes, delta);
+}
+
+void connman_stats_variant_replaced(guint type,
+                                    GVariant *old_value,
+                                    GVariant *new_value)
+{
+  gssize delta = 0;
+
+  g_return_if_fail(type < CONNMAN_STATS_OBJECT_LAST);
+
+  if (old_value)
+    delta -= g_variant_get_size(old_value);
+  if (new_value)
+    delta += g_variant_get_size(new_value);
+
+  g_atomic_pointer_add(&memory[type].variant_bytes, delta);
+}
+
+void connman_stats_get_memory(guint type,
+                              ConnmanStatsMemory *mem)
+{
+  g_return_if_fail(type < CONNMAN_STATS_OBJECT_LAST);
+  g_return_if_fail(mem != NULL);
+
+  mem->live = g_atomic_int_get(&memory[type].live);
+  mem->object_bytes = (gsize) g_atomic_pointer_get(&memory[type].object_bytes);
+  mem->string_bytes = (gsize) g_atomic_pointer_get(&memory[type].string_bytes);
+  mem->variant_bytes = (gsize) g_atomic_pointer_get(&memory[type].variant_bytes);
+}
+
+void connman_stats_dump_memory(void)
+{
+  ConnmanStatsMemory mem;
+  gsize total = 0;
+  guint i;
+
+  for (i = 0; i < CONNMAN_STATS_OBJECT_LAST; i++)
+    {
+      connman_stats_get_memory(i, &mem);
+      total += mem.object_bytes + mem.string_bytes + mem.variant_bytes;
+
+      g_message("%-22s %6u live  %8" G_GSIZE_FORMAT " bytes objects  %8"
+                G_GSIZE_FORMAT " bytes strings  %8" G_GSIZE_FORMAT " bytes variants",
+                object_names[i], mem.live, mem.object_bytes,
+                mem.string_bytes, mem.variant_bytes);
+    }
+
+  g_message("%" G_GSIZE_FORMAT " bytes accounted in total", total);
+}
+
+static gboolean dump_signal_handler(gpointer user_data)
+{
+  connman_stats_dump();
+  connman_stats_dump_memory();
+
+  return TRUE;
+}
+
+/* dump all histograms from the default main loop on SIGUSR1 */
+void connman_stats_dump_on_signal(void)
+{
+  g_unix_signal_add(SIGUSR1, dump_signal_handler, NULL);
+}
@@ -0,0 +1,80 @@
+#ifndef CONNMAN_STATS_H_
+#define CONNMAN_STATS_H_
+
+#include <glib.h>
+
+G_BEGIN_DECLS
+
+/* D-Bus methods with a latency histogram */
+enum {
+  CONNMAN_STATS_MANAGER_GET_PROPERTIES = 0,
+  CONNMAN_STATS_MANAGER_GET_SERVICES,
+  CONNMAN_STATS_MANAGER_CONNECT_SERVICE,
+  CONNMAN_STATS_TECHNOLOGY_GET_PROPERTIES,
+  CONNMAN_STATS_TECHNOLOGY_SET_PROPERTY,
+  CONNMAN_STATS_SERVICE_CONNECT,
+  CONNMAN_STATS_MANAGER_REQUEST_SCAN,
+  CONNMAN_STATS_MANAGER_PROVISION_SERVICE,
+  CONNMAN_STATS_CLOCK_GET_PROPERTIES,
+  CONNMAN_STATS_MANAGER_REGISTER_AGENT,
+  CONNMAN_STATS_MANAGER_UNREGISTER_AGENT,
+  CONNMAN_STATS_MANAGER_REGISTER_COUNTER,
+  CONNMAN_STATS_MANAGER_UNREGISTER_COUNTER,
+  CONNMAN_STATS_MANAGER_CREATE_SESSION,
+  CONNMAN_STATS_MANAGER_DESTROY_SESSION,
+  CONNMAN_STATS_MANAGER_LOOKUP_SERVICE,
+  CONNMAN_STATS_LAST
+};
+
+gint64 connman_stats_begin(void);
+void connman_stats_end(guint method,
+                       gint64 start,
+                       gboolean failed);
+
+const gchar *connman_stats_get_name(guint method);
+guint connman_stats_get_count(guint method);
+guint connman_stats_get_errors(guint method);
+guint64 connman_stats_get_max(guint method);
+guint64 connman_stats_get_percentile(guint method,
+                                     gdouble percentile);
+
+void connman_stats_dump(void);
+void connman_stats_dump_on_signal(void);
+
+/* object types with memory accounting */
+enum {
+  CONNMAN_STATS_OBJECT_SERVICE = 0,
+  CONNMAN_STATS_OBJECT_TECHNOLOGY,
+  CONNMAN_STATS_OBJECT_FILTER,
+  CONNMAN_STATS_OBJECT_FILTER_STATE,
+  CONNMAN_STATS_OBJECT_CHANGE,
+  CONNMAN_STATS_OBJECT_PENDING_CALL,
+  CONNMAN_STATS_OBJECT_LAST
+};
+
+typedef struct {
+  guint live;                   /* objects currently allocated */
+  gsize object_bytes;           /* struct sizes of the live objects */
+  gsize string_bytes;           /* strings owned by the live objects */
+  gsize variant_bytes;          /* serialised size of retained GVariants */
+} ConnmanStatsMemory;
+
+void connman_stats_object_new(guint type,
+                              gsize size);
+void connman_stats_object_free(guint type,
+                              gsize size);
+void connman_stats_string_replaced(guint type,
+                                   const gchar *old_str,
+                                   const gchar *new_str);
+void connman_stats_variant_replaced(guint type,
+                                    GVariant *old_value,
+                                    GVariant *new_value);
+
+void connman_stats_get_memory(guint type,
+                              ConnmanStatsMemory *memory);
+void connman_stats_dump_memory(void);
+
+G_END_DECLS
+
+
+#endif /* CONNMAN_STATS_H_ */
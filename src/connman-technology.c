@@ -20,8 +20,12 @@
 #include <glib.h>
 #include <gio/gio.h>
 
+#include "connman-error.h"
 #include "connman-generated.h"
+#include "connman-log.h"
+#include "connman-stats.h"
 #include "connman-technology.h"
+#include "connman-trace.h"
 
 struct _ConnmanTechnology {
   GObject parent;
@@ -64,67 +68,115 @@ connman_technology_set_property (GObject      *object,
     }
 }
 
-static GVariant *connman_technology_get_properties(ConnmanTechnology *technology)
+static GVariant *connman_technology_get_properties(ConnmanTechnology *technology,
+                                                   GError **error)
 {
-  GError *error = NULL;
-  GVariant *ret;
+  GError *local_error = NULL;
+  GVariant *ret = NULL;
+  guint attempt = 0;
+  gint64 start;
 
-  connman_proxy_technology_call_get_properties_sync(technology->proxy,
-                                                    &ret, NULL, &error);
-  if (error)
+  do
     {
-      g_error("%s", error->message);
-      g_error_free(error);
+      start = connman_stats_begin();
+      connman_proxy_technology_call_get_properties_sync(technology->proxy,
+                                                        &ret, NULL, &local_error);
+      connman_stats_end(CONNMAN_STATS_TECHNOLOGY_GET_PROPERTIES, start, local_error != NULL);
+    }
+  while (connman_error_retry(&local_error, &attempt));
+
+  if (local_error)
+    {
+      g_propagate_error(error, local_error);
       return NULL;
     }
 
   return ret;
 }
 
+/*
+ * Timed SetProperty with retries on transient failures. Does nothing
+ * once *@error is set, so a sequence of calls stops at the first error.
+ */
+static void connman_technology_set_property_sync(ConnmanTechnology *technology,
+                                                 const gchar *key,
+                                                 GVariant *value,
+                                                 GError **error)
+{
+  guint attempt = 0;
+  gint64 start;
+
+  if (*error)
+    {
+      g_variant_unref(g_variant_ref_sink(value));
+      return;
+    }
+
+  CONNMAN_TRACE2(technology_set_property, technology->type, key);
+
+  /* the value is consumed by every call, keep it around for retries */
+  g_variant_ref_sink(value);
+
+  do
+    {
+      start = connman_stats_begin();
+      connman_proxy_technology_call_set_property_sync(technology->proxy,
+                                                      key, value, NULL, error);
+      connman_stats_end(CONNMAN_STATS_TECHNOLOGY_SET_PROPERTY, start, *error != NULL);
+    }
+  while (connman_error_retry(error, &attempt));
+
+  g_variant_unref(value);
+
+  CONNMAN_TRACE2(technology_set_property_done, key, *error != NULL);
+}
+
 gboolean connman_technology_enable_tethering(ConnmanTechnology *technology,
                                              const gchar *ssid,
-                                             const gchar *secret)
+                                             const gchar *secret,
+                                             GError **error)
 {
-  GError *error = NULL;
-
-  g_message("Enabling tethering with ssid '%s' on %p", ssid, technology);
-
-  connman_proxy_technology_call_set_property_sync(technology->proxy,
-                                                  "TetheringIdentifier",
-                                                  g_variant_new_variant(g_variant_new_string(ssid)),
-                                                  NULL, &error);
-  connman_proxy_technology_call_set_property_sync(technology->proxy,
-                                                  "TetheringPassphrase",
-                                                  g_variant_new_variant(g_variant_new_string(secret)),
-                                                  NULL, &error);
-  connman_proxy_technology_call_set_property_sync(technology->proxy,
-                                                  "Tethering",
-                                                  g_variant_new_variant(g_variant_new_boolean(TRUE)),
-                                                  NULL, &error);
-  if (error)
+  GError *local_error = NULL;
+
+  connman_message(technology->type, "Enabling tethering with ssid '%s'", ssid);
+  CONNMAN_TRACE1(tethering_enable, technology->type);
+
+  connman_technology_set_property_sync(technology,
+                                       "TetheringIdentifier",
+                                       g_variant_new_variant(g_variant_new_string(ssid)),
+                                       &local_error);
+  connman_technology_set_property_sync(technology,
+                                       "TetheringPassphrase",
+                                       g_variant_new_variant(g_variant_new_string(secret)),
+                                       &local_error);
+  connman_technology_set_property_sync(technology,
+                                       "Tethering",
+                                       g_variant_new_variant(g_variant_new_boolean(TRUE)),
+                                       &local_error);
+  if (local_error)
     {
-      g_error("%s", error->message);
-      g_error_free(error);
+      g_propagate_error(error, local_error);
       return FALSE;
     }
 
   return TRUE;
 }
 
-gboolean connman_technology_disable_tethering(ConnmanTechnology *technology)
+gboolean connman_technology_disable_tethering(ConnmanTechnology *technology,
+                                              GError **error)
 {
-  GError *error = NULL;
+  GError *local_error = NULL;
 
-  g_message("Disabling tethering");
+  connman_message(technology->type, "Disabling tethering");
+  CONNMAN_TRACE1(tethering_disable, technology->type);
 
-  connman_proxy_technology_call_set_property_sync(technology->proxy,
-                                                  "Tethering",
-                                                  g_variant_new_boolean(FALSE),
-                                                  NULL, &error);
-  if (error)
+  connman_technology_set_property_sync(technology,
+                                       "Tethering",
+                                       g_variant_new_variant(g_variant_new_boolean(FALSE)),
+                                       &local_error);
+  if (local_error)
     {
-      g_error("%s", error->message);
-      g_error_free(error);
+      g_propagate_error(error, local_error);
       return FALSE;
     }
 
@@ -132,10 +184,10 @@ gboolean connman_technology_disable_tethering(ConnmanTechnology *technology)
 }
 
 ConnmanTechnology *connman_technology_new(GBusType bus_type,
-                                          const gchar *path)
+                                          const gchar *path,
+                                          GError **error)
 {
   ConnmanTechnology *technology = g_object_new(CONNMAN_TYPE_TECHNOLOGY, NULL);
-  GError *error = NULL;
   GVariant *props;
   gsize i;
 
@@ -143,15 +195,19 @@ ConnmanTechnology *connman_technology_new(GBusType bus_type,
                                                                       G_DBUS_PROXY_FLAGS_NONE,
                                                                       "net.connman", path,
                                                                       NULL, /* cancelable */
-                                                                      &error);
-  if (error)
+                                                                      error);
+  if (!technology->proxy)
     {
-      g_error("%s", error->message);
-      g_error_free(error);
+      g_object_unref(technology);
       return NULL;
     }
 
-  props = connman_technology_get_properties(technology);
+  props = connman_technology_get_properties(technology, error);
+  if (!props)
+    {
+      g_object_unref(technology);
+      return NULL;
+    }
 
   for (i = 0; i < g_variant_n_children(props); i++)
     {
@@ -162,10 +218,15 @@ ConnmanTechnology *connman_technology_new(GBusType bus_type,
       const gchar *key = g_variant_get_string(key_v, NULL);
 
       if (g_str_equal(key, "Type"))
-        technology->type = g_variant_dup_string(val, NULL);
+        {
+          connman_stats_string_replaced(CONNMAN_STATS_OBJECT_TECHNOLOGY, technology->type,
+                                        g_variant_get_string(val, NULL));
+          g_free(technology->type);
+          technology->type = g_variant_dup_string(val, NULL);
+        }
     }
 
-  g_message("new technology %p: '%s'", technology, technology->type);
+  connman_debug(path, "new technology %p: '%s'", technology, technology->type);
 
   return technology;
 }
@@ -176,9 +237,16 @@ const gchar *connman_technology_get_name(ConnmanTechnology *technology)
   return technology->type;
 }
 
+const gchar *connman_technology_get_object_path(ConnmanTechnology *technology)
+{
+  g_return_val_if_fail(CONNMAN_IS_TECHNOLOGY(technology), NULL);
+  return g_dbus_proxy_get_object_path(G_DBUS_PROXY(technology->proxy));
+}
+
 static void
 connman_technology_init (ConnmanTechnology *technology)
 {
+  connman_stats_object_new(CONNMAN_STATS_OBJECT_TECHNOLOGY, sizeof(ConnmanTechnology));
 }
 
 static void
@@ -186,9 +254,12 @@ connman_technology_finalize (GObject *object)
 {
   ConnmanTechnology *technology = CONNMAN_TECHNOLOGY(object);
 
+  connman_stats_string_replaced(CONNMAN_STATS_OBJECT_TECHNOLOGY, technology->type, NULL);
   g_free(technology->type);
   technology->type = NULL;
 
+  connman_stats_object_free(CONNMAN_STATS_OBJECT_TECHNOLOGY, sizeof(ConnmanTechnology));
+
   G_OBJECT_CLASS (parent_class)->finalize (object);
 }
 
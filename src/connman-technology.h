@@ -14,14 +14,23 @@ struct _ConnmanTechnologyClass {
 };
 
 const gchar *connman_technology_get_name(ConnmanTechnology *technology);
+const gchar *connman_technology_get_object_path(ConnmanTechnology *technology);
 
+/*
+ * These block on D-Bus. Outside a running main loop, transient
+ * failures are also retried with a blocking backoff of up to 700ms;
+ * from within one they are returned at once.
+ */
 gboolean connman_technology_enable_tethering(ConnmanTechnology *technology,
                                              const gchar *ssid,
-                                             const gchar *secret);
-gboolean connman_technology_disable_tethering(ConnmanTechnology *technology);
+                                             const gchar *secret,
+                                             GError **error);
+gboolean connman_technology_disable_tethering(ConnmanTechnology *technology,
+                                              GError **error);
 
 ConnmanTechnology *connman_technology_new(GBusType bus_type,
-                                          const gchar *path);
+                                          const gchar *path,
+                                          GError **error);
 
 GType connman_technology_get_type (void);
 #define CONNMAN_TYPE_TECHNOLOGY             connman_technology_get_type()
@@ -0,0 +1,29 @@
+#ifndef CONNMAN_TRACE_H_
+#define CONNMAN_TRACE_H_
+
+#ifdef HAVE_CONFIG_H
+#include <config.h>
+#endif
+
+/*
+ * Static tracepoints for perf, bpftrace and SystemTap, in the
+ * "connman" provider. Configure with --enable-trace to build them in;
+ * otherwise they compile to nothing, arguments included.
+ *
+ *   bpftrace -e 'usdt:./connman-test:connman:reconcile_end { ... }'
+ */
+#ifdef ENABLE_TRACE
+#include <sys/sdt.h>
+
+#define CONNMAN_TRACE(name)                  DTRACE_PROBE(connman, name)
+#define CONNMAN_TRACE1(name, a)              DTRACE_PROBE1(connman, name, a)
+#define CONNMAN_TRACE2(name, a, b)           DTRACE_PROBE2(connman, name, a, b)
+#define CONNMAN_TRACE3(name, a, b, c)        DTRACE_PROBE3(connman, name, a, b, c)
+#else
+#define CONNMAN_TRACE(name)                  do { } while (0)
+#define CONNMAN_TRACE1(name, a)              do { } while (0)
+#define CONNMAN_TRACE2(name, a, b)           do { } while (0)
+#define CONNMAN_TRACE3(name, a, b, c)        do { } while (0)
+#endif
+
+#endif /* CONNMAN_TRACE_H_ */
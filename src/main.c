@@ -19,16 +19,67 @@
 
 #include <glib.h>
 
+#include "connman-log.h"
 #include "connman-manager.h"
+#include "connman-stats.h"
+
+/* seconds between two --stats reports */
+#define STATS_INTERVAL 10
+
+static gboolean opt_stats = FALSE;
+static gboolean opt_debug = FALSE;
+
+static GOptionEntry entries[] = {
+  { "stats", 's', 0, G_OPTION_ARG_NONE, &opt_stats,
+    "Periodically print D-Bus latency and memory statistics", NULL },
+  { "debug", 'd', 0, G_OPTION_ARG_NONE, &opt_debug,
+    "Enable debug logging, see also CONNMAN_LOG_LEVEL", NULL },
+  { NULL }
+};
+
+static gboolean print_stats(gpointer user_data)
+{
+  connman_stats_dump();
+  connman_stats_dump_memory();
+
+  return TRUE;
+}
+
+static void services_updated(ConnmanManager *manager,
+                             ConnmanManagerChanges *changes,
+                             gpointer user_data)
+{
+  connman_debug(NULL, "services updated: %d added, %d removed, %d modified",
+                g_slist_length(changes->added),
+                g_slist_length(changes->removed),
+                g_slist_length(changes->modified));
+}
 
 int main(int argc, char **argv)
 {
   GMainLoop *loop;
   ConnmanManager *manager;
   GBusType bus_type;
+  GOptionContext *context;
+  GError *error = NULL;
 
   g_type_init();
 
+  context = g_option_context_new("- ConnMan client test");
+  g_option_context_add_main_entries(context, entries, NULL);
+  if (!g_option_context_parse(context, &argc, &argv, &error))
+    {
+      g_printerr("%s\n", error->message);
+      g_error_free(error);
+      g_option_context_free(context);
+      return 1;
+    }
+  g_option_context_free(context);
+
+  connman_log_init();
+  if (opt_debug)
+    connman_log_set_level(CONNMAN_LOG_DEBUG);
+
   loop = g_main_loop_new(NULL, FALSE);
 
   if (geteuid() == 0)
@@ -50,6 +101,15 @@ int main(int argc, char **argv)
       return -1;
     }
 
+  g_signal_connect(manager, "services-updated",
+                   G_CALLBACK(services_updated), NULL);
+
+  /* kill -USR1 prints the D-Bus latency histograms */
+  connman_stats_dump_on_signal();
+
+  if (opt_stats)
+    g_timeout_add_seconds(STATS_INTERVAL, print_stats, NULL);
+
   g_message("Connman state: %s", connman_manager_is_online(manager) ? "ONLINE" : "OFFLINE");
   g_message("Entering runloop ...");
   g_main_loop_run(loop);
@@ -0,0 +1,250 @@
+/*
+ *  Connection Manager example
+ *
+ *  Copyright (C) 2011  Daniel Mack <daniel@zonque.org>
+ *
+ *  This program is free software; you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License version 2 as
+ *  published by the Free Software Foundation.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program; if not, write to the Free Software
+ *  Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+
+
+#include <fcntl.h>
+#include <signal.h>
+#include <string.h>
+#include <unistd.h>
+
+#include <glib.h>
+
+#include "connman-changelog.h"
+
+typedef struct {
+  GByteArray *data;
+  gsize pos;
+} Stream;
+
+/* flush @log and collect everything that reached the other end */
+static void stream_read(Stream *stream,
+                        ConnmanChangelog *log,
+                        int fd)
+{
+  guint8 chunk[4096];
+  gssize ret;
+
+  g_assert(connman_changelog_flush(log));
+
+  while ((ret = read(fd, chunk, sizeof(chunk))) > 0)
+    g_byte_array_append(stream->data, chunk, ret);
+}
+
+static guint64 get_varint(Stream *stream)
+{
+  guint64 v = 0;
+  guint shift = 0;
+  guint8 b;
+
+  do
+    {
+      g_assert_cmpuint(stream->pos, <, stream->data->len);
+      g_assert_cmpuint(shift, <, 64);
+
+      b = stream->data->data[stream->pos++];
+      v |= (guint64) (b & 0x7f) << shift;
+      shift += 7;
+    }
+  while (b & 0x80);
+
+  return v;
+}
+
+static gchar *get_string(Stream *stream)
+{
+  gsize len = get_varint(stream);
+  gchar *str;
+
+  g_assert_cmpuint(stream->pos + len, <=, stream->data->len);
+
+  str = g_strndup((const gchar *) stream->data->data + stream->pos, len);
+  stream->pos += len;
+
+  return str;
+}
+
+/* check the type of the next record and return the end of its payload */
+static gsize get_record(Stream *stream,
+                        guint type)
+{
+  gsize end;
+
+  g_assert_cmpuint(get_varint(stream), ==, type);
+  end = get_varint(stream);
+  end += stream->pos;
+  g_assert_cmpuint(end, <=, stream->data->len);
+
+  /* milliseconds since the previous record */
+  get_varint(stream);
+
+  return end;
+}
+
+static void check_path(Stream *stream,
+                       guint id,
+                       const gchar *path)
+{
+  gsize end = get_record(stream, CONNMAN_CHANGELOG_PATH);
+  gchar *str;
+
+  g_assert_cmpuint(get_varint(stream), ==, id);
+  str = get_string(stream);
+  g_assert_cmpstr(str, ==, path);
+  g_assert_cmpuint(stream->pos, ==, end);
+  g_free(str);
+}
+
+static void check_technology(Stream *stream,
+                             guint id,
+                             const gchar *type)
+{
+  gsize end = get_record(stream, CONNMAN_CHANGELOG_TECHNOLOGY_CHANGED);
+  gchar *str;
+
+  g_assert_cmpuint(get_varint(stream), ==, id);
+  str = get_string(stream);
+  g_assert_cmpstr(str, ==, type);
+  g_assert_cmpuint(stream->pos, ==, end);
+  g_free(str);
+}
+
+static ConnmanChangelog *changelog_open(Stream *stream,
+                                        int fds[2])
+{
+  g_assert(pipe(fds) == 0);
+  g_assert(fcntl(fds[0], F_SETFL, O_NONBLOCK) == 0);
+
+  stream->data = g_byte_array_new();
+  stream->pos = 0;
+
+  return connman_changelog_new(fds[1], NULL);
+}
+
+static void changelog_close(Stream *stream,
+                            ConnmanChangelog *log,
+                            int fds[2])
+{
+  connman_changelog_free(log);
+  close(fds[0]);
+  close(fds[1]);
+  g_byte_array_free(stream->data, TRUE);
+}
+
+static void test_varint(void)
+{
+  ConnmanChangelog *log;
+  Stream stream;
+  gchar *type;
+  int fds[2];
+  gsize end;
+
+  log = changelog_open(&stream, fds);
+
+  /* 300 needs two bytes: 0xac 0x02 */
+  type = g_strnfill(300, 'x');
+  connman_changelog_technology_changed(log, "/net/connman/technology/wifi", type);
+  stream_read(&stream, log, fds[0]);
+
+  g_assert_cmpuint(stream.data->len, >, 5);
+  g_assert(memcmp(stream.data->data, "CMCL", 4) == 0);
+  stream.pos = 4;
+  g_assert_cmpuint(get_varint(&stream), ==, 1);
+
+  check_path(&stream, 0, "/net/connman/technology/wifi");
+
+  end = get_record(&stream, CONNMAN_CHANGELOG_TECHNOLOGY_CHANGED);
+  g_assert_cmpuint(get_varint(&stream), ==, 0);
+  g_assert_cmpuint(stream.data->data[stream.pos], ==, 0xac);
+  g_assert_cmpuint(stream.data->data[stream.pos + 1], ==, 0x02);
+  g_free(get_string(&stream));
+  g_assert_cmpuint(stream.pos, ==, end);
+  g_assert_cmpuint(stream.pos, ==, stream.data->len);
+
+  g_free(type);
+  changelog_close(&stream, log, fds);
+}
+
+static void test_path_retired(void)
+{
+  ConnmanChangelog *log;
+  Stream stream;
+  int fds[2];
+  gsize end;
+
+  log = changelog_open(&stream, fds);
+
+  connman_changelog_technology_changed(log, "/t", "wifi");
+  connman_changelog_technology_changed(log, "/t", "wifi");
+  connman_changelog_technology_removed(log, "/t");
+  connman_changelog_technology_changed(log, "/t", "wifi");
+  stream_read(&stream, log, fds[0]);
+
+  stream.pos = 4;
+  get_varint(&stream);
+
+  /* interned once, then referred to by id */
+  check_path(&stream, 0, "/t");
+  check_technology(&stream, 0, "wifi");
+  check_technology(&stream, 0, "wifi");
+
+  end = get_record(&stream, CONNMAN_CHANGELOG_TECHNOLOGY_REMOVED);
+  g_assert_cmpuint(get_varint(&stream), ==, 0);
+  g_assert_cmpuint(stream.pos, ==, end);
+
+  /* the id was retired with the removal, a new one is never an old one */
+  check_path(&stream, 1, "/t");
+  check_technology(&stream, 1, "wifi");
+  g_assert_cmpuint(stream.pos, ==, stream.data->len);
+
+  changelog_close(&stream, log, fds);
+}
+
+static void test_broken(void)
+{
+  ConnmanChangelog *log;
+  int fds[2];
+
+  g_assert(pipe(fds) == 0);
+  log = connman_changelog_new(fds[1], NULL);
+  close(fds[0]);
+
+  connman_changelog_state_changed(log, "online");
+  g_assert(!connman_changelog_flush(log));
+
+  /* a failed log stays failed and takes no more records */
+  connman_changelog_state_changed(log, "ready");
+  g_assert(!connman_changelog_flush(log));
+
+  connman_changelog_free(log);
+  close(fds[1]);
+}
+
+int main(int argc, char **argv)
+{
+  g_test_init(&argc, &argv, NULL);
+
+  /* writes to the closed pipe must fail, not kill us */
+  signal(SIGPIPE, SIG_IGN);
+
+  g_test_add_func("/changelog/varint", test_varint);
+  g_test_add_func("/changelog/path-retired", test_path_retired);
+  g_test_add_func("/changelog/broken", test_broken);
+
+  return g_test_run();
+}
@@ -0,0 +1,102 @@
+/*
+ *  Connection Manager example
+ *
+ *  Copyright (C) 2011  Daniel Mack <daniel@zonque.org>
+ *
+ *  This program is free software; you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License version 2 as
+ *  published by the Free Software Foundation.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program; if not, write to the Free Software
+ *  Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+
+
+#include <glib.h>
+#include <glib-object.h>
+
+#include "connman-service.h"
+
+static ConnmanService *service_new(const gchar *name,
+                                   guchar strength,
+                                   gint64 last_seen)
+{
+  GVariantBuilder builder;
+  ConnmanService *service;
+  GVariant *variant;
+  gchar *path;
+
+  g_variant_builder_init(&builder, G_VARIANT_TYPE("a{sv}"));
+  g_variant_builder_add(&builder, "{sv}", "Name", g_variant_new_string(name));
+  g_variant_builder_add(&builder, "{sv}", "Type", g_variant_new_string("wifi"));
+  g_variant_builder_add(&builder, "{sv}", "Strength", g_variant_new_byte(strength));
+
+  path = g_strconcat("/net/connman/service/wifi_", name, NULL);
+  variant = g_variant_ref_sink(g_variant_new("(o@a{sv})", path,
+                                             g_variant_builder_end(&builder)));
+  service = connman_service_new(variant);
+  connman_service_set_last_seen(service, last_seen);
+
+  g_variant_unref(variant);
+  g_free(path);
+
+  return service;
+}
+
+static void test_order(void)
+{
+  ConnmanService *services[] = {
+    service_new("strong", 80, 100),
+    service_new("weak_old", 20, 100),
+    service_new("medium", 50, 300),
+    service_new("weak_recent", 20, 200),
+  };
+  static const gchar *expected[] = {
+    "weak_old", "weak_recent", "medium", "strong",
+  };
+  GSList *list = NULL, *iter;
+  gsize i;
+
+  for (i = 0; i < G_N_ELEMENTS(services); i++)
+    list = g_slist_prepend(list, services[i]);
+
+  list = g_slist_sort(list, connman_service_compare_eviction);
+
+  /* weakest first; among equals, the one out of range the longest */
+  for (i = 0, iter = list; iter; i++, iter = iter->next)
+    g_assert_cmpstr(connman_service_get_name(iter->data), ==, expected[i]);
+  g_assert_cmpuint(i, ==, G_N_ELEMENTS(expected));
+
+  g_slist_free(list);
+  for (i = 0; i < G_N_ELEMENTS(services); i++)
+    g_object_unref(services[i]);
+}
+
+static void test_equal(void)
+{
+  ConnmanService *a = service_new("a", 40, 100);
+  ConnmanService *b = service_new("b", 40, 100);
+
+  g_assert_cmpint(connman_service_compare_eviction(a, b), ==, 0);
+  g_assert_cmpint(connman_service_compare_eviction(a, a), ==, 0);
+
+  g_object_unref(a);
+  g_object_unref(b);
+}
+
+int main(int argc, char **argv)
+{
+  g_type_init();
+  g_test_init(&argc, &argv, NULL);
+
+  g_test_add_func("/eviction/order", test_order);
+  g_test_add_func("/eviction/equal", test_equal);
+
+  return g_test_run();
+}
@@ -0,0 +1,169 @@
+/*
+ *  Connection Manager example
+ *
+ *  Copyright (C) 2011  Daniel Mack <daniel@zonque.org>
+ *
+ *  This program is free software; you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License version 2 as
+ *  published by the Free Software Foundation.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program; if not, write to the Free Software
+ *  Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+
+
+#include <glib.h>
+#include <glib-object.h>
+
+#include "connman-service.h"
+
+typedef struct {
+  guint calls;
+  guint fields;                 /* of the last delivery */
+  gint64 time;                  /* of the last delivery */
+  GMainLoop *loop;
+} Deliveries;
+
+static void filter_func(ConnmanService *service,
+                        guint fields,
+                        gpointer user_data)
+{
+  Deliveries *d = user_data;
+
+  d->calls++;
+  d->fields = fields;
+  d->time = g_get_monotonic_time();
+
+  if (d->loop)
+    g_main_loop_quit(d->loop);
+}
+
+static ConnmanService *service_new(guchar strength)
+{
+  GVariantBuilder builder;
+  ConnmanService *service;
+  GVariant *variant;
+
+  g_variant_builder_init(&builder, G_VARIANT_TYPE("a{sv}"));
+  g_variant_builder_add(&builder, "{sv}", "Name", g_variant_new_string("test"));
+  g_variant_builder_add(&builder, "{sv}", "Type", g_variant_new_string("wifi"));
+  g_variant_builder_add(&builder, "{sv}", "State", g_variant_new_string("idle"));
+  g_variant_builder_add(&builder, "{sv}", "Strength", g_variant_new_byte(strength));
+
+  variant = g_variant_ref_sink(g_variant_new("(o@a{sv})",
+                                              "/net/connman/service/wifi_test",
+                                              g_variant_builder_end(&builder)));
+  service = connman_service_new(variant);
+  g_variant_unref(variant);
+
+  return service;
+}
+
+static void set_property(ConnmanService *service,
+                         const gchar *key,
+                         GVariant *value)
+{
+  g_variant_ref_sink(value);
+  connman_service_update_property(service, key, value);
+  g_variant_unref(value);
+}
+
+static void test_deadband(void)
+{
+  ConnmanService *service = service_new(50);
+  ConnmanServiceFilter *filter;
+  Deliveries d = { 0, };
+
+  filter = connman_service_filter_new(CONNMAN_SERVICE_FIELD_STRENGTH |
+                                      CONNMAN_SERVICE_FIELD_STATE,
+                                      filter_func, &d, NULL);
+  connman_service_filter_set_strength_deadband(filter, 5);
+  connman_service_add_filter(service, filter);
+
+  /* measured from the last reported value, not the last change */
+  set_property(service, "Strength", g_variant_new_byte(53));
+  g_assert_cmpuint(d.calls, ==, 0);
+  set_property(service, "Strength", g_variant_new_byte(56));
+  g_assert_cmpuint(d.calls, ==, 1);
+  g_assert_cmpuint(d.fields, ==, CONNMAN_SERVICE_FIELD_STRENGTH);
+  set_property(service, "Strength", g_variant_new_byte(52));
+  g_assert_cmpuint(d.calls, ==, 1);
+  set_property(service, "Strength", g_variant_new_byte(50));
+  g_assert_cmpuint(d.calls, ==, 2);
+
+  /* other fields pass regardless */
+  set_property(service, "State", g_variant_new_string("ready"));
+  g_assert_cmpuint(d.calls, ==, 3);
+  g_assert_cmpuint(d.fields, ==, CONNMAN_SERVICE_FIELD_STATE);
+
+  /* and fields nobody asked for never reach the consumer */
+  set_property(service, "Name", g_variant_new_string("other"));
+  g_assert_cmpuint(d.calls, ==, 3);
+
+  connman_service_remove_filter(service, filter);
+  connman_service_filter_unref(filter);
+  g_object_unref(service);
+}
+
+static gboolean timeout_fail(gpointer user_data)
+{
+  g_assert_not_reached();
+  return FALSE;
+}
+
+static void test_rate_limit(void)
+{
+  ConnmanService *service = service_new(50);
+  ConnmanServiceFilter *filter;
+  Deliveries d = { 0, };
+  gint64 first;
+  guint timeout;
+
+  filter = connman_service_filter_new(CONNMAN_SERVICE_FIELD_STRENGTH |
+                                      CONNMAN_SERVICE_FIELD_STATE,
+                                      filter_func, &d, NULL);
+  connman_service_filter_set_min_interval(filter, 100);
+  connman_service_add_filter(service, filter);
+
+  set_property(service, "Strength", g_variant_new_byte(70));
+  g_assert_cmpuint(d.calls, ==, 1);
+  first = d.time;
+
+  /* held back, then delivered together once the interval expired */
+  set_property(service, "Strength", g_variant_new_byte(80));
+  set_property(service, "State", g_variant_new_string("ready"));
+  g_assert_cmpuint(d.calls, ==, 1);
+
+  d.loop = g_main_loop_new(NULL, FALSE);
+  timeout = g_timeout_add_seconds(5, timeout_fail, NULL);
+  g_main_loop_run(d.loop);
+  g_source_remove(timeout);
+  g_main_loop_unref(d.loop);
+
+  g_assert_cmpuint(d.calls, ==, 2);
+  g_assert_cmpuint(d.fields, ==, CONNMAN_SERVICE_FIELD_STRENGTH |
+                                 CONNMAN_SERVICE_FIELD_STATE);
+  /* allow for the first delivery being timed after the filter's clock */
+  g_assert_cmpint(d.time - first, >=, 90 * 1000);
+
+  connman_service_remove_filter(service, filter);
+  connman_service_filter_unref(filter);
+  g_object_unref(service);
+}
+
+int main(int argc, char **argv)
+{
+  g_type_init();
+  g_test_init(&argc, &argv, NULL);
+
+  g_test_add_func("/filter/deadband", test_deadband);
+  g_test_add_func("/filter/rate-limit", test_rate_limit);
+
+  return g_test_run();
+}
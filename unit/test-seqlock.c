@@ -0,0 +1,177 @@
+/*
+ *  Connection Manager example
+ *
+ *  Copyright (C) 2011  Daniel Mack <daniel@zonque.org>
+ *
+ *  This program is free software; you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License version 2 as
+ *  published by the Free Software Foundation.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program; if not, write to the Free Software
+ *  Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+
+
+#include <string.h>
+#include <unistd.h>
+#include <sys/types.h>
+#include <sys/wait.h>
+
+#include <glib.h>
+
+#include "connman-shm.h"
+
+#define N_SERVICES 8
+#define N_UPDATES  100000
+
+static gchar *segment_name;
+
+/* every field of update @n carries @n, so a torn copy mixes values */
+static void fill(ConnmanShmHeader *header,
+                 guint32 n)
+{
+  guint i;
+
+  header->online = n;
+  header->n_services = N_SERVICES;
+
+  for (i = 0; i < N_SERVICES; i++)
+    {
+      ConnmanShmService *service = &header->services[i];
+
+      memset(service->name, 'a' + n % 26, sizeof(service->name) - 1);
+      service->name[sizeof(service->name) - 1] = '\0';
+      service->strength = n;
+      service->generation = n;
+    }
+}
+
+static void check(const ConnmanShmHeader *header)
+{
+  guint32 n = header->online;
+  guint i, j;
+
+  g_assert_cmpuint(header->n_services, ==, N_SERVICES);
+
+  for (i = 0; i < N_SERVICES; i++)
+    {
+      const ConnmanShmService *service = &header->services[i];
+
+      g_assert_cmpuint(service->strength, ==, n);
+      g_assert_cmpuint(service->generation, ==, n);
+      for (j = 0; j < sizeof(service->name) - 1; j++)
+        g_assert_cmpint(service->name[j], ==, 'a' + n % 26);
+    }
+}
+
+static void test_open_section(void)
+{
+  ConnmanShmWriter *writer = connman_shm_writer_new(segment_name, N_SERVICES);
+  ConnmanShmReader *reader;
+  const ConnmanShmHeader *header;
+
+  g_assert(writer != NULL);
+  reader = connman_shm_reader_open(segment_name);
+  g_assert(reader != NULL);
+
+  fill(connman_shm_writer_begin(writer), 1);
+  connman_shm_writer_commit(writer);
+
+  header = connman_shm_reader_read(reader);
+  g_assert(header != NULL);
+  check(header);
+
+  /* a writer stuck halfway through is never read from */
+  fill(connman_shm_writer_begin(writer), 2);
+  g_assert(connman_shm_reader_read(reader) == NULL);
+
+  connman_shm_writer_commit(writer);
+  header = connman_shm_reader_read(reader);
+  g_assert(header != NULL);
+  g_assert_cmpuint(header->online, ==, 2);
+  check(header);
+
+  connman_shm_reader_close(reader);
+  connman_shm_writer_free(writer);
+}
+
+static void test_concurrent(void)
+{
+  ConnmanShmWriter *writer = connman_shm_writer_new(segment_name, N_SERVICES);
+  ConnmanShmReader *reader;
+  const ConnmanShmHeader *header;
+  guint reads = 0;
+  pid_t pid;
+  int status;
+
+  g_assert(writer != NULL);
+  reader = connman_shm_reader_open(segment_name);
+  g_assert(reader != NULL);
+
+  fill(connman_shm_writer_begin(writer), 0);
+  connman_shm_writer_commit(writer);
+
+  pid = fork();
+  g_assert(pid >= 0);
+
+  if (pid == 0)
+    {
+      guint32 n;
+
+      for (n = 1; n <= N_UPDATES; n++)
+        {
+          fill(connman_shm_writer_begin(writer), n);
+          connman_shm_writer_commit(writer);
+        }
+
+      _exit(0);
+    }
+
+  /* a busy writer may make a read give up, but never return a torn copy */
+  while (waitpid(pid, &status, WNOHANG) == 0)
+    {
+      header = connman_shm_reader_read(reader);
+      if (!header)
+        continue;
+
+      check(header);
+      reads++;
+    }
+
+  g_assert(WIFEXITED(status) && WEXITSTATUS(status) == 0);
+
+  header = connman_shm_reader_read(reader);
+  g_assert(header != NULL);
+  g_assert_cmpuint(header->online, ==, N_UPDATES);
+  check(header);
+
+  if (g_test_verbose())
+    g_print("%u consistent reads during %u updates\n", reads, N_UPDATES);
+
+  connman_shm_reader_close(reader);
+  connman_shm_writer_free(writer);
+}
+
+int main(int argc, char **argv)
+{
+  int ret;
+
+  g_test_init(&argc, &argv, NULL);
+
+  segment_name = g_strdup_printf("/connman-test-%d", (int) getpid());
+
+  g_test_add_func("/seqlock/open-section", test_open_section);
+  g_test_add_func("/seqlock/concurrent", test_concurrent);
+
+  ret = g_test_run();
+
+  g_free(segment_name);
+
+  return ret;
+}
@@ -0,0 +1,148 @@
+/*
+ *  Connection Manager example
+ *
+ *  Copyright (C) 2011  Daniel Mack <daniel@zonque.org>
+ *
+ *  This program is free software; you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License version 2 as
+ *  published by the Free Software Foundation.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program; if not, write to the Free Software
+ *  Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+
+
+#include <string.h>
+#include <unistd.h>
+
+#include <glib.h>
+
+#include "connman-snapshot.h"
+
+/* offset of the version in the file header, after the 8 byte magic */
+#define VERSION_OFFSET 8
+
+static gchar *snapshot_path;
+static gchar *contents;
+static gsize length;
+
+static GVariant *services_new(void)
+{
+  GVariantBuilder attrs, services;
+
+  g_variant_builder_init(&attrs, G_VARIANT_TYPE("a{sv}"));
+  g_variant_builder_add(&attrs, "{sv}", "Name", g_variant_new_string("test"));
+  g_variant_builder_add(&attrs, "{sv}", "Strength", g_variant_new_byte(42));
+
+  g_variant_builder_init(&services, G_VARIANT_TYPE("a(oa{sv})"));
+  g_variant_builder_add(&services, "(o@a{sv})", "/net/connman/service/wifi_test",
+                        g_variant_builder_end(&attrs));
+
+  return g_variant_ref_sink(g_variant_builder_end(&services));
+}
+
+/* a copy of the good file to corrupt */
+static gchar *contents_dup(void)
+{
+  gchar *data;
+
+  g_assert(contents != NULL);
+
+  data = g_malloc(length);
+  memcpy(data, contents, length);
+
+  return data;
+}
+
+static void rewrite(const gchar *data,
+                    gsize len)
+{
+  g_assert(g_file_set_contents(snapshot_path, data, len, NULL));
+}
+
+static void test_roundtrip(void)
+{
+  ConnmanSnapshot *snapshot;
+  GVariant *services = services_new();
+
+  g_assert(connman_snapshot_write(snapshot_path, services, TRUE));
+
+  snapshot = connman_snapshot_load(snapshot_path);
+  g_assert(snapshot != NULL);
+  g_assert(connman_snapshot_get_online(snapshot));
+  g_assert(g_variant_equal(connman_snapshot_get_services(snapshot), services));
+  connman_snapshot_free(snapshot);
+
+  /* keep the good file for the tests below */
+  g_assert(g_file_get_contents(snapshot_path, &contents, &length, NULL));
+
+  g_variant_unref(services);
+}
+
+static void test_checksum(void)
+{
+  gchar *data = contents_dup();
+
+  /* the last byte belongs to the payload */
+  data[length - 1] ^= 0x01;
+  rewrite(data, length);
+  g_assert(connman_snapshot_load(snapshot_path) == NULL);
+
+  /* as does a short file */
+  rewrite(contents, length - 1);
+  g_assert(connman_snapshot_load(snapshot_path) == NULL);
+
+  g_free(data);
+}
+
+static void test_version(void)
+{
+  gchar *data = contents_dup();
+  ConnmanSnapshot *snapshot;
+  guint32 version;
+
+  memcpy(&version, data + VERSION_OFFSET, sizeof(version));
+  version++;
+  memcpy(data + VERSION_OFFSET, &version, sizeof(version));
+
+  rewrite(data, length);
+  g_assert(connman_snapshot_load(snapshot_path) == NULL);
+
+  /* the intact file still loads */
+  rewrite(contents, length);
+  snapshot = connman_snapshot_load(snapshot_path);
+  g_assert(snapshot != NULL);
+  connman_snapshot_free(snapshot);
+
+  g_free(data);
+}
+
+int main(int argc, char **argv)
+{
+  int ret, fd;
+
+  g_test_init(&argc, &argv, NULL);
+
+  fd = g_file_open_tmp("test-snapshot-XXXXXX", &snapshot_path, NULL);
+  g_assert(fd >= 0);
+  close(fd);
+
+  /* run in order: the roundtrip leaves the file the others corrupt */
+  g_test_add_func("/snapshot/roundtrip", test_roundtrip);
+  g_test_add_func("/snapshot/checksum", test_checksum);
+  g_test_add_func("/snapshot/version", test_version);
+
+  ret = g_test_run();
+
+  unlink(snapshot_path);
+  g_free(snapshot_path);
+  g_free(contents);
+
+  return ret;
+}
@@ -0,0 +1,103 @@
+/*
+ *  Connection Manager example
+ *
+ *  Copyright (C) 2011  Daniel Mack <daniel@zonque.org>
+ *
+ *  This program is free software; you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License version 2 as
+ *  published by the Free Software Foundation.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program; if not, write to the Free Software
+ *  Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+
+
+#include <glib.h>
+
+#include "connman-stats.h"
+
+/*
+ * Record a call of @method that took at least @usec and return an
+ * upper bound for what was actually recorded.
+ */
+static guint64 record(guint method,
+                      guint64 usec,
+                      gboolean failed)
+{
+  gint64 before = connman_stats_begin();
+
+  connman_stats_end(method, before - usec, failed);
+
+  return usec + (connman_stats_begin() - before);
+}
+
+static void test_counts(void)
+{
+  guint method = CONNMAN_STATS_MANAGER_GET_PROPERTIES;
+
+  g_assert_cmpuint(connman_stats_get_count(method), ==, 0);
+  g_assert_cmpuint(connman_stats_get_percentile(method, 50), ==, 0);
+
+  record(method, 100, FALSE);
+  record(method, 100, TRUE);
+  record(method, 100, FALSE);
+
+  g_assert_cmpuint(connman_stats_get_count(method), ==, 3);
+  g_assert_cmpuint(connman_stats_get_errors(method), ==, 1);
+}
+
+static void test_buckets(void)
+{
+  static const guint64 latencies[] = { 1000, 4095, 4096, 25000, 1000000, 60000000 };
+  gsize i;
+
+  for (i = 0; i < G_N_ELEMENTS(latencies); i++)
+    {
+      /* a method of its own per latency, the last one is for test_clamp() */
+      guint method = CONNMAN_STATS_MANAGER_GET_SERVICES + i;
+      guint64 usec = latencies[i];
+      guint64 upper, p50;
+
+      g_assert_cmpuint(method, <, CONNMAN_STATS_LAST - 1);
+
+      /* the second, much slower call keeps the median off the max */
+      upper = record(method, usec, FALSE);
+      record(method, usec * 100, FALSE);
+
+      /* a bucket spans 1/16 of its power of two at most */
+      p50 = connman_stats_get_percentile(method, 50);
+      g_assert_cmpuint(p50, >=, usec);
+      g_assert_cmpuint(p50, <=, upper + upper / 16);
+
+      g_assert_cmpuint(connman_stats_get_percentile(method, 100), ==,
+                       connman_stats_get_max(method));
+    }
+}
+
+static void test_clamp(void)
+{
+  guint method = CONNMAN_STATS_LAST - 1;
+
+  /* longer than a gint of microseconds holds */
+  record(method, (guint64) G_MAXINT32 + 1000, FALSE);
+
+  g_assert_cmpuint(connman_stats_get_max(method), ==, G_MAXINT32);
+  g_assert_cmpuint(connman_stats_get_percentile(method, 50), ==, G_MAXINT32);
+}
+
+int main(int argc, char **argv)
+{
+  g_test_init(&argc, &argv, NULL);
+
+  g_test_add_func("/stats/counts", test_counts);
+  g_test_add_func("/stats/buckets", test_buckets);
+  g_test_add_func("/stats/clamp", test_clamp);
+
+  return g_test_run();
+}